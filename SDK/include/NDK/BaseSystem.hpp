@@ -26,6 +26,8 @@ namespace Ndk
 			BaseSystem(BaseSystem&&) noexcept = default;
 			virtual ~BaseSystem();
 
+			bool ConflictsWith(const BaseSystem& system) const;
+
 			inline void Enable(bool enable = true);
 
 			bool Filters(const Entity* entity) const;
@@ -38,6 +40,7 @@ namespace Ndk
 			inline World& GetWorld() const;
 
 			inline bool IsEnabled() const;
+			inline bool IsExclusive() const;
 
 			inline bool HasEntity(const Entity* entity) const;
 
@@ -55,8 +58,14 @@ namespace Ndk
 			template<typename ComponentType1, typename ComponentType2, typename... Rest> void Excludes();
 			inline void ExcludesComponent(ComponentIndex index);
 
+			template<typename F> void ForEachEntityParallel(const F& iterationFunc, std::size_t grainSize = 0) const;
+
 			static SystemIndex GetNextIndex();
 
+			template<typename ComponentType> void Reads();
+			template<typename ComponentType1, typename ComponentType2, typename... Rest> void Reads();
+			inline void ReadsComponent(ComponentIndex index);
+
 			template<typename ComponentType> void Requires();
 			template<typename ComponentType1, typename ComponentType2, typename... Rest> void Requires();
 			inline void RequiresComponent(ComponentIndex index);
@@ -65,6 +74,10 @@ namespace Ndk
 			template<typename ComponentType1, typename ComponentType2, typename... Rest> void RequiresAny();
 			inline void RequiresAnyComponent(ComponentIndex index);
 
+			template<typename ComponentType> void Writes();
+			template<typename ComponentType1, typename ComponentType2, typename... Rest> void Writes();
+			inline void WritesComponent(ComponentIndex index);
+
 			virtual void OnUpdate(float elapsedTime) = 0;
 
 		private:
@@ -85,8 +98,10 @@ namespace Ndk
 
 			Nz::Bitset<> m_excludedComponents;
 			mutable Nz::Bitset<> m_filterResult;
+			Nz::Bitset<> m_readComponents;
 			Nz::Bitset<> m_requiredAnyComponents;
 			Nz::Bitset<> m_requiredComponents;
+			Nz::Bitset<> m_writtenComponents;
 			EntityList m_entities;
 			SystemIndex m_systemIndex;
 			World* m_world;
@@ -103,6 +103,23 @@ namespace Ndk
 		return m_updateEnabled;
 	}
 
+	/*!
+	* \brief Checks whether or not the system must be updated alone
+	* \return true If it is the case
+	*
+	* Exclusive systems are updated on the thread updating the world, after every system preceding them and before every system following them.
+	* A system is exclusive until it declares the components it reads or writes, then it may be updated concurrently with systems it doesn't conflict with.
+	*
+	* \see ConflictsWith
+	* \see Reads
+	* \see Writes
+	*/
+
+	inline bool BaseSystem::IsExclusive() const
+	{
+		return !m_readComponents.TestAny() && !m_writtenComponents.TestAny();
+	}
+
 	/*!
 	* \brief Checks whether or not the system has the entity
 	* \return true If it is the case
@@ -220,6 +237,21 @@ namespace Ndk
 		m_excludedComponents.UnboundedSet(index);
 	}
 
+	/*!
+	* \brief Executes a function on every entity of the system, spreading the work over the TaskScheduler workers
+	*
+	* \param iterationFunc Function to be called with a constant reference to the entity handle, must be safe to call concurrently for different entities
+	* \param grainSize Minimal number of entity ids handled by one task, zero to let it be computed from the worker count
+	*
+	* \see EntityList::ForEachParallel
+	*/
+
+	template<typename F>
+	void BaseSystem::ForEachEntityParallel(const F& iterationFunc, std::size_t grainSize) const
+	{
+		m_entities.ForEachParallel(iterationFunc, grainSize);
+	}
+
 	/*!
 	* \brief Gets the next index for the system
 	* \return Next unique index for the system
@@ -230,6 +262,46 @@ namespace Ndk
 		return s_nextIndex++;
 	}
 
+	/*!
+	* \brief Declares a component read by the system
+	*
+	* Systems which declared the components they read and write may be updated concurrently with other systems
+	*
+	* \see IsExclusive
+	*/
+
+	template<typename ComponentType>
+	void BaseSystem::Reads()
+	{
+		static_assert(std::is_base_of<BaseComponent, ComponentType>::value, "ComponentType is not a component");
+
+		ReadsComponent(GetComponentIndex<ComponentType>());
+	}
+
+	/*!
+	* \brief Declares some components read by the system
+	*/
+
+	template<typename ComponentType1, typename ComponentType2, typename... Rest>
+	void BaseSystem::Reads()
+	{
+		Reads<ComponentType1>();
+		Reads<ComponentType2, Rest...>();
+	}
+
+	/*!
+	* \brief Declares a component read by the system by index
+	*
+	* \param index Index of the component
+	*
+	* \remark Accesses should be declared before the system is added to a world
+	*/
+
+	inline void BaseSystem::ReadsComponent(ComponentIndex index)
+	{
+		m_readComponents.UnboundedSet(index);
+	}
+
 	/*!
 	* \brief Requires some component from the system
 	*/
@@ -298,6 +370,46 @@ namespace Ndk
 		m_requiredAnyComponents.UnboundedSet(index);
 	}
 
+	/*!
+	* \brief Declares a component written by the system
+	*
+	* Systems which declared the components they read and write may be updated concurrently with other systems
+	*
+	* \see IsExclusive
+	*/
+
+	template<typename ComponentType>
+	void BaseSystem::Writes()
+	{
+		static_assert(std::is_base_of<BaseComponent, ComponentType>::value, "ComponentType is not a component");
+
+		WritesComponent(GetComponentIndex<ComponentType>());
+	}
+
+	/*!
+	* \brief Declares some components written by the system
+	*/
+
+	template<typename ComponentType1, typename ComponentType2, typename... Rest>
+	void BaseSystem::Writes()
+	{
+		Writes<ComponentType1>();
+		Writes<ComponentType2, Rest...>();
+	}
+
+	/*!
+	* \brief Declares a component written by the system by index
+	*
+	* \param index Index of the component
+	*
+	* \remark Accesses should be declared before the system is added to a world
+	*/
+
+	inline void BaseSystem::WritesComponent(ComponentIndex index)
+	{
+		m_writtenComponents.UnboundedSet(index);
+	}
+
 	/*!
 	* \brief Adds an entity to a system
 	*
@@ -7,6 +7,7 @@
 #ifndef NDK_COMPONENT_HPP
 #define NDK_COMPONENT_HPP
 
+#include <Nazara/Core/ConcurrentMemoryPool.hpp>
 #include <NDK/BaseComponent.hpp>
 
 namespace Ndk
@@ -24,6 +25,12 @@ namespace Ndk
 
 			template<unsigned int N>
 			static ComponentIndex RegisterComponent(const char (&name)[N]);
+
+			static void* operator new(std::size_t size);
+			static void operator delete(void* ptr, std::size_t size);
+
+		private:
+			static Nz::ConcurrentMemoryPool& GetMemoryPool();
 	};
 }
 
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Prerequisites.hpp
 
 #include <NDK/Algorithm.hpp>
+#include <new>
 #include <type_traits>
 
 namespace Ndk
@@ -13,6 +14,7 @@ namespace Ndk
 	* \brief NDK class that represents a component for an entity which interacts with a system
 	*
 	* \remark This class is meant to be derived as CRTP: "Component<Subtype>"
+	* \remark Components are allocated from a memory pool per component type, keeping components of the same type close in memory
 	*/
 
 	/*!
@@ -73,4 +75,51 @@ namespace Ndk
 		ComponentId id = BuildComponentId(name);
 		return RegisterComponent(id);
 	}
+
+	/*!
+	* \brief Allocates memory for a component from the memory pool of its type
+	* \return Pointer to the allocated memory
+	*
+	* \param size Size of the component
+	*
+	* \remark Types deriving from the component type (and thus having another size) are allocated normally
+	*/
+	template<typename ComponentType>
+	void* Component<ComponentType>::operator new(std::size_t size)
+	{
+		if (size != sizeof(ComponentType))
+			return ::operator new(size);
+
+		void* ptr = GetMemoryPool().Allocate();
+		if (!ptr)
+			throw std::bad_alloc();
+
+		return ptr;
+	}
+
+	/*!
+	* \brief Frees memory of a component allocated by operator new
+	*
+	* \param ptr Pointer to the component memory
+	* \param size Size of the component
+	*/
+	template<typename ComponentType>
+	void Component<ComponentType>::operator delete(void* ptr, std::size_t size)
+	{
+		if (!ptr)
+			return;
+
+		if (size != sizeof(ComponentType))
+			::operator delete(ptr);
+		else
+			GetMemoryPool().Free(ptr);
+	}
+
+	template<typename ComponentType>
+	Nz::ConcurrentMemoryPool& Component<ComponentType>::GetMemoryPool()
+	{
+		// The pool is never destroyed as components may be released after static destruction (in a global world for example)
+		static Nz::ConcurrentMemoryPool* pool = new Nz::ConcurrentMemoryPool(sizeof(ComponentType), 128);
+		return *pool;
+	}
 }
@@ -0,0 +1,55 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#pragma once
+
+#ifndef NDK_COMPONENTSTORAGE_HPP
+#define NDK_COMPONENTSTORAGE_HPP
+
+#include <NDK/Prerequisites.hpp>
+#include <vector>
+
+namespace Ndk
+{
+	class BaseComponent;
+
+	class ComponentStorage
+	{
+		public:
+			ComponentStorage() = default;
+			ComponentStorage(const ComponentStorage&) = delete;
+			ComponentStorage(ComponentStorage&&) noexcept = default;
+			~ComponentStorage() = default;
+
+			inline void Clear();
+
+			inline BaseComponent* Find(EntityId id) const;
+
+			inline BaseComponent& GetComponent(std::size_t index) const;
+			inline BaseComponent* const* GetComponents() const;
+			inline EntityId GetEntityId(std::size_t index) const;
+			inline const EntityId* GetEntityIds() const;
+			inline std::size_t GetSize() const;
+
+			inline bool Has(EntityId id) const;
+
+			inline void Insert(EntityId id, BaseComponent* component);
+
+			inline bool IsEmpty() const;
+
+			inline void Remove(EntityId id);
+
+			ComponentStorage& operator=(const ComponentStorage&) = delete;
+			ComponentStorage& operator=(ComponentStorage&&) noexcept = default;
+
+		private:
+			std::vector<BaseComponent*> m_components;
+			std::vector<EntityId> m_entities;
+			std::vector<Nz::UInt32> m_sparse; //< Entity id => packed index + 1 (zero means no component)
+	};
+}
+
+#include <NDK/ComponentStorage.inl>
+
+#endif // NDK_COMPONENTSTORAGE_HPP
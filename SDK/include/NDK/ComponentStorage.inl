@@ -0,0 +1,171 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Development Kit"
+// For conditions of distribution and use, see copyright notice in Prerequisites.hpp
+
+#include <Nazara/Core/Error.hpp>
+
+namespace Ndk
+{
+	/*!
+	* \ingroup NDK
+	* \class Ndk::ComponentStorage
+	* \brief NDK class that indexes every component of a type owned by the entities of a world
+	*
+	* This is a sparse set: components and their entity ids are kept packed in two arrays while a sparse array,
+	* indexed by entity id, gives the position of an entity component in the packed arrays.
+	* Iterating over the packed arrays visits every component of the type without going through the entities.
+	*
+	* \remark Removing a component moves the last component of the storage to its place
+	*/
+
+	/*!
+	* \brief Removes every component from the storage
+	*/
+	inline void ComponentStorage::Clear()
+	{
+		m_components.clear();
+		m_entities.clear();
+		m_sparse.clear();
+	}
+
+	/*!
+	* \brief Finds the component of an entity
+	* \return Pointer to the component or nullptr if the entity has no component in this storage
+	*
+	* \param id Identifier of the entity
+	*/
+	inline BaseComponent* ComponentStorage::Find(EntityId id) const
+	{
+		if (id >= m_sparse.size() || m_sparse[id] == 0)
+			return nullptr;
+
+		return m_components[m_sparse[id] - 1];
+	}
+
+	/*!
+	* \brief Gets a component by its packed index
+	* \return A reference to the component
+	*
+	* \param index Packed index of the component, must be lower than GetSize()
+	*/
+	inline BaseComponent& ComponentStorage::GetComponent(std::size_t index) const
+	{
+		NazaraAssert(index < m_components.size(), "Index out of range");
+
+		return *m_components[index];
+	}
+
+	/*!
+	* \brief Gets the packed array of components
+	* \return Pointer to the first of GetSize() components
+	*/
+	inline BaseComponent* const* ComponentStorage::GetComponents() const
+	{
+		return m_components.data();
+	}
+
+	/*!
+	* \brief Gets the entity owning a component by the packed index of the component
+	* \return Identifier of the entity
+	*
+	* \param index Packed index of the component, must be lower than GetSize()
+	*/
+	inline EntityId ComponentStorage::GetEntityId(std::size_t index) const
+	{
+		NazaraAssert(index < m_entities.size(), "Index out of range");
+
+		return m_entities[index];
+	}
+
+	/*!
+	* \brief Gets the packed array of entity ids
+	* \return Pointer to the first of GetSize() entity ids, in the same order as the components
+	*/
+	inline const EntityId* ComponentStorage::GetEntityIds() const
+	{
+		return m_entities.data();
+	}
+
+	/*!
+	* \brief Gets the number of components in the storage
+	* \return Component count
+	*/
+	inline std::size_t ComponentStorage::GetSize() const
+	{
+		return m_components.size();
+	}
+
+	/*!
+	* \brief Checks whether or not an entity has a component in this storage
+	* \return true If it is the case
+	*
+	* \param id Identifier of the entity
+	*/
+	inline bool ComponentStorage::Has(EntityId id) const
+	{
+		return id < m_sparse.size() && m_sparse[id] != 0;
+	}
+
+	/*!
+	* \brief Inserts the component of an entity
+	*
+	* \param id Identifier of the entity
+	* \param component Component owned by the entity
+	*
+	* \remark If the entity already has a component in the storage, it is replaced
+	*/
+	inline void ComponentStorage::Insert(EntityId id, BaseComponent* component)
+	{
+		NazaraAssert(component, "Invalid component");
+
+		if (id >= m_sparse.size())
+			m_sparse.resize(id + 1, 0);
+
+		if (m_sparse[id] != 0)
+		{
+			m_components[m_sparse[id] - 1] = component;
+			return;
+		}
+
+		m_components.push_back(component);
+		m_entities.push_back(id);
+		m_sparse[id] = static_cast<Nz::UInt32>(m_components.size());
+	}
+
+	/*!
+	* \brief Checks whether or not the storage is empty
+	* \return true If it is the case
+	*/
+	inline bool ComponentStorage::IsEmpty() const
+	{
+		return m_components.empty();
+	}
+
+	/*!
+	* \brief Removes the component of an entity
+	*
+	* \param id Identifier of the entity
+	*
+	* \remark If the entity has no component in the storage, nothing is done
+	*/
+	inline void ComponentStorage::Remove(EntityId id)
+	{
+		if (!Has(id))
+			return;
+
+		std::size_t index = m_sparse[id] - 1;
+		std::size_t lastIndex = m_components.size() - 1;
+
+		// Swap and pop idiom, keeping the arrays packed
+		if (index != lastIndex)
+		{
+			m_components[index] = m_components[lastIndex];
+			m_entities[index] = m_entities[lastIndex];
+			m_sparse[m_entities[index]] = static_cast<Nz::UInt32>(index + 1);
+		}
+
+		m_components.pop_back();
+		m_entities.pop_back();
+		m_sparse[id] = 0;
+	}
+}
@@ -47,6 +47,7 @@ namespace Ndk
 			inline bool DoesRequireRealTimeReflections() const;
 
 			inline void EnsureBoundingVolumesUpdate() const;
+			void EnsureRenderablesDataUpdate() const;
 			inline void EnsureTransformMatrixUpdate() const;
 
 			template<typename Func> void ForEachRenderable(const Func& func) const;
@@ -29,6 +29,8 @@ namespace Ndk
 
 			inline void Clear();
 
+			template<typename F> void ForEachParallel(const F& iterationFunc, std::size_t grainSize = 0) const;
+
 			inline bool Has(const Entity* entity) const;
 			inline bool Has(EntityId entity) const;
 
@@ -3,6 +3,8 @@
 // For conditions of distribution and use, see copyright notice in Prerequisites.hpp
 
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Parallel.hpp>
+#include <Nazara/Math/Algorithm.hpp>
 #include <algorithm>
 
 namespace Ndk
@@ -67,6 +69,39 @@ namespace Ndk
 		m_world = nullptr;
 	}
 
+	/*!
+	* \brief Executes a function on every entity of the set, spreading the work over the TaskScheduler workers
+	*
+	* The underlying bitset is split in chunks of whole 64 bits blocks, each task iterating over its own blocks.
+	* This function returns once every entity has been processed.
+	*
+	* \param iterationFunc Function to be called with a constant reference to the entity handle, must be safe to call concurrently for different entities
+	* \param grainSize Minimal number of entity ids handled by one task (rounded up to a multiple of 64), zero to let it be computed from the worker count
+	*
+	* \remark The set must not be modified during the iteration
+	*/
+	template<typename F>
+	void EntityList::ForEachParallel(const F& iterationFunc, std::size_t grainSize) const
+	{
+		constexpr std::size_t bitsPerBlock = Nz::Bitset<Nz::UInt64>::bitsPerBlock;
+
+		std::size_t blockGrainSize = (grainSize + bitsPerBlock - 1) / bitsPerBlock;
+		Nz::ParallelFor<std::size_t>(0, m_entityBits.GetBlockCount(), blockGrainSize, [&](std::size_t firstBlock, std::size_t lastBlock)
+		{
+			for (std::size_t i = firstBlock; i < lastBlock; ++i)
+			{
+				Nz::UInt64 block = m_entityBits.GetBlock(i);
+				while (block)
+				{
+					std::size_t entityId = i * bitsPerBlock + Nz::IntegralLog2Pot(block & -block);
+					block &= block - 1; //< Clear the lowest set bit
+
+					iterationFunc(*iterator(this, entityId));
+				}
+			}
+		});
+	}
+
 	/*!
 	* \brief Checks whether or not the EntityList contains the entity
 	* \return true If it is the case
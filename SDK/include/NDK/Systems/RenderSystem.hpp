@@ -9,6 +9,7 @@
 #define NDK_SYSTEMS_RENDERSYSTEM_HPP
 
 #include <Nazara/Graphics/AbstractBackground.hpp>
+#include <Nazara/Graphics/BasicRenderQueue.hpp>
 #include <Nazara/Graphics/CullingList.hpp>
 #include <Nazara/Graphics/DepthRenderTechnique.hpp>
 #include <Nazara/Renderer/RenderTexture.hpp>
@@ -20,6 +21,7 @@
 namespace Ndk
 {
 	class AbstractViewer;
+	class CameraComponent;
 
 	class NDK_API RenderSystem : public System<RenderSystem>
 	{
@@ -31,6 +33,7 @@ namespace Ndk
 			inline Nz::AbstractRenderTechnique& ChangeRenderTechnique(std::unique_ptr<Nz::AbstractRenderTechnique>&& renderTechnique);
 
 			inline void EnableCulling(bool enable);
+			inline void EnableParallelQueueBuilding(bool enable);
 
 			inline const Nz::BackgroundRef& GetDefaultBackground() const;
 			inline const Nz::Matrix4f& GetCoordinateSystemMatrix() const;
@@ -40,6 +43,7 @@ namespace Ndk
 			inline Nz::AbstractRenderTechnique& GetRenderTechnique() const;
 
 			inline bool IsCullingEnabled() const;
+			inline bool IsParallelQueueBuildingEnabled() const;
 
 			inline void SetDefaultBackground(Nz::BackgroundRef background);
 			inline void SetGlobalForward(const Nz::Vector3f& direction);
@@ -55,11 +59,24 @@ namespace Ndk
 			void OnEntityValidation(Entity* entity, bool justAdded) override;
 			void OnUpdate(float elapsedTime) override;
 
+			void BuildCameraRenderQueues();
+			void Render(CameraComponent& camComponent);
+
 			void UpdateDynamicReflections();
 			void UpdateDirectionalShadowMaps(const Nz::AbstractViewer& viewer);
 			void UpdatePointSpotShadowMaps();
 
+			struct CameraRenderQueue
+			{
+				Nz::BasicRenderQueue renderQueue;
+				std::vector<const GraphicsComponent*> fullyVisibleResults; //< Kept across frames, culling results only live until the next culling
+				std::vector<const GraphicsComponent*> partiallyVisibleResults;
+				EntityHandle camera;
+				bool invalidated;
+			};
+
 			std::unique_ptr<Nz::AbstractRenderTechnique> m_renderTechnique;
+			std::vector<CameraRenderQueue> m_cameraRenderQueues;
 			std::vector<GraphicsComponentCullingList::VolumeEntry> m_volumeEntries;
 			std::vector<EntityHandle> m_cameras;
 			EntityList m_drawables;
@@ -76,6 +93,7 @@ namespace Ndk
 			bool m_coordinateSystemInvalidated;
 			bool m_forceRenderQueueInvalidation;
 			bool m_isCullingEnabled;
+			bool m_isParallelQueueBuildingEnabled;
 	};
 }
 
@@ -48,6 +48,23 @@ namespace Ndk
 		m_isCullingEnabled = enable;
 	}
 
+	/*!
+	* \brief Enables/disables parallel render queue building (disabled by default)
+	*
+	* When enabled, the render queue of every camera is filled and sorted as a separate task of the TaskScheduler,
+	* culling and drawing still happening on the updating thread.
+	*
+	* \param enable Whether to enable or disable parallel render queue building
+	*
+	* \remark Renderables are added to the render queues from the task scheduler threads, anything they build lazily must be done in InstancedRenderable::EnsureRenderQueueDataUpdated, which is called on the updating thread
+	*
+	* \see IsParallelQueueBuildingEnabled
+	*/
+	inline void RenderSystem::EnableParallelQueueBuilding(bool enable)
+	{
+		m_isParallelQueueBuildingEnabled = enable;
+	}
+
 	/*!
 	* \brief Gets the background used for rendering
 	* \return A reference to the background
@@ -119,6 +136,17 @@ namespace Ndk
 		return m_isCullingEnabled;
 	}
 
+	/*!
+	* \brief Query if render queues are built in parallel (disabled by default)
+	* \return True if parallel render queue building is enabled, false otherwise
+	*
+	* \see EnableParallelQueueBuilding
+	*/
+	inline bool RenderSystem::IsParallelQueueBuildingEnabled() const
+	{
+		return m_isParallelQueueBuildingEnabled;
+	}
+
 	/*!
 	* \brief Sets the background used for rendering
 	*
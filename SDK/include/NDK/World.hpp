@@ -9,10 +9,14 @@
 
 #include <Nazara/Core/Bitset.hpp>
 #include <Nazara/Core/HandledObject.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <NDK/ComponentStorage.hpp>
 #include <NDK/Entity.hpp>
 #include <NDK/EntityList.hpp>
 #include <NDK/System.hpp>
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -51,6 +55,9 @@ namespace Ndk
 			inline void DisableProfiler();
 			inline void EnableProfiler(bool enable = true);
 
+			template<typename ComponentType, typename... Rest, typename F> void ForEachComponent(const F& iterationFunc);
+			template<typename ComponentType, typename... Rest, typename F> void ForEachComponentParallel(const F& iterationFunc, std::size_t grainSize = 0);
+
 			template<typename F> void ForEachSystem(const F& iterationFunc);
 			template<typename F> void ForEachSystem(const F& iterationFunc) const;
 
@@ -88,16 +95,27 @@ namespace Ndk
 
 			struct ProfilerData
 			{
+				Nz::UInt64 criticalPathTime = 0; //< Sum of the longest chains of system updates which had to wait for each other
 				Nz::UInt64 refreshTime = 0;
+				Nz::UInt64 systemsUpdateTime = 0; //< Wall time of system updates, lower than the sum of updateTime when systems are updated concurrently
 				std::vector<Nz::UInt64> updateTime;
 				std::size_t updateCount = 0;
 			};
 
 		private:
+			Nz::UInt64 ComputeCriticalPath(std::size_t firstSystem, std::size_t lastSystem);
+
+			inline ComponentStorage& GetComponentStorage(ComponentIndex index);
+
+			inline bool HasComponent(EntityId id, ComponentIndex index) const;
+
 			inline void Invalidate();
 			inline void Invalidate(EntityId id);
 			inline void InvalidateSystemOrder();
 			void ReorderSystems();
+			void SpawnSystemUpdate(Nz::TaskScheduler::Counter& counter, std::size_t systemIndex, float elapsedTime);
+			void UpdateSystem(std::size_t systemIndex, float elapsedTime);
+			void UpdateSystems(float elapsedTime);
 
 			struct DoubleBitset
 			{
@@ -105,6 +123,14 @@ namespace Ndk
 				Nz::Bitset<Nz::UInt64> back;
 			};
 
+			struct SystemDependencies
+			{
+				std::vector<std::size_t> dependents; //< Ordered systems waiting for this one
+				unsigned int dependencyCount = 0;
+				Nz::UInt64 longestPathTime = 0;
+				Nz::UInt64 updateTime = 0;
+			};
+
 			struct EntityBlock
 			{
 				EntityBlock(Entity&& e) :
@@ -119,16 +145,20 @@ namespace Ndk
 				EntityHandle handle;
 			};
 
+			std::vector<ComponentStorage> m_componentStorages;
 			std::vector<std::unique_ptr<BaseSystem>> m_systems;
 			std::vector<BaseSystem*> m_orderedSystems;
 			std::vector<EntityBlock> m_entities;
 			std::vector<EntityBlock*> m_entityBlocks;
 			std::vector<std::unique_ptr<EntityBlock>> m_waitingEntities;
+			std::vector<SystemDependencies> m_systemDependencies;
+			std::unique_ptr<std::atomic<unsigned int>[]> m_pendingSystemDependencies;
 			EntityList m_aliveEntities;
 			ProfilerData m_profilerData;
 			DoubleBitset m_dirtyEntities;
 			Nz::Bitset<Nz::UInt64> m_freeEntityIds;
 			DoubleBitset m_killedEntities;
+			mutable Nz::Mutex m_killedEntitiesMutex;
 			bool m_orderedSystemsUpdated;
 			bool m_isProfilerEnabled;
 	};
@@ -4,6 +4,9 @@
 
 #include <NDK/World.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Parallel.hpp>
+#include <iterator>
 #include <type_traits>
 
 namespace Ndk
@@ -133,6 +136,84 @@ namespace Ndk
 		}
 	}
 
+	/*!
+	* \brief Executes a function on every entity owning a set of components
+	*
+	* Calls iterationFunc(EntityId, ComponentType&, Rest&...) for every entity owning all the components.
+	* Components of the first type are visited in the packed order of their storage, which is faster than going through
+	* an entity list when there are a lot of them, so the first type should be the least common one.
+	*
+	* \param iterationFunc Function to be called
+	*
+	* \remark Entities are visited regardless of their state (disabled entities or components removed during this update are visited as well)
+	* \remark iterationFunc must not add or remove components of the iterated types
+	*/
+	template<typename ComponentType, typename... Rest, typename F>
+	void World::ForEachComponent(const F& iterationFunc)
+	{
+		static_assert(std::is_base_of<BaseComponent, ComponentType>::value, "ComponentType is not a component");
+
+		ComponentIndex index = GetComponentIndex<ComponentType>();
+		if (index >= m_componentStorages.size())
+			return;
+
+		const ComponentStorage& storage = m_componentStorages[index];
+		BaseComponent* const* components = storage.GetComponents();
+		const EntityId* entityIds = storage.GetEntityIds();
+
+		std::size_t componentCount = storage.GetSize();
+		for (std::size_t i = 0; i < componentCount; ++i)
+		{
+			EntityId id = entityIds[i];
+
+			bool hasComponents[] = { true, HasComponent(id, GetComponentIndex<Rest>())... };
+			if (std::find(std::begin(hasComponents), std::end(hasComponents), false) != std::end(hasComponents))
+				continue;
+
+			iterationFunc(id, static_cast<ComponentType&>(*components[i]), static_cast<Rest&>(*m_componentStorages[GetComponentIndex<Rest>()].Find(id))...);
+		}
+	}
+
+	/*!
+	* \brief Executes a function on every entity owning a set of components, spreading the work over the TaskScheduler workers
+	*
+	* Works like ForEachComponent, except the packed storage of the first type is split in contiguous chunks, each of them being handled by a task.
+	*
+	* \param iterationFunc Function to be called, must be safe to call concurrently for different entities
+	* \param grainSize Maximum number of components handled by one task, zero to let it be computed from the worker count
+	*
+	* \remark iterationFunc must not add or remove components, nor create or destroy entities
+	*
+	* \see ForEachComponent
+	*/
+	template<typename ComponentType, typename... Rest, typename F>
+	void World::ForEachComponentParallel(const F& iterationFunc, std::size_t grainSize)
+	{
+		static_assert(std::is_base_of<BaseComponent, ComponentType>::value, "ComponentType is not a component");
+
+		ComponentIndex index = GetComponentIndex<ComponentType>();
+		if (index >= m_componentStorages.size())
+			return;
+
+		const ComponentStorage& storage = m_componentStorages[index];
+		BaseComponent* const* components = storage.GetComponents();
+		const EntityId* entityIds = storage.GetEntityIds();
+
+		Nz::ParallelFor<std::size_t>(0, storage.GetSize(), grainSize, [&](std::size_t first, std::size_t last)
+		{
+			for (std::size_t i = first; i < last; ++i)
+			{
+				EntityId id = entityIds[i];
+
+				bool hasComponents[] = { true, HasComponent(id, GetComponentIndex<Rest>())... };
+				if (std::find(std::begin(hasComponents), std::end(hasComponents), false) != std::end(hasComponents))
+					continue;
+
+				iterationFunc(id, static_cast<ComponentType&>(*components[i]), static_cast<Rest&>(*m_componentStorages[GetComponentIndex<Rest>()].Find(id))...);
+			}
+		});
+	}
+
 	/*!
 	* \brief Executes a function on every present system
 	*
@@ -304,11 +385,15 @@ namespace Ndk
 	*
 	* \remark If the entity pointer is invalid, nothing is done
 	* \remark For safety, entities are not killed until the next world update
+	* \remark This can be called from systems updated concurrently
 	*/
 	inline void World::KillEntity(Entity* entity)
 	{
 		if (IsEntityValid(entity))
+		{
+			Nz::LockGuard lock(m_killedEntitiesMutex);
 			m_killedEntities.front.UnboundedSet(entity->GetId(), true);
+		}
 	}
 
 	/*!
@@ -343,6 +428,7 @@ namespace Ndk
 	*/
 	inline bool World::IsEntityDying(EntityId id) const
 	{
+		Nz::LockGuard lock(m_killedEntitiesMutex);
 		return m_killedEntities.front.UnboundedTest(id);
 	}
 
@@ -415,7 +501,9 @@ namespace Ndk
 	*/
 	inline void World::ResetProfiler()
 	{
+		m_profilerData.criticalPathTime = 0;
 		m_profilerData.refreshTime = 0;
+		m_profilerData.systemsUpdateTime = 0;
 		m_profilerData.updateCount = 0;
 		std::fill(m_profilerData.updateTime.begin(), m_profilerData.updateTime.end(), 0);
 	}
@@ -440,6 +528,7 @@ namespace Ndk
 	inline World& World::operator=(World&& world) noexcept
 	{
 		m_aliveEntities         = std::move(world.m_aliveEntities);
+		m_componentStorages     = std::move(world.m_componentStorages);
 		m_dirtyEntities         = std::move(world.m_dirtyEntities);
 		m_entityBlocks          = std::move(world.m_entityBlocks);
 		m_freeEntityIds         = std::move(world.m_freeEntityIds);
@@ -462,9 +551,25 @@ namespace Ndk
 			if (systemPtr)
 				systemPtr->SetWorld(this);
 
+		m_pendingSystemDependencies = std::move(world.m_pendingSystemDependencies);
+		m_systemDependencies = std::move(world.m_systemDependencies);
+
 		return *this;
 	}
 
+	inline ComponentStorage& World::GetComponentStorage(ComponentIndex index)
+	{
+		if (index >= m_componentStorages.size())
+			m_componentStorages.resize(index + 1);
+
+		return m_componentStorages[index];
+	}
+
+	inline bool World::HasComponent(EntityId id, ComponentIndex index) const
+	{
+		return index < m_componentStorages.size() && m_componentStorages[index].Has(id);
+	}
+
 	inline void World::Invalidate()
 	{
 		m_dirtyEntities.front.Resize(m_entityBlocks.size(), false);
@@ -4,6 +4,7 @@
 
 #include <NDK/Application.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <regex>
 
 #ifndef NDK_SERVER
@@ -76,6 +77,8 @@ namespace Ndk
 
 	/*!
 	* \brief Runs the application by updating worlds, taking care about windows, ...
+	*
+	* Tasks queued for the main thread (see Nz::TaskScheduler::AddMainThreadTask) are executed before the worlds are updated
 	*/
 	bool Application::Run()
 	{
@@ -109,6 +112,9 @@ namespace Ndk
 
 		m_updateTime = m_updateClock.Restart() / 1'000'000.f;
 
+		// Completion callbacks of asynchronous tasks (such as resource loadings)
+		Nz::TaskScheduler::RunMainThreadTasks();
+
 		for (World& world : m_worlds)
 			world.Update(m_updateTime);
 
@@ -25,6 +25,25 @@ namespace Ndk
 			entity->UnregisterSystem(m_systemIndex);
 	}
 
+	/*!
+	* \brief Checks whether this system and another one can't be updated concurrently
+	* \return true If one of them is exclusive or writes a component the other one reads or writes
+	*
+	* \param system Other system
+	*
+	* \see IsExclusive
+	*/
+
+	bool BaseSystem::ConflictsWith(const BaseSystem& system) const
+	{
+		if (IsExclusive() || system.IsExclusive())
+			return true;
+
+		return m_writtenComponents.Intersects(system.m_readComponents) ||
+		       m_writtenComponents.Intersects(system.m_writtenComponents) ||
+		       m_readComponents.Intersects(system.m_writtenComponents);
+	}
+
 	/*!
 	* \brief Checks whether the key of the entity matches the lock of the system
 	* \return true If it is the case
@@ -62,7 +62,7 @@ namespace Ndk
 					object.dataUpdated = true;
 				}
 
-				object.renderable->AddToRenderQueue(renderQueue, object.data, m_scissorRect);
+				object.renderable->AddToRenderQueueByCulling(frustum, renderQueue, object.data, m_scissorRect);
 			}
 		}
 	}
@@ -102,6 +102,36 @@ namespace Ndk
 		entry.renderableSkinChangeSlot.Connect(entry.renderable->OnInstancedRenderableSkinChange, this, &GraphicsComponent::OnInstancedRenderableSkinChange);
 	}
 
+	/*!
+	* \brief Ensures every lazily updated data used by AddToRenderQueue is up to date
+	*
+	* This includes the bounding volumes, the transformation matrix, the data of every renderable (and what they build lazily when added to a render queue) and the pipeline of their materials.
+	* Once done, AddToRenderQueue and AddToRenderQueueByCulling only read the component, they can then be called concurrently until it gets invalidated.
+	*/
+	void GraphicsComponent::EnsureRenderablesDataUpdate() const
+	{
+		EnsureBoundingVolumesUpdate();
+		EnsureTransformMatrixUpdate();
+
+		for (const Renderable& object : m_renderables)
+		{
+			if (!object.dataUpdated)
+			{
+				object.renderable->UpdateData(&object.data);
+				object.dataUpdated = true;
+			}
+
+			object.renderable->EnsureRenderQueueDataUpdated();
+
+			std::size_t materialCount = object.renderable->GetMaterialCount();
+			for (std::size_t i = 0; i < materialCount; ++i)
+			{
+				if (const Nz::MaterialRef& material = object.renderable->GetMaterial(i))
+					material->EnsurePipelineUpdate();
+			}
+		}
+	}
+
 	void GraphicsComponent::InvalidateRenderableData(const Nz::InstancedRenderable* renderable , Nz::UInt32 flags, std::size_t index)
 	{
 		NazaraAssert(index < m_renderables.size(), "Invalid renderable index");
@@ -64,6 +64,8 @@ namespace Ndk
 		m_componentBits.UnboundedSet(index);
 		m_removedComponentBits.UnboundedReset(index);
 
+		m_world->GetComponentStorage(index).Insert(m_id, m_components[index].get());
+
 		Invalidate();
 
 		// We get the new component and we alert other existing components of the new one
@@ -122,6 +124,8 @@ namespace Ndk
 		m_componentBits.Reset(index);
 		m_removedComponentBits.UnboundedReset(index);
 
+		m_world->GetComponentStorage(index).Remove(m_id);
+
 		component->SetEntity(nullptr);
 
 		return component;
@@ -224,6 +228,9 @@ namespace Ndk
 		m_systemBits.Clear();
 
 		// Destroy components
+		for (std::size_t i = m_componentBits.FindFirst(); i != m_componentBits.npos; i = m_componentBits.FindNext(i))
+			m_world->GetComponentStorage(static_cast<ComponentIndex>(i)).Remove(m_id);
+
 		m_components.clear();
 		m_componentBits.Reset();
 
@@ -10,6 +10,7 @@ namespace Ndk
 	LifetimeSystem::LifetimeSystem()
 	{
 		Requires<LifetimeComponent>();
+		Writes<LifetimeComponent>();
 	}
 
 	void LifetimeSystem::OnUpdate(float elapsedTime)
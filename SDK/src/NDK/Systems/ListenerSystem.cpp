@@ -24,6 +24,8 @@ namespace Ndk
 	ListenerSystem::ListenerSystem()
 	{
 		Requires<ListenerComponent, NodeComponent>();
+		Reads<ListenerComponent>();
+		Writes<NodeComponent>(); //< Getting the global position of a node may update it
 		SetUpdateOrder(100); //< Update last, after every movement is done
 	}
 
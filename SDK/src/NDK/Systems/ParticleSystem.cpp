@@ -3,6 +3,8 @@
 // For conditions of distribution and use, see copyright notice in Prerequisites.hpp
 
 #include <NDK/Systems/ParticleSystem.hpp>
+#include <NDK/Components/NodeComponent.hpp>
+#include <NDK/Components/ParticleEmitterComponent.hpp>
 #include <NDK/Components/ParticleGroupComponent.hpp>
 
 namespace Ndk
@@ -22,6 +24,8 @@ namespace Ndk
 	ParticleSystem::ParticleSystem()
 	{
 		Requires<ParticleGroupComponent>();
+		Writes<ParticleEmitterComponent, ParticleGroupComponent>(); //< Groups make their emitters emit
+		Writes<NodeComponent>(); //< Emitter setup callbacks usually read the emitter node, which may update it
 	}
 
 	/*!
@@ -3,12 +3,16 @@
 // For conditions of distribution and use, see copyright notice in Prerequisites.hpp
 
 #include <NDK/Systems/PhysicsSystem2D.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
 #include <Nazara/Physics2D/RigidBody2D.hpp>
 #include <NDK/World.hpp>
 #include <NDK/Components/CollisionComponent2D.hpp>
 #include <NDK/Components/NodeComponent.hpp>
 #include <NDK/Components/PhysicsComponent2D.hpp>
 #include <NDK/Components/PhysicsComponent3D.hpp>
+#include <algorithm>
+#include <vector>
 
 namespace Ndk
 {
@@ -30,6 +34,7 @@ namespace Ndk
 		Requires<NodeComponent>();
 		RequiresAny<CollisionComponent2D, PhysicsComponent2D>();
 		Excludes<PhysicsComponent3D>();
+		Writes<CollisionComponent2D, NodeComponent, PhysicsComponent2D>();
 	}
 
 	void PhysicsSystem2D::CreatePhysWorld() const
@@ -218,15 +223,41 @@ namespace Ndk
 
 		m_physWorld->Step(elapsedTime);
 
-		for (const Ndk::EntityHandle& entity : m_dynamicObjects)
+		auto SyncNode = [](PhysicsComponent2D& phys, NodeComponent& node)
 		{
-			NodeComponent& node = entity->GetComponent<NodeComponent>();
-			PhysicsComponent2D& phys = entity->GetComponent<PhysicsComponent2D>();
-
 			Nz::RigidBody2D* body = phys.GetRigidBody();
 			node.SetRotation(body->GetRotation(), Nz::CoordSys_Global);
 			node.SetPosition(Nz::Vector3f(body->GetPosition(), node.GetPosition(Nz::CoordSys_Global).z), Nz::CoordSys_Global);
-		}
+		};
+
+		struct HierarchyEntry
+		{
+			EntityId id;
+			NodeComponent* node;
+			PhysicsComponent2D* phys;
+		};
+
+		// Nodes which are part of a hierarchy can't be updated concurrently, handle them afterwards
+		Nz::Mutex hierarchyMutex;
+		std::vector<HierarchyEntry> hierarchyEntries;
+
+		GetWorld().ForEachComponentParallel<PhysicsComponent2D, NodeComponent>([&](EntityId id, PhysicsComponent2D& phys, NodeComponent& node)
+		{
+			if (!m_dynamicObjects.Has(id))
+				return;
+
+			if (node.GetParent() || node.HasChilds())
+			{
+				Nz::LockGuard lock(hierarchyMutex);
+				hierarchyEntries.push_back({id, &node, &phys});
+			}
+			else
+				SyncNode(phys, node);
+		});
+
+		std::sort(hierarchyEntries.begin(), hierarchyEntries.end(), [](const HierarchyEntry& lhs, const HierarchyEntry& rhs) { return lhs.id < rhs.id; });
+		for (const HierarchyEntry& entry : hierarchyEntries)
+			SyncNode(*entry.phys, *entry.node);
 
 		float invElapsedTime = 1.f / elapsedTime;
 		for (const Ndk::EntityHandle& entity : m_staticObjects)
@@ -3,11 +3,16 @@
 // For conditions of distribution and use, see copyright notice in Prerequisites.hpp
 
 #include <NDK/Systems/PhysicsSystem3D.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
 #include <Nazara/Physics3D/RigidBody3D.hpp>
 #include <NDK/Components/CollisionComponent3D.hpp>
 #include <NDK/Components/NodeComponent.hpp>
 #include <NDK/Components/PhysicsComponent2D.hpp>
 #include <NDK/Components/PhysicsComponent3D.hpp>
+#include <NDK/World.hpp>
+#include <algorithm>
+#include <vector>
 
 namespace Ndk
 {
@@ -29,6 +34,7 @@ namespace Ndk
 		Requires<NodeComponent>();
 		RequiresAny<CollisionComponent3D, PhysicsComponent3D>();
 		Excludes<PhysicsComponent2D>();
+		Writes<CollisionComponent3D, NodeComponent, PhysicsComponent3D>();
 	}
 
 	void PhysicsSystem3D::CreatePhysWorld() const
@@ -91,15 +97,41 @@ namespace Ndk
 
 		m_world->Step(elapsedTime);
 
-		for (const Ndk::EntityHandle& entity : m_dynamicObjects)
+		auto SyncNode = [](PhysicsComponent3D& phys, NodeComponent& node)
 		{
-			NodeComponent& node = entity->GetComponent<NodeComponent>();
-			PhysicsComponent3D& phys = entity->GetComponent<PhysicsComponent3D>();
-
 			Nz::RigidBody3D* physObj = phys.GetRigidBody();
 			node.SetRotation(physObj->GetRotation(), Nz::CoordSys_Global);
 			node.SetPosition(physObj->GetPosition(), Nz::CoordSys_Global);
-		}
+		};
+
+		struct HierarchyEntry
+		{
+			EntityId id;
+			NodeComponent* node;
+			PhysicsComponent3D* phys;
+		};
+
+		// Nodes which are part of a hierarchy can't be updated concurrently, handle them afterwards
+		Nz::Mutex hierarchyMutex;
+		std::vector<HierarchyEntry> hierarchyEntries;
+
+		BaseSystem::GetWorld().ForEachComponentParallel<PhysicsComponent3D, NodeComponent>([&](EntityId id, PhysicsComponent3D& phys, NodeComponent& node)
+		{
+			if (!m_dynamicObjects.Has(id))
+				return;
+
+			if (node.GetParent() || node.HasChilds())
+			{
+				Nz::LockGuard lock(hierarchyMutex);
+				hierarchyEntries.push_back({id, &node, &phys});
+			}
+			else
+				SyncNode(phys, node);
+		});
+
+		std::sort(hierarchyEntries.begin(), hierarchyEntries.end(), [](const HierarchyEntry& lhs, const HierarchyEntry& rhs) { return lhs.id < rhs.id; });
+		for (const HierarchyEntry& entry : hierarchyEntries)
+			SyncNode(*entry.phys, *entry.node);
 
 		float invElapsedTime = 1.f / elapsedTime;
 		for (const Ndk::EntityHandle& entity : m_staticObjects)
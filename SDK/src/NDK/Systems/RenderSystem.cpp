@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Prerequisites.hpp
 
 #include <NDK/Systems/RenderSystem.hpp>
+#include <Nazara/Core/Parallel.hpp>
 #include <Nazara/Graphics/ColorBackground.hpp>
 #include <Nazara/Graphics/ForwardRenderTechnique.hpp>
 #include <Nazara/Graphics/SceneData.hpp>
@@ -36,10 +37,13 @@ namespace Ndk
 	m_coordinateSystemMatrix(Nz::Matrix4f::Identity()),
 	m_coordinateSystemInvalidated(true),
 	m_forceRenderQueueInvalidation(false),
-	m_isCullingEnabled(true)
+	m_isCullingEnabled(true),
+	m_isParallelQueueBuildingEnabled(false)
 	{
 		ChangeRenderTechnique<Nz::ForwardRenderTechnique>();
 		SetDefaultBackground(Nz::ColorBackground::New());
+		m_drawableCulling.EnableBoxTree(true);
+
 		SetUpdateOrder(100); //< Render last, after every movement is done
 		SetMaximumUpdateRate(0.f);  //< We don't want any rate limit
 	}
@@ -86,6 +90,8 @@ namespace Ndk
 			{
 				return handle1->GetComponent<CameraComponent>().GetLayer() < handle2->GetComponent<CameraComponent>().GetLayer();
 			});
+
+			m_forceRenderQueueInvalidation = true; //< Camera render queues are indexed by camera position
 		}
 		else
 		{
@@ -94,6 +100,7 @@ namespace Ndk
 				if (it->GetObject() == entity)
 				{
 					m_cameras.erase(it);
+					m_forceRenderQueueInvalidation = true; //< Camera render queues are indexed by camera position
 					break;
 				}
 			}
@@ -190,20 +197,118 @@ namespace Ndk
 		UpdateDynamicReflections();
 		UpdatePointSpotShadowMaps();
 
-		for (const Ndk::EntityHandle& camera : m_cameras)
+		// To make sure the bounding volumes used by the culling list is updated
+		for (const Ndk::EntityHandle& drawable : m_drawables)
 		{
-			CameraComponent& camComponent = camera->GetComponent<CameraComponent>();
+			GraphicsComponent& graphicsComponent = drawable->GetComponent<GraphicsComponent>();
+			graphicsComponent.EnsureBoundingVolumesUpdate();
+		}
 
-			//UpdateDirectionalShadowMaps(camComponent);
+		if (m_isParallelQueueBuildingEnabled)
+		{
+			BuildCameraRenderQueues();
 
-			Nz::AbstractRenderQueue* renderQueue = m_renderTechnique->GetRenderQueue();
+			for (std::size_t i = 0; i < m_cameras.size(); ++i)
+			{
+				CameraComponent& camComponent = m_cameras[i]->GetComponent<CameraComponent>();
 
-			// To make sure the bounding volumes used by the culling list is updated
-			for (const Ndk::EntityHandle& drawable : m_drawables)
+				// The technique queue is shared by every camera, it has to be refilled each time
+				Nz::AbstractRenderQueue* renderQueue = m_renderTechnique->GetRenderQueue();
+				renderQueue->Clear();
+
+				m_cameraRenderQueues[i].renderQueue.AddToRenderQueue(renderQueue);
+
+				// Lights and particle groups are not thread-safe (lazily updated nodes, user renderers), they're added from this thread
+				for (const Ndk::EntityHandle& light : m_lights)
+				{
+					LightComponent& lightComponent = light->GetComponent<LightComponent>();
+					NodeComponent& lightNode = light->GetComponent<NodeComponent>();
+
+					lightComponent.AddToRenderQueue(renderQueue, Nz::Matrix4f::ConcatenateAffine(m_coordinateSystemMatrix, lightNode.GetTransformMatrix()));
+				}
+
+				for (const Ndk::EntityHandle& particleGroup : m_particleGroups)
+				{
+					ParticleGroupComponent& groupComponent = particleGroup->GetComponent<ParticleGroupComponent>();
+
+					groupComponent.AddToRenderQueue(renderQueue, Nz::Matrix4f::Identity()); //< ParticleGroup doesn't use any transform matrix (yet)
+				}
+
+				Render(camComponent);
+			}
+		}
+		else
+		{
+			for (const Ndk::EntityHandle& camera : m_cameras)
 			{
-				GraphicsComponent& graphicsComponent = drawable->GetComponent<GraphicsComponent>();
-				graphicsComponent.EnsureBoundingVolumesUpdate();
+				CameraComponent& camComponent = camera->GetComponent<CameraComponent>();
+
+				//UpdateDirectionalShadowMaps(camComponent);
+
+				Nz::AbstractRenderQueue* renderQueue = m_renderTechnique->GetRenderQueue();
+
+				bool forceInvalidation = false;
+
+				const Nz::Frustumf& frustum = camComponent.GetFrustum();
+
+				std::size_t visibilityHash;
+				if (m_isCullingEnabled)
+					visibilityHash = m_drawableCulling.Cull(frustum, &forceInvalidation);
+				else
+					visibilityHash = m_drawableCulling.FillWithAllEntries(&forceInvalidation);
+
+				// Always regenerate renderqueue if particle groups are present for now (FIXME)
+				if (!m_lights.empty() || !m_particleGroups.empty())
+					forceInvalidation = true;
+
+				if (camComponent.UpdateVisibility(visibilityHash) || m_forceRenderQueueInvalidation || forceInvalidation)
+				{
+					renderQueue->Clear();
+					for (const GraphicsComponent* gfxComponent : m_drawableCulling.GetFullyVisibleResults())
+						gfxComponent->AddToRenderQueue(renderQueue);
+
+					for (const GraphicsComponent* gfxComponent : m_drawableCulling.GetPartiallyVisibleResults())
+						gfxComponent->AddToRenderQueueByCulling(frustum, renderQueue);
+
+					for (const Ndk::EntityHandle& light : m_lights)
+					{
+						LightComponent& lightComponent = light->GetComponent<LightComponent>();
+						NodeComponent& lightNode = light->GetComponent<NodeComponent>();
+
+						///TODO: Cache somehow?
+						lightComponent.AddToRenderQueue(renderQueue, Nz::Matrix4f::ConcatenateAffine(m_coordinateSystemMatrix, lightNode.GetTransformMatrix()));
+					}
+
+					for (const Ndk::EntityHandle& particleGroup : m_particleGroups)
+					{
+						ParticleGroupComponent& groupComponent = particleGroup->GetComponent<ParticleGroupComponent>();
+
+						groupComponent.AddToRenderQueue(renderQueue, Nz::Matrix4f::Identity()); //< ParticleGroup doesn't use any transform matrix (yet)
+					}
+
+					m_forceRenderQueueInvalidation = false;
+				}
+
+				Render(camComponent);
 			}
+		}
+	}
+
+	/*!
+	* \brief Builds the render queue of every camera, one task per camera
+	*
+	* Culling and every lazy update (cameras, graphics components, materials) happen on the calling thread,
+	* the visible components are then added to a render queue per camera, which gets sorted, from the task scheduler threads.
+	*/
+
+	void RenderSystem::BuildCameraRenderQueues()
+	{
+		m_cameraRenderQueues.resize(m_cameras.size());
+
+		for (std::size_t i = 0; i < m_cameras.size(); ++i)
+		{
+			CameraComponent& camComponent = m_cameras[i]->GetComponent<CameraComponent>();
+			CameraRenderQueue& cameraQueue = m_cameraRenderQueues[i];
 
 			bool forceInvalidation = false;
 
@@ -219,48 +324,80 @@ namespace Ndk
 			if (!m_lights.empty() || !m_particleGroups.empty())
 				forceInvalidation = true;
 
-			if (camComponent.UpdateVisibility(visibilityHash) || m_forceRenderQueueInvalidation || forceInvalidation)
+			// A queue built for another camera (cameras got added, removed or sorted) cannot be reused
+			if (cameraQueue.camera != m_cameras[i])
 			{
-				renderQueue->Clear();
-				for (const GraphicsComponent* gfxComponent : m_drawableCulling.GetFullyVisibleResults())
-					gfxComponent->AddToRenderQueue(renderQueue);
+				cameraQueue.camera = m_cameras[i];
+				forceInvalidation = true;
+			}
 
-				for (const GraphicsComponent* gfxComponent : m_drawableCulling.GetPartiallyVisibleResults())
-					gfxComponent->AddToRenderQueueByCulling(frustum, renderQueue);
+			cameraQueue.invalidated = camComponent.UpdateVisibility(visibilityHash) || m_forceRenderQueueInvalidation || forceInvalidation;
+			if (!cameraQueue.invalidated)
+				continue;
 
-				for (const Ndk::EntityHandle& light : m_lights)
-				{
-					LightComponent& lightComponent = light->GetComponent<LightComponent>();
-					NodeComponent& lightNode = light->GetComponent<NodeComponent>();
+			// Culling results are overwritten by the next camera
+			const GraphicsComponentCullingList::ResultContainer& fullyVisibleResults = m_drawableCulling.GetFullyVisibleResults();
+			const GraphicsComponentCullingList::ResultContainer& partiallyVisibleResults = m_drawableCulling.GetPartiallyVisibleResults();
+			cameraQueue.fullyVisibleResults.assign(fullyVisibleResults.begin(), fullyVisibleResults.end());
+			cameraQueue.partiallyVisibleResults.assign(partiallyVisibleResults.begin(), partiallyVisibleResults.end());
 
-					///TODO: Cache somehow?
-					lightComponent.AddToRenderQueue(renderQueue, Nz::Matrix4f::ConcatenateAffine(m_coordinateSystemMatrix, lightNode.GetTransformMatrix()));
-				}
+			for (const GraphicsComponent* gfxComponent : cameraQueue.fullyVisibleResults)
+				gfxComponent->EnsureRenderablesDataUpdate();
 
-				for (const Ndk::EntityHandle& particleGroup : m_particleGroups)
-				{
-					ParticleGroupComponent& groupComponent = particleGroup->GetComponent<ParticleGroupComponent>();
+			for (const GraphicsComponent* gfxComponent : cameraQueue.partiallyVisibleResults)
+				gfxComponent->EnsureRenderablesDataUpdate();
 
-					groupComponent.AddToRenderQueue(renderQueue, Nz::Matrix4f::Identity()); //< ParticleGroup doesn't use any transform matrix (yet)
-				}
+			// Used by the render queue sort
+			camComponent.GetEyePosition();
+		}
+
+		m_forceRenderQueueInvalidation = false;
+
+		Nz::ParallelFor<std::size_t>(0, m_cameraRenderQueues.size(), 1, [&](std::size_t firstCamera, std::size_t lastCamera)
+		{
+			for (std::size_t i = firstCamera; i < lastCamera; ++i)
+			{
+				CameraRenderQueue& cameraQueue = m_cameraRenderQueues[i];
+				if (!cameraQueue.invalidated)
+					continue;
+
+				const CameraComponent& camComponent = m_cameras[i]->GetComponent<CameraComponent>();
+				const Nz::Frustumf& frustum = camComponent.GetFrustum();
+
+				cameraQueue.renderQueue.Clear();
+				for (const GraphicsComponent* gfxComponent : cameraQueue.fullyVisibleResults)
+					gfxComponent->AddToRenderQueue(&cameraQueue.renderQueue);
 
-				m_forceRenderQueueInvalidation = false;
+				for (const GraphicsComponent* gfxComponent : cameraQueue.partiallyVisibleResults)
+					gfxComponent->AddToRenderQueueByCulling(frustum, &cameraQueue.renderQueue);
+
+				// Only sorted elements are replayed into the technique queue
+				cameraQueue.renderQueue.Sort(&camComponent);
 			}
+		});
+	}
 
-			camComponent.ApplyView();
+	/*!
+	* \brief Renders the content of the render technique queue from a camera
+	*
+	* \param camComponent Camera to render from
+	*/
 
-			Nz::SceneData sceneData;
-			sceneData.ambientColor = Nz::Color(25, 25, 25);
-			sceneData.background = m_background;
-			sceneData.globalReflectionTexture = nullptr;
-			sceneData.viewer = &camComponent;
+	void RenderSystem::Render(CameraComponent& camComponent)
+	{
+		camComponent.ApplyView();
 
-			if (m_background && m_background->GetBackgroundType() == Nz::BackgroundType_Skybox)
-				sceneData.globalReflectionTexture = static_cast<Nz::SkyboxBackground*>(m_background.Get())->GetTexture();
+		Nz::SceneData sceneData;
+		sceneData.ambientColor = Nz::Color(25, 25, 25);
+		sceneData.background = m_background;
+		sceneData.globalReflectionTexture = nullptr;
+		sceneData.viewer = &camComponent;
 
-			m_renderTechnique->Clear(sceneData);
-			m_renderTechnique->Draw(sceneData);
-		}
+		if (m_background && m_background->GetBackgroundType() == Nz::BackgroundType_Skybox)
+			sceneData.globalReflectionTexture = static_cast<Nz::SkyboxBackground*>(m_background.Get())->GetTexture();
+
+		m_renderTechnique->Clear(sceneData);
+		m_renderTechnique->Draw(sceneData);
 	}
 
 	/*!
@@ -3,10 +3,15 @@
 // For conditions of distribution and use, see copyright notice in Prerequisites.hpp
 
 #include <NDK/Systems/VelocitySystem.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
 #include <NDK/Components/NodeComponent.hpp>
 #include <NDK/Components/PhysicsComponent2D.hpp>
 #include <NDK/Components/PhysicsComponent3D.hpp>
 #include <NDK/Components/VelocityComponent.hpp>
+#include <NDK/World.hpp>
+#include <algorithm>
+#include <vector>
 
 namespace Ndk
 {
@@ -27,6 +32,8 @@ namespace Ndk
 	{
 		Excludes<PhysicsComponent2D, PhysicsComponent3D>();
 		Requires<NodeComponent, VelocityComponent>();
+		Reads<VelocityComponent>();
+		Writes<NodeComponent>();
 		SetUpdateOrder(10); //< Since some systems may want to stop us
 	}
 
@@ -38,13 +45,37 @@ namespace Ndk
 
 	void VelocitySystem::OnUpdate(float elapsedTime)
 	{
-		for (const Ndk::EntityHandle& entity : GetEntities())
+		struct HierarchyEntry
 		{
-			NodeComponent& node = entity->GetComponent<NodeComponent>();
-			const VelocityComponent& velocity = entity->GetComponent<VelocityComponent>();
+			EntityId id;
+			NodeComponent* node;
+			const VelocityComponent* velocity;
+		};
 
-			node.Move(velocity.linearVelocity * elapsedTime, velocity.coordSys);
-		}
+		const EntityList& entities = GetEntities();
+
+		// Moving a node reads its parent and invalidates its children, nodes which are part of a hierarchy are moved afterwards
+		Nz::Mutex hierarchyMutex;
+		std::vector<HierarchyEntry> hierarchyEntries;
+
+		// Going through the velocity storage is faster than chasing components through the entities
+		GetWorld().ForEachComponentParallel<VelocityComponent, NodeComponent>([&](EntityId id, const VelocityComponent& velocity, NodeComponent& node)
+		{
+			if (!entities.Has(id))
+				return;
+
+			if (node.GetParent() || node.HasChilds())
+			{
+				Nz::LockGuard lock(hierarchyMutex);
+				hierarchyEntries.push_back({id, &node, &velocity});
+			}
+			else
+				node.Move(velocity.linearVelocity * elapsedTime, velocity.coordSys);
+		});
+
+		std::sort(hierarchyEntries.begin(), hierarchyEntries.end(), [](const HierarchyEntry& lhs, const HierarchyEntry& rhs) { return lhs.id < rhs.id; });
+		for (const HierarchyEntry& entry : hierarchyEntries)
+			entry.node->Move(entry.velocity->linearVelocity * elapsedTime, entry.velocity->coordSys);
 	}
 
 	SystemIndex VelocitySystem::systemIndex;
@@ -135,6 +135,7 @@ namespace Ndk
 		m_waitingEntities.clear();
 
 		m_aliveEntities.Clear();
+		m_componentStorages.clear();
 		m_dirtyEntities.front.Clear();
 		m_freeEntityIds.Clear();
 		m_killedEntities.front.Clear();
@@ -281,7 +282,13 @@ namespace Ndk
 	* \param elapsedTime Delta time used for the update
 	*
 	* This function Refreshes the world and calls the Update function of every active system part of it with the elapsedTime value.
+	* Systems are updated according to their update order, except that non-exclusive systems which don't conflict with each other
+	* may be updated concurrently using the TaskScheduler.
 	* It also increase the profiler data with the elapsed time passed in Refresh and every system update.
+	*
+	* \remark Systems updated concurrently must not create entities or add/remove components, they can only kill entities
+	*
+	* \see BaseSystem::IsExclusive
 	*/
 	void World::Update(float elapsedTime)
 	{
@@ -293,24 +300,37 @@ namespace Ndk
 
 			m_profilerData.refreshTime += t2 - t1;
 
-			for (auto& systemPtr : m_orderedSystems)
-			{
-				systemPtr->Update(elapsedTime);
-
-				Nz::UInt64 t3 = Nz::GetElapsedMicroseconds();
-				m_profilerData.updateTime[systemPtr->GetIndex()] += t3 - t2;
-				t2 = t3;
-			}
+			UpdateSystems(elapsedTime);
 
+			m_profilerData.systemsUpdateTime += Nz::GetElapsedMicroseconds() - t2;
 			m_profilerData.updateCount++;
 		}
 		else
 		{
 			Refresh();
+			UpdateSystems(elapsedTime);
+		}
+	}
 
-			for (auto& systemPtr : m_orderedSystems)
-				systemPtr->Update(elapsedTime);
+	Nz::UInt64 World::ComputeCriticalPath(std::size_t firstSystem, std::size_t lastSystem)
+	{
+		for (std::size_t i = firstSystem; i < lastSystem; ++i)
+			m_systemDependencies[i].longestPathTime = 0;
+
+		// Systems only depend on systems preceding them, so we can propagate path times in order
+		Nz::UInt64 criticalPathTime = 0;
+		for (std::size_t i = firstSystem; i < lastSystem; ++i)
+		{
+			const SystemDependencies& dependencies = m_systemDependencies[i];
+
+			Nz::UInt64 pathTime = dependencies.longestPathTime + dependencies.updateTime;
+			for (std::size_t dependent : dependencies.dependents)
+				m_systemDependencies[dependent].longestPathTime = std::max(m_systemDependencies[dependent].longestPathTime, pathTime);
+
+			criticalPathTime = std::max(criticalPathTime, pathTime);
 		}
+
+		return criticalPathTime;
 	}
 
 	void World::ReorderSystems()
@@ -323,11 +343,110 @@ namespace Ndk
 				m_orderedSystems.push_back(systemPtr.get());
 		}
 
-		std::sort(m_orderedSystems.begin(), m_orderedSystems.end(), [] (BaseSystem* first, BaseSystem* second)
+		// Keep systems sharing the same update order sorted by index, so the dependency graph doesn't change from a run to another
+		std::stable_sort(m_orderedSystems.begin(), m_orderedSystems.end(), [] (BaseSystem* first, BaseSystem* second)
 		{
 			return first->GetUpdateOrder() < second->GetUpdateOrder();
 		});
 
+		std::size_t systemCount = m_orderedSystems.size();
+
+		m_systemDependencies.clear();
+		m_systemDependencies.resize(systemCount);
+		m_pendingSystemDependencies.reset(new std::atomic<unsigned int>[systemCount]);
+
+		// A non-exclusive system has to wait for the preceding systems it conflicts with, up to the previous exclusive system
+		for (std::size_t i = 0; i < systemCount; ++i)
+		{
+			const BaseSystem* system = m_orderedSystems[i];
+			if (system->IsExclusive())
+				continue;
+
+			for (std::size_t j = i; j-- > 0;)
+			{
+				const BaseSystem* previousSystem = m_orderedSystems[j];
+				if (previousSystem->IsExclusive())
+					break;
+
+				if (system->ConflictsWith(*previousSystem))
+				{
+					m_systemDependencies[j].dependents.push_back(i);
+					m_systemDependencies[i].dependencyCount++;
+				}
+			}
+		}
+
 		m_orderedSystemsUpdated = true;
 	}
+
+	void World::SpawnSystemUpdate(Nz::TaskScheduler::Counter& counter, std::size_t systemIndex, float elapsedTime)
+	{
+		Nz::TaskScheduler::Spawn(counter, [this, &counter, systemIndex, elapsedTime]()
+		{
+			UpdateSystem(systemIndex, elapsedTime);
+
+			// Start the systems which were only waiting for this one
+			for (std::size_t dependent : m_systemDependencies[systemIndex].dependents)
+			{
+				if (--m_pendingSystemDependencies[dependent] == 0)
+					SpawnSystemUpdate(counter, dependent, elapsedTime);
+			}
+		});
+	}
+
+	void World::UpdateSystem(std::size_t systemIndex, float elapsedTime)
+	{
+		BaseSystem* system = m_orderedSystems[systemIndex];
+
+		if (m_isProfilerEnabled)
+		{
+			Nz::UInt64 startTime = Nz::GetElapsedMicroseconds();
+			system->Update(elapsedTime);
+			Nz::UInt64 updateTime = Nz::GetElapsedMicroseconds() - startTime;
+
+			m_profilerData.updateTime[system->GetIndex()] += updateTime;
+			m_systemDependencies[systemIndex].updateTime = updateTime;
+		}
+		else
+			system->Update(elapsedTime);
+	}
+
+	void World::UpdateSystems(float elapsedTime)
+	{
+		std::size_t systemCount = m_orderedSystems.size();
+
+		std::size_t firstSystem = 0;
+		while (firstSystem < systemCount)
+		{
+			// Exclusive systems are updated alone, between them systems are only ordered by their dependencies
+			std::size_t lastSystem = firstSystem + 1;
+			if (!m_orderedSystems[firstSystem]->IsExclusive())
+			{
+				while (lastSystem < systemCount && !m_orderedSystems[lastSystem]->IsExclusive())
+					lastSystem++;
+			}
+
+			if (lastSystem - firstSystem > 1)
+			{
+				for (std::size_t i = firstSystem; i < lastSystem; ++i)
+					m_pendingSystemDependencies[i] = m_systemDependencies[i].dependencyCount;
+
+				Nz::TaskScheduler::Counter counter;
+				for (std::size_t i = firstSystem; i < lastSystem; ++i)
+				{
+					if (m_systemDependencies[i].dependencyCount == 0)
+						SpawnSystemUpdate(counter, i, elapsedTime);
+				}
+
+				Nz::TaskScheduler::Wait(counter);
+			}
+			else
+				UpdateSystem(firstSystem, elapsedTime);
+
+			if (m_isProfilerEnabled)
+				m_profilerData.criticalPathTime += ComputeCriticalPath(firstSystem, lastSystem);
+
+			firstSystem = lastSystem;
+		}
+	}
 }
@@ -32,12 +32,17 @@
 #include <Nazara/Core/AbstractHash.hpp>
 #include <Nazara/Core/AbstractLogger.hpp>
 #include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Archive.hpp>
+#include <Nazara/Core/ArchiveBuilder.hpp>
 #include <Nazara/Core/Bitset.hpp>
+#include <Nazara/Core/BufferedStream.hpp>
 #include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Core/ByteStream.hpp>
 #include <Nazara/Core/CallOnExit.hpp>
 #include <Nazara/Core/Clock.hpp>
 #include <Nazara/Core/Color.hpp>
+#include <Nazara/Core/ConcurrentMemoryPool.hpp>
+#include <Nazara/Core/ConcurrentQueue.hpp>
 #include <Nazara/Core/ConditionVariable.hpp>
 #include <Nazara/Core/Config.hpp>
 #include <Nazara/Core/Core.hpp>
@@ -51,16 +56,22 @@
 #include <Nazara/Core/File.hpp>
 #include <Nazara/Core/FileLogger.hpp>
 #include <Nazara/Core/Flags.hpp>
+#include <Nazara/Core/FrameArena.hpp>
+#include <Nazara/Core/FrameArenaAllocator.hpp>
 #include <Nazara/Core/Functor.hpp>
 #include <Nazara/Core/GuillotineBinPack.hpp>
 #include <Nazara/Core/HandledObject.hpp>
 #include <Nazara/Core/HardwareInfo.hpp>
+#include <Nazara/Core/IndexPool.hpp>
 #include <Nazara/Core/Initializer.hpp>
 #include <Nazara/Core/LockGuard.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/LZCodec.hpp>
+#include <Nazara/Core/MappedFile.hpp>
 #include <Nazara/Core/MemoryHelper.hpp>
 #include <Nazara/Core/MemoryManager.hpp>
 #include <Nazara/Core/MemoryPool.hpp>
+#include <Nazara/Core/MemoryPoolAllocator.hpp>
 #include <Nazara/Core/MemoryStream.hpp>
 #include <Nazara/Core/MemoryView.hpp>
 #include <Nazara/Core/MovablePtr.hpp>
@@ -69,12 +80,14 @@
 #include <Nazara/Core/ObjectLibrary.hpp>
 #include <Nazara/Core/ObjectRef.hpp>
 #include <Nazara/Core/OffsetOf.hpp>
+#include <Nazara/Core/Parallel.hpp>
 #include <Nazara/Core/ParameterList.hpp>
 #include <Nazara/Core/PluginManager.hpp>
 #include <Nazara/Core/Primitive.hpp>
 #include <Nazara/Core/PrimitiveList.hpp>
 #include <Nazara/Core/RefCounted.hpp>
 #include <Nazara/Core/Resource.hpp>
+#include <Nazara/Core/ResourceFuture.hpp>
 #include <Nazara/Core/ResourceLoader.hpp>
 #include <Nazara/Core/ResourceManager.hpp>
 #include <Nazara/Core/ResourceParameters.hpp>
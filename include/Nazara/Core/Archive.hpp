@@ -0,0 +1,90 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_ARCHIVE_HPP
+#define NAZARA_ARCHIVE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Enums.hpp>
+#include <Nazara/Core/MappedFile.hpp>
+#include <Nazara/Core/String.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class ArchiveBuilder;
+
+	class NAZARA_CORE_API Archive
+	{
+		friend ArchiveBuilder;
+
+		public:
+			struct Entry;
+
+			Archive();
+			Archive(const Archive&) = delete;
+			Archive(Archive&&) = delete;
+			~Archive();
+
+			void Close();
+
+			const Entry* FindEntry(const String& entryPath) const;
+
+			inline const Entry& GetEntry(std::size_t index) const;
+			inline std::size_t GetEntryCount() const;
+			inline const UInt8* GetEntryData(const Entry& entry) const;
+			String GetEntryPath(const Entry& entry) const;
+			inline const String& GetMountPoint() const;
+			inline String GetPath() const;
+
+			inline bool IsMounted() const;
+			inline bool IsOpen() const;
+
+			bool Mount(const String& mountPoint);
+
+			bool Open(const String& filePath);
+
+			bool ReadEntry(const Entry& entry, void* buffer) const;
+
+			void Unmount();
+
+			Archive& operator=(const Archive&) = delete;
+			Archive& operator=(Archive&&) = delete;
+
+			static UInt64 ComputeEntryHash(const String& entryPath);
+			static const Archive* FindMountedEntry(const String& filePath, const Entry** entry = nullptr);
+
+			struct Entry
+			{
+				ArchiveCompression compression;
+				UInt32 pathOffset;
+				UInt32 pathSize;
+				UInt64 offset;     //< Offset of the stored data in the archive
+				UInt64 pathHash;
+				UInt64 size;       //< Size of the data once decompressed
+				UInt64 storedSize; //< Size of the data stored in the archive
+			};
+
+		private:
+			static constexpr std::size_t DataAlignment = 16;
+			static constexpr std::size_t EntrySize = 48;
+			static constexpr std::size_t HeaderSize = 48;
+			static constexpr UInt64 MaxCompressionRatio = 256; //< A LZ sequence cannot expand more than 255 times, see LZCodec
+			static constexpr UInt32 InvalidEntryIndex = 0xFFFFFFFF;
+			static constexpr UInt32 Magic = 0x4B41504E; //< "NPAK"
+			static constexpr UInt32 Version = 1;
+
+			std::vector<Entry> m_entries;
+			std::vector<UInt32> m_slots;
+			MappedFile m_file;
+			String m_mountPoint;
+			const UInt8* m_pathTable;
+	};
+}
+
+#include <Nazara/Core/Archive.inl>
+
+#endif // NAZARA_ARCHIVE_HPP
@@ -0,0 +1,84 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets an entry of the archive
+	* \return Entry at the index
+	*
+	* \param index Index of the entry, less than GetEntryCount
+	*/
+	inline const Archive::Entry& Archive::GetEntry(std::size_t index) const
+	{
+		NazaraAssert(index < m_entries.size(), "Entry index out of range");
+
+		return m_entries[index];
+	}
+
+	/*!
+	* \brief Gets the number of entries in the archive
+	* \return Entry count
+	*/
+	inline std::size_t Archive::GetEntryCount() const
+	{
+		return m_entries.size();
+	}
+
+	/*!
+	* \brief Gets the data of an entry, as stored in the archive
+	* \return Pointer to the data inside the mapping, which is compressed if the entry compression is not ArchiveCompression_None
+	*
+	* \param entry Entry of this archive
+	*
+	* \see ReadEntry
+	*/
+	inline const UInt8* Archive::GetEntryData(const Entry& entry) const
+	{
+		NazaraAssert(IsOpen(), "Archive is not open");
+
+		return m_file.GetData() + entry.offset;
+	}
+
+	/*!
+	* \brief Gets the directory in which the archive is mounted
+	* \return Absolute path of the mount point (ending with a separator), or an empty string if the archive is not mounted
+	*/
+	inline const String& Archive::GetMountPoint() const
+	{
+		return m_mountPoint;
+	}
+
+	/*!
+	* \brief Gets the path of the archive file
+	* \return Path of the archive
+	*/
+	inline String Archive::GetPath() const
+	{
+		return m_file.GetPath();
+	}
+
+	/*!
+	* \brief Checks whether the archive is mounted
+	* \return true if its entries can be accessed through the file system
+	*/
+	inline bool Archive::IsMounted() const
+	{
+		return !m_mountPoint.IsEmpty();
+	}
+
+	/*!
+	* \brief Checks whether the archive is open
+	* \return true if open
+	*/
+	inline bool Archive::IsOpen() const
+	{
+		return m_file.IsOpen();
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,56 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_ARCHIVEBUILDER_HPP
+#define NAZARA_ARCHIVEBUILDER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Enums.hpp>
+#include <Nazara/Core/String.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API ArchiveBuilder
+	{
+		public:
+			ArchiveBuilder() = default;
+			ArchiveBuilder(const ArchiveBuilder&) = delete;
+			ArchiveBuilder(ArchiveBuilder&&) = default;
+			~ArchiveBuilder() = default;
+
+			bool AddDirectory(const String& directoryPath, const String& entryDirectory = String(), ArchiveCompression compression = ArchiveCompression_LZ);
+			bool AddEntry(const String& entryPath, const void* data, std::size_t size, ArchiveCompression compression = ArchiveCompression_LZ);
+			bool AddFile(const String& entryPath, const String& filePath, ArchiveCompression compression = ArchiveCompression_LZ);
+
+			void Clear();
+
+			inline std::size_t GetEntryCount() const;
+
+			bool Save(const String& filePath) const;
+
+			ArchiveBuilder& operator=(const ArchiveBuilder&) = delete;
+			ArchiveBuilder& operator=(ArchiveBuilder&&) = default;
+
+		private:
+			struct PendingEntry
+			{
+				ArchiveCompression compression;
+				ByteArray data;
+				String path;
+				UInt64 size;
+			};
+
+			std::unordered_map<String, std::size_t> m_entryIndices;
+			std::vector<PendingEntry> m_entries;
+	};
+}
+
+#include <Nazara/Core/ArchiveBuilder.inl>
+
+#endif // NAZARA_ARCHIVEBUILDER_HPP
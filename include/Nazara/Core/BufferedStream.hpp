@@ -0,0 +1,61 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_BUFFEREDSTREAM_HPP
+#define NAZARA_BUFFEREDSTREAM_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Stream.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API BufferedStream : public Stream
+	{
+		public:
+			BufferedStream(Stream& stream, std::size_t readBufferSize = 64 * 1024, std::size_t writeBufferSize = 64 * 1024);
+			BufferedStream(const BufferedStream&) = delete;
+			BufferedStream(BufferedStream&&) = delete;
+			~BufferedStream();
+
+			bool EndOfStream() const override;
+
+			UInt64 GetCursorPos() const override;
+			String GetDirectory() const override;
+			String GetPath() const override;
+			inline std::size_t GetReadBufferSize() const;
+			UInt64 GetSize() const override;
+			inline Stream& GetStream() const;
+			inline std::size_t GetWriteBufferSize() const;
+
+			String ReadLine(unsigned int lineSize = 0) override;
+
+			bool SetCursorPos(UInt64 offset) override;
+
+			BufferedStream& operator=(const BufferedStream&) = delete;
+			BufferedStream& operator=(BufferedStream&&) = delete;
+
+		private:
+			void DiscardReadBuffer();
+			bool FillReadBuffer();
+			void FlushStream() override;
+			bool FlushWriteBuffer();
+			std::size_t ReadBlock(void* buffer, std::size_t size) override;
+			std::size_t WriteBlock(const void* buffer, std::size_t size) override;
+
+			std::vector<UInt8> m_readBuffer;
+			std::vector<UInt8> m_writeBuffer;
+			Stream& m_stream;
+			UInt64 m_bufferOffset;
+			std::size_t m_readBufferPos;
+			std::size_t m_readBufferSize;
+			std::size_t m_writeBufferSize;
+	};
+}
+
+#include <Nazara/Core/BufferedStream.inl>
+
+#endif // NAZARA_BUFFEREDSTREAM_HPP
@@ -0,0 +1,37 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the maximum number of bytes read ahead from the underlying stream
+	* \return Read buffer size
+	*/
+	inline std::size_t BufferedStream::GetReadBufferSize() const
+	{
+		return m_readBuffer.size();
+	}
+
+	/*!
+	* \brief Gets the underlying stream
+	* \return Stream this object reads from and writes to
+	*/
+	inline Stream& BufferedStream::GetStream() const
+	{
+		return m_stream;
+	}
+
+	/*!
+	* \brief Gets the maximum number of bytes kept before being written to the underlying stream
+	* \return Write buffer size
+	*/
+	inline std::size_t BufferedStream::GetWriteBufferSize() const
+	{
+		return m_writeBuffer.size();
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
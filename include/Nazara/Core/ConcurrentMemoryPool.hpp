@@ -0,0 +1,91 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CONCURRENTMEMORYPOOL_HPP
+#define NAZARA_CONCURRENTMEMORYPOOL_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <atomic>
+#include <memory>
+
+namespace Nz
+{
+	class NAZARA_CORE_API ConcurrentMemoryPool
+	{
+		public:
+			ConcurrentMemoryPool(std::size_t blockSize, std::size_t blocksPerSlab = 256);
+			ConcurrentMemoryPool(const ConcurrentMemoryPool&) = delete;
+			ConcurrentMemoryPool(ConcurrentMemoryPool&&) = delete;
+			~ConcurrentMemoryPool();
+
+			void* Allocate();
+
+			template<typename T> void Delete(T* ptr);
+
+			void Free(void* ptr);
+
+			inline std::size_t GetBlockCount() const;
+			inline std::size_t GetBlockSize() const;
+			inline std::size_t GetBlocksPerSlab() const;
+			inline std::size_t GetHighWaterMark() const;
+			std::size_t GetLiveCount() const;
+			inline std::size_t GetSlabCount() const;
+
+			template<typename T, typename... Args> T* New(Args&&... args);
+
+			ConcurrentMemoryPool& operator=(const ConcurrentMemoryPool&) = delete;
+			ConcurrentMemoryPool& operator=(ConcurrentMemoryPool&&) = delete;
+
+			static constexpr std::size_t CacheBatchSize = 32;
+			static constexpr std::size_t MaxBlocksPerSlab = 0xFFFF;
+			static constexpr std::size_t MaxSlabCount = 0xFFFF;
+			static constexpr std::size_t ThreadCacheCount = 64;
+
+		private:
+			struct SlabHeader
+			{
+				ConcurrentMemoryPool* owner;
+				UInt32 slabIndex;
+			};
+
+			struct ThreadCache
+			{
+				std::atomic<Int64> liveBlocks;
+				UInt32 firstFreeBlock;
+				UInt32 freeBlockCount;
+				std::atomic_flag lock = ATOMIC_FLAG_INIT;
+				UInt8 padding[64 - sizeof(std::atomic<Int64>) - 2 * sizeof(UInt32) - sizeof(std::atomic_flag)]; //< One cache line per cache
+			};
+
+			UInt32 AllocateBlock();
+			UInt32 AllocateSlab();
+			inline UInt8* GetBlock(UInt32 blockIndex) const;
+			UInt32 GetBlockIndex(void* ptr) const;
+			inline std::atomic<UInt32>& GetNextBlock(UInt32 blockIndex) const;
+			ThreadCache& GetThreadCache();
+			UInt32 PopDepot();
+			void PushDepot(UInt32 firstBlock, UInt32 lastBlock, std::size_t blockCount);
+			void UpdateHighWaterMark();
+
+			std::atomic<UInt64> m_depotHead;
+			std::atomic<std::size_t> m_depotBlockCount;
+			std::atomic<std::size_t> m_highWaterMark;
+			std::atomic<Int64> m_uncachedLiveBlocks;
+			std::atomic<UInt32> m_slabCount;
+			std::unique_ptr<std::atomic<UInt8*>[]> m_slabs;
+			std::unique_ptr<ThreadCache[]> m_threadCaches;
+			Mutex m_slabMutex;
+			std::size_t m_blockSize;
+			std::size_t m_blocksPerSlab;
+			std::size_t m_headerSize;
+			std::size_t m_slabSize;
+	};
+}
+
+#include <Nazara/Core/ConcurrentMemoryPool.inl>
+
+#endif // NAZARA_CONCURRENTMEMORYPOOL_HPP
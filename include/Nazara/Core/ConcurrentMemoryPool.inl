@@ -0,0 +1,109 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <utility>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Destroys an object and frees its memory
+	*
+	* \param ptr Pointer to an object allocated with New
+	*
+	* \remark If ptr is null, nothing is done
+	*/
+	template<typename T>
+	void ConcurrentMemoryPool::Delete(T* ptr)
+	{
+		if (ptr)
+		{
+			PlacementDestroy(ptr);
+			Free(ptr);
+		}
+	}
+
+	/*!
+	* \brief Gets the number of blocks the pool currently holds (used or not)
+	* \return Total number of blocks
+	*/
+	inline std::size_t ConcurrentMemoryPool::GetBlockCount() const
+	{
+		return GetSlabCount() * m_blocksPerSlab;
+	}
+
+	/*!
+	* \brief Gets the block size
+	* \return Size of the blocks, which may be greater than the size given at construction because of alignment
+	*/
+	inline std::size_t ConcurrentMemoryPool::GetBlockSize() const
+	{
+		return m_blockSize;
+	}
+
+	/*!
+	* \brief Gets the number of blocks allocated at once when the pool grows
+	* \return Number of blocks per slab
+	*/
+	inline std::size_t ConcurrentMemoryPool::GetBlocksPerSlab() const
+	{
+		return m_blocksPerSlab;
+	}
+
+	/*!
+	* \brief Gets the highest number of blocks which have been out of the shared depot at once
+	* \return High-water mark
+	*
+	* \remark Blocks kept in thread caches are counted as used, this is an upper bound of the number of blocks which were actually needed
+	*/
+	inline std::size_t ConcurrentMemoryPool::GetHighWaterMark() const
+	{
+		return m_highWaterMark.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Gets the number of slabs allocated by the pool
+	* \return Number of slabs
+	*/
+	inline std::size_t ConcurrentMemoryPool::GetSlabCount() const
+	{
+		return m_slabCount.load(std::memory_order_acquire);
+	}
+
+	/*!
+	* \brief Creates a new object in the pool
+	* \return Pointer to the constructed object
+	*
+	* \param args Arguments for the new object
+	*/
+	template<typename T, typename... Args>
+	T* ConcurrentMemoryPool::New(Args&&... args)
+	{
+		NazaraAssert(sizeof(T) <= m_blockSize, "Type is too big for this pool");
+
+		T* object = static_cast<T*>(Allocate());
+		if (!object)
+			return nullptr;
+
+		PlacementNew(object, std::forward<Args>(args)...);
+
+		return object;
+	}
+
+	inline UInt8* ConcurrentMemoryPool::GetBlock(UInt32 blockIndex) const
+	{
+		UInt8* slab = m_slabs[blockIndex >> 16].load(std::memory_order_acquire);
+		return slab + m_headerSize + (blockIndex & 0xFFFF) * m_blockSize;
+	}
+
+	inline std::atomic<UInt32>& ConcurrentMemoryPool::GetNextBlock(UInt32 blockIndex) const
+	{
+		// Free blocks store the index of the next free block in their first bytes
+		return *reinterpret_cast<std::atomic<UInt32>*>(GetBlock(blockIndex));
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,53 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CONCURRENTQUEUE_HPP
+#define NAZARA_CONCURRENTQUEUE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <atomic>
+#include <memory>
+#include <type_traits>
+
+namespace Nz
+{
+	template<typename T>
+	class ConcurrentQueue
+	{
+		public:
+			ConcurrentQueue(std::size_t capacity);
+			ConcurrentQueue(const ConcurrentQueue&) = delete;
+			ConcurrentQueue(ConcurrentQueue&&) = delete;
+			~ConcurrentQueue();
+
+			inline std::size_t GetCapacity() const;
+
+			bool Pop(T* value);
+			bool Push(T&& value);
+
+			ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+			ConcurrentQueue& operator=(ConcurrentQueue&&) = delete;
+
+		private:
+			struct Cell
+			{
+				std::atomic<std::size_t> sequence;
+				typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+			};
+
+			std::unique_ptr<Cell[]> m_cells;
+			std::size_t m_mask;
+			// Producers and consumers write their position concurrently, keep them on separate cache lines
+			UInt8 m_padding0[64];
+			std::atomic<std::size_t> m_pushPosition;
+			UInt8 m_padding1[64 - sizeof(std::atomic<std::size_t>)];
+			std::atomic<std::size_t> m_popPosition;
+	};
+}
+
+#include <Nazara/Core/ConcurrentQueue.inl>
+
+#endif // NAZARA_CONCURRENTQUEUE_HPP
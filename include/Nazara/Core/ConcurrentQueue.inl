@@ -0,0 +1,141 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ConcurrentQueue.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <utility>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::ConcurrentQueue
+	* \brief Core class that represents a bounded lock-free FIFO queue, usable by any number of producer and consumer threads
+	*
+	* Each cell holds a sequence number telling whether it's ready to be written or read for the current lap of the ring,
+	* producers and consumers then only compete on a compare-and-swap of their position.
+	* Push and Pop never block: they fail when the queue is full or empty.
+	*/
+
+	/*!
+	* \brief Constructs a ConcurrentQueue object
+	*
+	* \param capacity Maximum number of values in the queue, rounded up to the next power of two
+	*/
+	template<typename T>
+	ConcurrentQueue<T>::ConcurrentQueue(std::size_t capacity) :
+	m_pushPosition(0),
+	m_popPosition(0)
+	{
+		NazaraAssert(capacity > 0, "Capacity must be over zero");
+
+		std::size_t cellCount = 1;
+		while (cellCount < capacity)
+			cellCount <<= 1;
+
+		m_cells.reset(new Cell[cellCount]);
+		m_mask = cellCount - 1;
+
+		for (std::size_t i = 0; i < cellCount; ++i)
+			m_cells[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Destructs the object and the values remaining in the queue
+	*
+	* \remark The queue must no longer be used by other threads
+	*/
+	template<typename T>
+	ConcurrentQueue<T>::~ConcurrentQueue()
+	{
+		T value;
+		while (Pop(&value));
+	}
+
+	/*!
+	* \brief Gets the maximum number of values the queue can hold
+	* \return Capacity of the queue
+	*/
+	template<typename T>
+	inline std::size_t ConcurrentQueue<T>::GetCapacity() const
+	{
+		return m_mask + 1;
+	}
+
+	/*!
+	* \brief Removes the oldest value of the queue
+	* \return true if a value was removed, false if the queue was empty
+	*
+	* \param value Pointer receiving the value (by move)
+	*/
+	template<typename T>
+	bool ConcurrentQueue<T>::Pop(T* value)
+	{
+		NazaraAssert(value, "Invalid value pointer");
+
+		std::size_t position = m_popPosition.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			Cell& cell = m_cells[position & m_mask];
+			std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+
+			std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+			if (difference == 0)
+			{
+				if (m_popPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					T* cellValue = reinterpret_cast<T*>(&cell.storage);
+					*value = std::move(*cellValue);
+					PlacementDestroy(cellValue);
+
+					// The cell is ready to be written by the next lap of producers
+					cell.sequence.store(position + m_mask + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (difference < 0)
+				return false; // Empty
+			else
+				position = m_popPosition.load(std::memory_order_relaxed);
+		}
+	}
+
+	/*!
+	* \brief Adds a value at the end of the queue
+	* \return true if the value was added, false if the queue was full (value is then left untouched)
+	*
+	* \param value Value to add
+	*/
+	template<typename T>
+	bool ConcurrentQueue<T>::Push(T&& value)
+	{
+		std::size_t position = m_pushPosition.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			Cell& cell = m_cells[position & m_mask];
+			std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+
+			std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+			if (difference == 0)
+			{
+				if (m_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					PlacementNew(reinterpret_cast<T*>(&cell.storage), std::move(value));
+
+					// Makes the value visible to consumers
+					cell.sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (difference < 0)
+				return false; // Full
+			else
+				position = m_pushPosition.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
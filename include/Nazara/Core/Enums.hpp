@@ -11,6 +11,14 @@
 
 namespace Nz
 {
+	enum ArchiveCompression
+	{
+		ArchiveCompression_None,
+		ArchiveCompression_LZ,
+
+		ArchiveCompression_Max = ArchiveCompression_LZ
+	};
+
 	enum CoordSys
 	{
 		CoordSys_Global,
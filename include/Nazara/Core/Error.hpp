@@ -39,13 +39,6 @@ namespace Nz
 
 			static void Trigger(ErrorType type, const String& error);
 			static void Trigger(ErrorType type, const String& error, unsigned int line, const char* file, const char* function);
-
-		private:
-			static UInt32 s_flags;
-			static String s_lastError;
-			static const char* s_lastErrorFunction;
-			static const char* s_lastErrorFile;
-			static unsigned int s_lastErrorLine;
 	};
 }
 
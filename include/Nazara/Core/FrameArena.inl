@@ -0,0 +1,86 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <type_traits>
+#include <utility>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Allocates memory from the arena
+	* \return Pointer to the allocated memory, which stays valid until the next call to Reset
+	*
+	* \param size Size of the allocation
+	* \param alignment Alignment of the allocation, must be a power of two
+	*/
+	inline void* FrameArena::Allocate(std::size_t size, std::size_t alignment)
+	{
+		NazaraAssert(alignment != 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of two");
+
+		if (m_currentBlock < m_blocks.size())
+		{
+			Block& block = m_blocks[m_currentBlock];
+
+			std::uintptr_t blockStart = reinterpret_cast<std::uintptr_t>(block.memory.get());
+			std::size_t offset = ((blockStart + m_offset + alignment - 1) & ~(alignment - 1)) - blockStart;
+			if (offset + size <= block.size)
+			{
+				m_usedMemory += offset + size - m_offset;
+				m_offset = offset + size;
+
+				return block.memory.get() + offset;
+			}
+		}
+
+		return AllocateFromNextBlock(size, alignment);
+	}
+
+	/*!
+	* \brief Gets the number of memory blocks owned by the arena
+	* \return Block count
+	*/
+	inline std::size_t FrameArena::GetBlockCount() const
+	{
+		return m_blocks.size();
+	}
+
+	/*!
+	* \brief Gets the minimum size of the blocks allocated by the arena
+	* \return Block size
+	*/
+	inline std::size_t FrameArena::GetBlockSize() const
+	{
+		return m_blockSize;
+	}
+
+	/*!
+	* \brief Gets the number of bytes allocated since the last reset, including alignment padding
+	* \return Used memory
+	*/
+	inline std::size_t FrameArena::GetUsedMemory() const
+	{
+		return m_usedMemory;
+	}
+
+	/*!
+	* \brief Constructs an object in the arena
+	* \return Pointer to the newly constructed object
+	*
+	* \param args Arguments for the constructor
+	*
+	* \remark The destructor of the object will never be called, hence T must be trivially destructible
+	*/
+	template<typename T, typename... Args>
+	T* FrameArena::New(Args&&... args)
+	{
+		static_assert(std::is_trivially_destructible<T>::value, "Objects constructed in a frame arena are never destroyed");
+
+		return PlacementNew(static_cast<T*>(Allocate(sizeof(T), alignof(T))), std::forward<Args>(args)...);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,49 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_FRAMEARENAALLOCATOR_HPP
+#define NAZARA_FRAMEARENAALLOCATOR_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/FrameArena.hpp>
+#include <type_traits>
+
+namespace Nz
+{
+	template<typename T>
+	class FrameArenaAllocator
+	{
+		template<typename U> friend class FrameArenaAllocator;
+
+		public:
+			using value_type = T;
+			using propagate_on_container_copy_assignment = std::true_type;
+			using propagate_on_container_move_assignment = std::true_type;
+			using propagate_on_container_swap = std::true_type;
+
+			inline FrameArenaAllocator(FrameArena& arena);
+			template<typename U> FrameArenaAllocator(const FrameArenaAllocator<U>& allocator);
+			FrameArenaAllocator(const FrameArenaAllocator&) = default;
+			~FrameArenaAllocator() = default;
+
+			inline T* allocate(std::size_t n);
+			inline void deallocate(T* ptr, std::size_t n);
+
+			inline FrameArena& GetArena() const;
+
+			FrameArenaAllocator& operator=(const FrameArenaAllocator&) = default;
+
+		private:
+			FrameArena* m_arena;
+	};
+
+	template<typename T, typename U> bool operator==(const FrameArenaAllocator<T>& lhs, const FrameArenaAllocator<U>& rhs);
+	template<typename T, typename U> bool operator!=(const FrameArenaAllocator<T>& lhs, const FrameArenaAllocator<U>& rhs);
+}
+
+#include <Nazara/Core/FrameArenaAllocator.inl>
+
+#endif // NAZARA_FRAMEARENAALLOCATOR_HPP
@@ -0,0 +1,92 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::FrameArenaAllocator
+	* \brief Core class that adapts a FrameArena to the standard allocator interface
+	*
+	* Deallocation does nothing, memory is reclaimed when the arena is reset.
+	* A container using this allocator must therefore not be used anymore (not even destroyed) once its arena has been reset, but it can be reassigned.
+	*/
+
+	/*!
+	* \brief Constructs a FrameArenaAllocator object
+	*
+	* \param arena Arena the memory will be allocated from, it must outlive the allocator
+	*/
+	template<typename T>
+	FrameArenaAllocator<T>::FrameArenaAllocator(FrameArena& arena) :
+	m_arena(&arena)
+	{
+	}
+
+	/*!
+	* \brief Constructs a FrameArenaAllocator object using the same arena as another allocator
+	*
+	* \param allocator Allocator to rebind
+	*/
+	template<typename T>
+	template<typename U>
+	FrameArenaAllocator<T>::FrameArenaAllocator(const FrameArenaAllocator<U>& allocator) :
+	m_arena(allocator.m_arena)
+	{
+	}
+
+	/*!
+	* \brief Allocates uninitialized storage for n objects
+	* \return Pointer to the storage
+	*
+	* \param n Number of objects
+	*/
+	template<typename T>
+	T* FrameArenaAllocator<T>::allocate(std::size_t n)
+	{
+		return static_cast<T*>(m_arena->Allocate(n * sizeof(T), alignof(T)));
+	}
+
+	/*!
+	* \brief Does nothing, the memory belongs to the arena until it is reset
+	*/
+	template<typename T>
+	void FrameArenaAllocator<T>::deallocate(T* /*ptr*/, std::size_t /*n*/)
+	{
+	}
+
+	/*!
+	* \brief Gets the arena used by this allocator
+	* \return Arena
+	*/
+	template<typename T>
+	FrameArena& FrameArenaAllocator<T>::GetArena() const
+	{
+		return *m_arena;
+	}
+
+	/*!
+	* \brief Checks whether two allocators use the same arena
+	* \return true if memory allocated by one can be deallocated by the other
+	*/
+	template<typename T, typename U>
+	bool operator==(const FrameArenaAllocator<T>& lhs, const FrameArenaAllocator<U>& rhs)
+	{
+		return &lhs.GetArena() == &rhs.GetArena();
+	}
+
+	/*!
+	* \brief Checks whether two allocators use different arenas
+	* \return false if memory allocated by one can be deallocated by the other
+	*/
+	template<typename T, typename U>
+	bool operator!=(const FrameArenaAllocator<T>& lhs, const FrameArenaAllocator<U>& rhs)
+	{
+		return !operator==(lhs, rhs);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,63 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_INDEXPOOL_HPP
+#define NAZARA_INDEXPOOL_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API IndexPool
+	{
+		public:
+			class Index;
+
+			IndexPool();
+			IndexPool(const IndexPool&) = delete;
+			IndexPool(IndexPool&&) = delete;
+			~IndexPool() = default;
+
+			UInt32 Acquire();
+
+			UInt32 GetCount() const;
+			UInt32 GetUsedCount() const;
+
+			void Release(UInt32 index);
+
+			IndexPool& operator=(const IndexPool&) = delete;
+			IndexPool& operator=(IndexPool&&) = delete;
+
+		private:
+			mutable Mutex m_mutex;
+			std::vector<UInt32> m_freeIndices;
+			UInt32 m_nextIndex;
+	};
+
+	class IndexPool::Index
+	{
+		public:
+			inline explicit Index(IndexPool& pool);
+			inline Index(const Index& index);
+			Index(Index&&) = delete;
+			inline ~Index();
+
+			inline UInt32 Get() const;
+
+			inline Index& operator=(const Index& index);
+			Index& operator=(Index&&) = delete;
+
+		private:
+			IndexPool& m_pool;
+			UInt32 m_index;
+	};
+}
+
+#include <Nazara/Core/IndexPool.inl>
+
+#endif // NAZARA_INDEXPOOL_HPP
@@ -0,0 +1,64 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \class Nz::IndexPool::Index
+	* \brief Core class holding an index of an IndexPool for its whole lifetime
+	*
+	* A copy acquires its own index and assigning an Index does not change it, so objects holding one keep a unique index whatever happens to them.
+	*/
+
+	/*!
+	* \brief Constructs an Index object by acquiring an index from a pool
+	*
+	* \param pool Pool to acquire the index from, must outlive this object
+	*/
+	inline IndexPool::Index::Index(IndexPool& pool) :
+	m_pool(pool),
+	m_index(pool.Acquire())
+	{
+	}
+
+	/*!
+	* \brief Constructs an Index object by acquiring a new index from the pool of another one
+	*
+	* \param index Index whose pool is used
+	*/
+	inline IndexPool::Index::Index(const Index& index) :
+	Index(index.m_pool)
+	{
+	}
+
+	/*!
+	* \brief Destructs the object and releases its index
+	*/
+	inline IndexPool::Index::~Index()
+	{
+		m_pool.Release(m_index);
+	}
+
+	/*!
+	* \brief Gets the index
+	* \return Index, unique among the indices currently acquired from the pool
+	*/
+	inline UInt32 IndexPool::Index::Get() const
+	{
+		return m_index;
+	}
+
+	/*!
+	* \brief Does nothing, the index is kept
+	* \return A reference to this
+	*/
+	inline IndexPool::Index& IndexPool::Index::operator=(const Index& /*index*/)
+	{
+		return *this;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
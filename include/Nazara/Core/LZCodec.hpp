@@ -0,0 +1,27 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_LZCODEC_HPP
+#define NAZARA_LZCODEC_HPP
+
+#include <Nazara/Prerequisites.hpp>
+
+namespace Nz
+{
+	class NAZARA_CORE_API LZCodec
+	{
+		public:
+			LZCodec() = delete;
+			~LZCodec() = delete;
+
+			static std::size_t Compress(const void* input, std::size_t inputSize, void* output, std::size_t outputSize);
+			static std::size_t Decompress(const void* input, std::size_t inputSize, void* output, std::size_t outputSize);
+
+			static std::size_t GetMaxCompressedSize(std::size_t inputSize);
+	};
+}
+
+#endif // NAZARA_LZCODEC_HPP
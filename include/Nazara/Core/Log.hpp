@@ -54,6 +54,7 @@ namespace Nz
 
 			static AbstractLogger* s_logger;
 			static bool s_enabled;
+			NazaraMutexAttrib(s_mutex, static)
 	};
 }
 
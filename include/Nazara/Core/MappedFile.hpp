@@ -0,0 +1,67 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_MAPPEDFILE_HPP
+#define NAZARA_MAPPEDFILE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/MovablePtr.hpp>
+#include <Nazara/Core/Stream.hpp>
+#include <Nazara/Core/String.hpp>
+#include <memory>
+
+namespace Nz
+{
+	class MappedFileImpl;
+
+	class NAZARA_CORE_API MappedFile : public Stream
+	{
+		public:
+			MappedFile();
+			MappedFile(const String& filePath);
+			MappedFile(const MappedFile&) = delete;
+			MappedFile(MappedFile&& file) noexcept;
+			~MappedFile();
+
+			void Close();
+
+			bool EndOfStream() const override;
+
+			UInt64 GetCursorPos() const override;
+			const UInt8* GetData() const;
+			String GetDirectory() const override;
+			String GetFileName() const;
+			String GetPath() const override;
+			UInt64 GetSize() const override;
+
+			bool IsOpen() const;
+
+			bool Open();
+			bool Open(const String& filePath);
+
+			bool SetCursorPos(UInt64 offset) override;
+			bool SetFile(const String& filePath);
+
+			MappedFile& operator=(const MappedFile&) = delete;
+			MappedFile& operator=(MappedFile&& file) noexcept;
+
+			static bool Exists(const String& filePath);
+
+		private:
+			void FlushStream() override;
+			std::size_t ReadBlock(void* buffer, std::size_t size) override;
+			std::size_t WriteBlock(const void* buffer, std::size_t size) override;
+
+			MovablePtr<MappedFileImpl> m_impl;
+			String m_filePath;
+			std::unique_ptr<UInt8[]> m_buffer;
+			const UInt8* m_data;
+			UInt64 m_cursorPos;
+			UInt64 m_size;
+	};
+}
+
+#endif // NAZARA_MAPPEDFILE_HPP
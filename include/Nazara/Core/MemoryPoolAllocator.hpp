@@ -0,0 +1,49 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_MEMORYPOOLALLOCATOR_HPP
+#define NAZARA_MEMORYPOOLALLOCATOR_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/MemoryPool.hpp>
+#include <type_traits>
+
+namespace Nz
+{
+	template<typename T>
+	class MemoryPoolAllocator
+	{
+		template<typename U> friend class MemoryPoolAllocator;
+
+		public:
+			using value_type = T;
+			using propagate_on_container_copy_assignment = std::true_type;
+			using propagate_on_container_move_assignment = std::true_type;
+			using propagate_on_container_swap = std::true_type;
+
+			inline MemoryPoolAllocator(MemoryPool& pool);
+			template<typename U> MemoryPoolAllocator(const MemoryPoolAllocator<U>& allocator);
+			MemoryPoolAllocator(const MemoryPoolAllocator&) = default;
+			~MemoryPoolAllocator() = default;
+
+			inline T* allocate(std::size_t n);
+			inline void deallocate(T* ptr, std::size_t n);
+
+			inline MemoryPool& GetPool() const;
+
+			MemoryPoolAllocator& operator=(const MemoryPoolAllocator&) = default;
+
+		private:
+			MemoryPool* m_pool;
+	};
+
+	template<typename T, typename U> bool operator==(const MemoryPoolAllocator<T>& lhs, const MemoryPoolAllocator<U>& rhs);
+	template<typename T, typename U> bool operator!=(const MemoryPoolAllocator<T>& lhs, const MemoryPoolAllocator<U>& rhs);
+}
+
+#include <Nazara/Core/MemoryPoolAllocator.inl>
+
+#endif // NAZARA_MEMORYPOOLALLOCATOR_HPP
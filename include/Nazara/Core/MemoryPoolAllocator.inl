@@ -0,0 +1,96 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::MemoryPoolAllocator
+	* \brief Core class that adapts a MemoryPool to the standard allocator interface
+	*
+	* This is meant for node-based containers (such as std::list) whose nodes fit in the blocks of the pool, those are then allocated without calling operator new.
+	* Bigger allocations are still handled by the pool, which falls back to operator new for them.
+	* The block size of the pool must be a multiple of the alignment of the nodes.
+	*/
+
+	/*!
+	* \brief Constructs a MemoryPoolAllocator object
+	*
+	* \param pool Pool the memory will be allocated from, it must outlive the allocator and every container using it
+	*/
+	template<typename T>
+	MemoryPoolAllocator<T>::MemoryPoolAllocator(MemoryPool& pool) :
+	m_pool(&pool)
+	{
+	}
+
+	/*!
+	* \brief Constructs a MemoryPoolAllocator object using the same pool as another allocator
+	*
+	* \param allocator Allocator to rebind
+	*/
+	template<typename T>
+	template<typename U>
+	MemoryPoolAllocator<T>::MemoryPoolAllocator(const MemoryPoolAllocator<U>& allocator) :
+	m_pool(allocator.m_pool)
+	{
+	}
+
+	/*!
+	* \brief Allocates uninitialized storage for n objects
+	* \return Pointer to the storage
+	*
+	* \param n Number of objects
+	*/
+	template<typename T>
+	T* MemoryPoolAllocator<T>::allocate(std::size_t n)
+	{
+		return static_cast<T*>(m_pool->Allocate(static_cast<unsigned int>(n * sizeof(T))));
+	}
+
+	/*!
+	* \brief Gives back storage to the pool
+	*
+	* \param ptr Pointer returned by allocate
+	*/
+	template<typename T>
+	void MemoryPoolAllocator<T>::deallocate(T* ptr, std::size_t /*n*/)
+	{
+		m_pool->Free(ptr);
+	}
+
+	/*!
+	* \brief Gets the pool used by this allocator
+	* \return Pool
+	*/
+	template<typename T>
+	MemoryPool& MemoryPoolAllocator<T>::GetPool() const
+	{
+		return *m_pool;
+	}
+
+	/*!
+	* \brief Checks whether two allocators use the same pool
+	* \return true if memory allocated by one can be deallocated by the other
+	*/
+	template<typename T, typename U>
+	bool operator==(const MemoryPoolAllocator<T>& lhs, const MemoryPoolAllocator<U>& rhs)
+	{
+		return &lhs.GetPool() == &rhs.GetPool();
+	}
+
+	/*!
+	* \brief Checks whether two allocators use different pools
+	* \return false if memory allocated by one can be deallocated by the other
+	*/
+	template<typename T, typename U>
+	bool operator!=(const MemoryPoolAllocator<T>& lhs, const MemoryPoolAllocator<U>& rhs)
+	{
+		return !operator==(lhs, rhs);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
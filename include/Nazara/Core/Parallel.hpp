@@ -0,0 +1,21 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_PARALLEL_HPP
+#define NAZARA_PARALLEL_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+
+namespace Nz
+{
+	template<typename T, typename F> void ParallelFor(T begin, T end, T grainSize, F&& func);
+	template<typename T, typename V, typename F, typename R> V ParallelReduce(T begin, T end, T grainSize, V identity, F&& func, R&& reduce);
+}
+
+#include <Nazara/Core/Parallel.inl>
+
+#endif // NAZARA_PARALLEL_HPP
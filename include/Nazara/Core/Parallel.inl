@@ -0,0 +1,130 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<typename T>
+		T ComputeGrainSize(T begin, T end, T grainSize)
+		{
+			if (grainSize > 0)
+				return grainSize;
+
+			// Aim for a few chunks per worker, so that work stealing can balance uneven loads
+			T chunkCount = static_cast<T>(TaskScheduler::GetWorkerCount() * 4);
+			return std::max<T>((end - begin) / chunkCount, 1);
+		}
+
+		template<typename T, typename F>
+		void ParallelForRange(TaskScheduler::Counter& counter, T begin, T end, T grainSize, const F& func)
+		{
+			// Split the range in halves, handing the upper one to another task until the remaining range is small enough
+			while (end - begin > grainSize)
+			{
+				T middle = begin + (end - begin) / 2;
+
+				TaskScheduler::Spawn(counter, [&counter, middle, end, grainSize, &func]()
+				{
+					ParallelForRange(counter, middle, end, grainSize, func);
+				});
+
+				end = middle;
+			}
+
+			func(begin, end);
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Calls a function over a range of indices, spreading the work over the TaskScheduler workers
+	*
+	* The range is recursively split in two until subranges contain at most grainSize indices,
+	* the function is then called once per subrange (and not once per index) as func(subrangeBegin, subrangeEnd).
+	* This function returns once the whole range has been processed, the calling thread takes part in the work.
+	*
+	* \param begin First index of the range
+	* \param end Index past the last index of the range
+	* \param grainSize Maximum number of indices handled by one call, zero to let it be computed from the worker count
+	* \param func Function to call, which must be safe to call concurrently on disjoint subranges
+	*
+	* \remark Falls back to a single call on the calling thread if the range is smaller than the grain size
+	*/
+	template<typename T, typename F>
+	void ParallelFor(T begin, T end, T grainSize, F&& func)
+	{
+		static_assert(std::is_integral<T>::value, "Range must be made of integers");
+
+		if (begin >= end)
+			return;
+
+		grainSize = Detail::ComputeGrainSize(begin, end, grainSize);
+		if (end - begin <= grainSize)
+		{
+			func(begin, end);
+			return;
+		}
+
+		TaskScheduler::Counter counter;
+		Detail::ParallelForRange(counter, begin, end, grainSize, func);
+
+		TaskScheduler::Wait(counter);
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Reduces a range of indices to a single value, spreading the work over the TaskScheduler workers
+	* \return Reduced value
+	*
+	* The range is split in chunks of grainSize indices, each chunk is reduced with func(chunkBegin, chunkEnd, identity)
+	* and the partial results are then combined in order with reduce(lhs, rhs), making the result deterministic.
+	*
+	* \param begin First index of the range
+	* \param end Index past the last index of the range
+	* \param grainSize Number of indices per chunk, zero to let it be computed from the worker count
+	* \param identity Identity value of the reduction (for example 0 for a sum), used as initial value for each chunk
+	* \param func Function reducing a chunk, which must be safe to call concurrently on disjoint chunks
+	* \param reduce Associative function combining two partial results
+	*/
+	template<typename T, typename V, typename F, typename R>
+	V ParallelReduce(T begin, T end, T grainSize, V identity, F&& func, R&& reduce)
+	{
+		static_assert(std::is_integral<T>::value, "Range must be made of integers");
+
+		if (begin >= end)
+			return identity;
+
+		grainSize = Detail::ComputeGrainSize(begin, end, grainSize);
+
+		T chunkCount = (end - begin + grainSize - 1) / grainSize;
+		if (chunkCount == 1)
+			return func(begin, end, identity);
+
+		std::vector<V> partialResults(static_cast<std::size_t>(chunkCount), identity);
+		ParallelFor<T>(0, chunkCount, 1, [&](T firstChunk, T lastChunk)
+		{
+			for (T chunk = firstChunk; chunk < lastChunk; ++chunk)
+			{
+				T chunkBegin = begin + chunk * grainSize;
+				T chunkEnd = (chunk == chunkCount - 1) ? end : chunkBegin + grainSize;
+
+				partialResults[static_cast<std::size_t>(chunk)] = func(chunkBegin, chunkEnd, identity);
+			}
+		});
+
+		V result = std::move(partialResults.front());
+		for (std::size_t i = 1; i < partialResults.size(); ++i)
+			result = reduce(std::move(result), std::move(partialResults[i]));
+
+		return result;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,68 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_RESOURCEFUTURE_HPP
+#define NAZARA_RESOURCEFUTURE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ConditionVariable.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/ObjectRef.hpp>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	template<typename Type>
+	class ResourceFuture
+	{
+		public:
+			using Callback = std::function<void(const ObjectRef<Type>& resource)>;
+
+			ResourceFuture() = default;
+			explicit ResourceFuture(ObjectRef<Type> resource);
+			ResourceFuture(const ResourceFuture&) = default;
+			ResourceFuture(ResourceFuture&&) noexcept = default;
+			~ResourceFuture() = default;
+
+			ObjectRef<Type> Get() const;
+
+			bool IsReady() const;
+			bool IsValid() const;
+
+			void Then(Callback callback) const;
+
+			void Wait() const;
+
+			ResourceFuture& operator=(const ResourceFuture&) = default;
+			ResourceFuture& operator=(ResourceFuture&&) noexcept = default;
+
+			template<typename F> static ResourceFuture Async(F loadFunction);
+
+		private:
+			struct State
+			{
+				ConditionVariable readyCondition;
+				Mutex mutex;
+				ObjectRef<Type> resource;
+				std::atomic<bool> ready;
+				std::atomic<bool> started;
+				std::function<ObjectRef<Type>()> loadFunction;
+				std::vector<Callback> callbacks;
+			};
+
+			static void Complete(const std::shared_ptr<State>& state, ObjectRef<Type> resource);
+			static void Load(const std::shared_ptr<State>& state);
+
+			std::shared_ptr<State> m_state;
+	};
+}
+
+#include <Nazara/Core/ResourceFuture.inl>
+
+#endif // NAZARA_RESOURCEFUTURE_HPP
@@ -0,0 +1,188 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <utility>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::ResourceFuture
+	* \brief Core class that represents a resource which may still be loading
+	*
+	* Futures are cheap to copy, every copy refers to the same loading operation.
+	* Callbacks registered with Then are always executed by the main thread, from TaskScheduler::RunMainThreadTasks.
+	*/
+
+	/*!
+	* \brief Constructs a ResourceFuture object which is already ready
+	*
+	* \param resource Resource held by the future, may be invalid to represent a failed loading
+	*/
+	template<typename Type>
+	ResourceFuture<Type>::ResourceFuture(ObjectRef<Type> resource) :
+	m_state(std::make_shared<State>())
+	{
+		m_state->resource = std::move(resource);
+		m_state->ready = true;
+	}
+
+	/*!
+	* \brief Gets the resource, waiting for it to be loaded
+	* \return Reference to the resource, invalid if the loading failed
+	*
+	* \remark The future must be valid
+	*/
+	template<typename Type>
+	ObjectRef<Type> ResourceFuture<Type>::Get() const
+	{
+		Wait();
+
+		return m_state->resource;
+	}
+
+	/*!
+	* \brief Checks whether the loading is over
+	* \return true if the resource can be retrieved without waiting
+	*
+	* \remark The future must be valid
+	*/
+	template<typename Type>
+	bool ResourceFuture<Type>::IsReady() const
+	{
+		NazaraAssert(IsValid(), "Invalid future");
+
+		return m_state->ready.load(std::memory_order_acquire);
+	}
+
+	/*!
+	* \brief Checks whether the future refers to a loading operation
+	* \return true if it does
+	*/
+	template<typename Type>
+	bool ResourceFuture<Type>::IsValid() const
+	{
+		return m_state != nullptr;
+	}
+
+	/*!
+	* \brief Registers a function to call once the loading is over
+	*
+	* The callback is executed by the main thread, on the next call to TaskScheduler::RunMainThreadTasks following the end of the loading (even if the future is already ready).
+	*
+	* \param callback Function receiving the resource, which is invalid if the loading failed
+	*
+	* \remark The future must be valid
+	*/
+	template<typename Type>
+	void ResourceFuture<Type>::Then(Callback callback) const
+	{
+		NazaraAssert(IsValid(), "Invalid future");
+
+		{
+			LockGuard lock(m_state->mutex);
+			if (!m_state->ready)
+			{
+				m_state->callbacks.emplace_back(std::move(callback));
+				return;
+			}
+		}
+
+		std::shared_ptr<State> state = m_state;
+		TaskScheduler::AddMainThreadTask([state, callback = std::move(callback)]()
+		{
+			callback(state->resource);
+		});
+	}
+
+	/*!
+	* \brief Blocks until the loading is over
+	*
+	* If the loading has not been started by a worker yet, it is executed by the calling thread instead of waiting for it.
+	* This makes waiting from a task safe, even when every worker is waiting on a future.
+	*
+	* \remark The future must be valid
+	*/
+	template<typename Type>
+	void ResourceFuture<Type>::Wait() const
+	{
+		NazaraAssert(IsValid(), "Invalid future");
+
+		if (IsReady())
+			return;
+
+		Load(m_state);
+
+		LockGuard lock(m_state->mutex);
+		while (!m_state->ready)
+			m_state->readyCondition.Wait(&m_state->mutex);
+	}
+
+	/*!
+	* \brief Starts loading a resource on the task scheduler
+	* \return Future of the resource
+	*
+	* \param loadFunction Function returning the loaded resource (or an invalid reference on failure), called by a worker thread (or by a thread waiting on the future)
+	*
+	* \remark If the task scheduler cannot be initialized, the loading is executed right away by the calling thread
+	*/
+	template<typename Type>
+	template<typename F>
+	ResourceFuture<Type> ResourceFuture<Type>::Async(F loadFunction)
+	{
+		ResourceFuture future;
+		future.m_state = std::make_shared<State>();
+		future.m_state->loadFunction = std::move(loadFunction);
+		future.m_state->ready = false;
+		future.m_state->started = false;
+
+		std::shared_ptr<State> state = future.m_state;
+		TaskScheduler::Spawn([state]()
+		{
+			Load(state);
+		});
+
+		return future;
+	}
+
+	template<typename Type>
+	void ResourceFuture<Type>::Complete(const std::shared_ptr<State>& state, ObjectRef<Type> resource)
+	{
+		LockGuard lock(state->mutex);
+
+		state->resource = std::move(resource);
+
+		// Callbacks are queued before the future becomes ready, so that running the main thread tasks after a Wait always executes them
+		if (!state->callbacks.empty())
+		{
+			TaskScheduler::AddMainThreadTask([state, callbacks = std::move(state->callbacks)]()
+			{
+				for (const Callback& callback : callbacks)
+					callback(state->resource);
+			});
+		}
+
+		state->ready.store(true, std::memory_order_release);
+		state->readyCondition.SignalAll();
+	}
+
+	template<typename Type>
+	void ResourceFuture<Type>::Load(const std::shared_ptr<State>& state)
+	{
+		// Either the task or a waiting thread runs the loading, whichever comes first
+		if (state->started.exchange(true))
+			return;
+
+		ObjectRef<Type> resource = state->loadFunction();
+		state->loadFunction = nullptr;
+
+		Complete(state, std::move(resource));
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -11,6 +11,7 @@
 #include <Nazara/Core/ObjectRef.hpp>
 #include <Nazara/Core/RefCounted.hpp>
 #include <Nazara/Core/Resource.hpp>
+#include <Nazara/Core/ResourceFuture.hpp>
 #include <Nazara/Core/ResourceParameters.hpp>
 #include <Nazara/Core/String.hpp>
 #include <list>
@@ -41,6 +42,7 @@ namespace Nz
 			static bool IsExtensionSupported(const String& extension);
 
 			static ObjectRef<Type> LoadFromFile(const String& filePath, const Parameters& parameters = Parameters());
+			static ResourceFuture<Type> LoadFromFileAsync(const String& filePath, const Parameters& parameters = Parameters());
 			static ObjectRef<Type> LoadFromMemory(const void* data, std::size_t size, const Parameters& parameters = Parameters());
 			static ObjectRef<Type> LoadFromStream(Stream& stream, const Parameters& parameters = Parameters());
 
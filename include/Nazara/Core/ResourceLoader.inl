@@ -2,9 +2,12 @@
 // This file is part of the "Nazara Engine - Core module"
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
+#include <Nazara/Core/Archive.hpp>
 #include <Nazara/Core/Config.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ErrorFlags.hpp>
 #include <Nazara/Core/File.hpp>
+#include <Nazara/Core/MappedFile.hpp>
 #include <Nazara/Core/MemoryView.hpp>
 #include <Nazara/Core/Stream.hpp>
 #include <Nazara/Core/Debug.hpp>
@@ -49,6 +52,9 @@ namespace Nz
 	* \remark Produces a NazaraError if parameters are invalid with NAZARA_CORE_SAFE defined
 	* \remark Produces a NazaraError if filePath has no extension
 	* \remark Produces a NazaraError if file count not be opened
+	* \remark The file is mapped in memory, loaders providing a memory loader parse it without any intermediate copy
+	* \remark Files which cannot be mapped (such as pipes) are read through a File, by stream loaders only
+	* \remark Files of mounted archives are loaded as well, by the loaders which do not require a file path
 	* \remark Produces a NazaraWarning if loader failed
 	* \remark Produces a NazaraError if all loaders failed or no loader was found
 	*/
@@ -65,7 +71,12 @@ namespace Nz
 			return nullptr;
 		}
 
-		File file(path); // Open only if needed
+		MappedFile mappedFile(path); // Open only if needed
+		File file; // Read instead of the mapping if the file cannot be mapped (pipes, special files, files too big for the address space)
+		Stream* stream = nullptr;
+
+		// Files stored in an archive are not on the disk, loaders requiring a path can't handle them
+		bool isArchived = (Archive::FindMountedEntry(mappedFile.GetPath()) != nullptr);
 
 		bool found = false;
 		for (Loader& loader : Type::s_loaders)
@@ -77,10 +88,25 @@ namespace Nz
 			StreamChecker checkFunc = std::get<1>(loader);
 			StreamLoader streamLoader = std::get<2>(loader);
 			FileLoader fileLoader = std::get<3>(loader);
+			MemoryLoader memoryLoader = std::get<4>(loader);
 
-			if (checkFunc && !file.IsOpen())
+			bool useFileLoader = (fileLoader && !isArchived);
+			if (!useFileLoader && !streamLoader && !memoryLoader)
+				continue;
+
+			if ((checkFunc || !useFileLoader) && !stream)
 			{
-				if (!file.Open(OpenMode_ReadOnly))
+				bool mapped;
+				{
+					ErrorFlags errFlags((isArchived) ? 0 : ErrorFlag_Silent); // Files on the disk which cannot be mapped are read instead
+					mapped = mappedFile.Open();
+				}
+
+				if (mapped)
+					stream = &mappedFile;
+				else if (!isArchived && file.Open(path, OpenMode_ReadOnly))
+					stream = &file;
+				else
 				{
 					NazaraError("Failed to load file: unable to open \"" + filePath + '"');
 					return nullptr;
@@ -88,13 +114,13 @@ namespace Nz
 			}
 
 			Ternary recognized = Ternary_Unknown;
-			if (fileLoader)
+			if (useFileLoader)
 			{
 				if (checkFunc)
 				{
-					file.SetCursorPos(0);
+					stream->SetCursorPos(0);
 
-					recognized = checkFunc(file, parameters);
+					recognized = checkFunc(*stream, parameters);
 					if (recognized == Ternary_False)
 						continue;
 					else
@@ -115,17 +141,32 @@ namespace Nz
 			}
 			else
 			{
-				file.SetCursorPos(0);
+				if (checkFunc)
+				{
+					stream->SetCursorPos(0);
 
-				recognized = checkFunc(file, parameters);
-				if (recognized == Ternary_False)
-					continue;
-				else if (recognized == Ternary_True)
+					recognized = checkFunc(*stream, parameters);
+					if (recognized == Ternary_False)
+						continue;
+					else if (recognized == Ternary_True)
+						found = true;
+				}
+				else
 					found = true;
 
-				file.SetCursorPos(0);
+				ObjectRef<Type> resource;
+				if (memoryLoader && stream == &mappedFile && mappedFile.GetSize() > 0)
+				{
+					// Parse straight from the mapping, without going through the stream interface
+					resource = memoryLoader(mappedFile.GetData(), static_cast<std::size_t>(mappedFile.GetSize()), parameters);
+				}
+				else if (streamLoader)
+				{
+					stream->SetCursorPos(0);
+
+					resource = streamLoader(*stream, parameters);
+				}
 
-				ObjectRef<Type> resource = streamLoader(file, parameters);
 				if (resource)
 				{
 					resource->SetFilePath(filePath);
@@ -145,6 +186,29 @@ namespace Nz
 		return nullptr;
 	}
 
+	/*!
+	* \brief Loads a resource from a file on a worker thread
+	* \return Future of the resource
+	*
+	* \param filePath Path to the resource
+	* \param parameters Parameters for the load
+	*
+	* \remark The loaders handling the file must be thread-safe, resources requiring the main thread (such as GPU ones) should be created from a ResourceFuture::Then callback
+	* \remark Errors are reported the same way LoadFromFile does, from the worker thread
+	*
+	* \see LoadFromFile
+	*/
+	template<typename Type, typename Parameters>
+	ResourceFuture<Type> ResourceLoader<Type, Parameters>::LoadFromFileAsync(const String& filePath, const Parameters& parameters)
+	{
+		NazaraAssert(parameters.IsValid(), "Invalid parameters");
+
+		return ResourceFuture<Type>::Async([filePath, parameters]()
+		{
+			return LoadFromFile(filePath, parameters);
+		});
+	}
+
 	/*!
 	* \brief Loads a resource from a raw memory, a size and parameters
 	* \return true if successfully loaded
@@ -8,6 +8,7 @@
 #define NAZARA_RESOURCEMANAGER_HPP
 
 #include <Nazara/Core/ObjectRef.hpp>
+#include <Nazara/Core/ResourceFuture.hpp>
 #include <Nazara/Core/ResourceParameters.hpp>
 #include <Nazara/Core/String.hpp>
 #include <unordered_map>
@@ -26,6 +27,7 @@ namespace Nz
 			static void Clear();
 
 			static ObjectRef<Type> Get(const String& filePath);
+			static ResourceFuture<Type> GetAsync(const String& filePath);
 			static const Parameters& GetDefaultParameters();
 
 			static void Purge();
@@ -37,7 +39,7 @@ namespace Nz
 			static bool Initialize();
 			static void Uninitialize();
 
-			using ManagerMap = std::unordered_map<String, ObjectRef<Type>>;
+			using ManagerMap = std::unordered_map<String, ResourceFuture<Type>>;
 			using ManagerParams = Parameters;
 	};
 }
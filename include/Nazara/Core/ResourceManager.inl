@@ -13,6 +13,8 @@ namespace Nz
 	* \ingroup core
 	* \class Nz::ResourceManager
 	* \brief Core class that represents a resource manager
+	*
+	* \remark The manager is not thread-safe, it must only be used from the main thread
 	*/
 
 	/*!
@@ -29,6 +31,8 @@ namespace Nz
 	* \return Reference to the object
 	*
 	* \param filePath Path to the asset that will be loaded
+	*
+	* \remark If the asset is being loaded asynchronously, this waits for the loading to end
 	*/
 	template<typename Type, typename Parameters>
 	ObjectRef<Type> ResourceManager<Type, Parameters>::Get(const String& filePath)
@@ -46,10 +50,55 @@ namespace Nz
 
 			NazaraDebug("Loaded resource from file " + absolutePath);
 
-			it = Type::s_managerMap.insert(std::make_pair(absolutePath, resource)).first;
+			Type::s_managerMap.insert(std::make_pair(absolutePath, ResourceFuture<Type>(resource)));
+			return resource;
 		}
 
-		return it->second;
+		ObjectRef<Type> resource = it->second.Get();
+		if (!resource)
+		{
+			// Asynchronous loading failed, forget about it so the next call tries again
+			NazaraError("Failed to load resource from file: " + absolutePath);
+			Type::s_managerMap.erase(it);
+		}
+
+		return resource;
+	}
+
+	/*!
+	* \brief Gets a future of the object loaded from file, loading it on a worker thread if needed
+	* \return Future of the object
+	*
+	* \param filePath Path to the asset that will be loaded
+	*
+	* \remark Requesting an asset which is already being loaded returns the future of the pending loading instead of loading it twice
+	* \remark The resource manager itself must only be used from the main thread
+	*
+	* \see ResourceLoader::LoadFromFileAsync
+	*/
+	template<typename Type, typename Parameters>
+	ResourceFuture<Type> ResourceManager<Type, Parameters>::GetAsync(const String& filePath)
+	{
+		String absolutePath = File::AbsolutePath(filePath);
+		auto it = Type::s_managerMap.find(absolutePath);
+		if (it != Type::s_managerMap.end())
+		{
+			const ResourceFuture<Type>& future = it->second;
+			if (!future.IsReady() || future.Get())
+				return future;
+
+			// A previous loading failed, try again
+			Type::s_managerMap.erase(it);
+		}
+
+		Parameters parameters = GetDefaultParameters();
+		ResourceFuture<Type> future = ResourceFuture<Type>::Async([absolutePath, parameters]()
+		{
+			return Type::LoadFromFile(absolutePath, parameters);
+		});
+
+		Type::s_managerMap.insert(std::make_pair(absolutePath, future));
+		return future;
 	}
 
 	/*!
@@ -71,8 +120,17 @@ namespace Nz
 		auto it = Type::s_managerMap.begin();
 		while (it != Type::s_managerMap.end())
 		{
-			const ObjectRef<Type>& ref = it->second;
-			if (ref->GetReferenceCount() == 1) // Are we the only ones to own the resource ?
+			const ResourceFuture<Type>& future = it->second;
+			if (!future.IsReady()) // Resources which are still loading are kept
+			{
+				++it;
+				continue;
+			}
+
+			ObjectRef<Type> ref = future.Get();
+			if (!ref) // Failed loading
+				Type::s_managerMap.erase(it++);
+			else if (ref->GetReferenceCount() == 2) // Are we the only ones to own the resource (besides our local reference) ?
 			{
 				NazaraDebug("Purging resource from file " + ref->GetFilePath());
 				Type::s_managerMap.erase(it++); // Then we erase it
@@ -93,7 +151,7 @@ namespace Nz
 	{
 		String absolutePath = File::AbsolutePath(filePath);
 
-		Type::s_managerMap[absolutePath] = resource;
+		Type::s_managerMap[absolutePath] = ResourceFuture<Type>(std::move(resource));
 	}
 
 	/*!
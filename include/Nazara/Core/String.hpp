@@ -41,9 +41,9 @@ namespace Nz
 			String(const char* string);
 			String(const char* string, std::size_t length);
 			String(const std::string& string);
-			String(const String& string) = default;
+			String(const String& string);
 			inline String(String&& string) noexcept;
-			~String() = default;
+			inline ~String();
 
 			String& Append(char character);
 			String& Append(const char* string);
@@ -303,26 +303,23 @@ namespace Nz
 			static const std::size_t npos;
 
 		private:
-			struct SharedString;
+			static constexpr std::size_t SmallCapacity = 23; //< Characters stored in the string itself, without heap allocation
 
-			String(std::shared_ptr<SharedString>&& sharedString);
+			inline bool IsSmall() const;
 
-			void EnsureOwnership(bool discardContent = false);
+			void Reallocate(std::size_t capacity);
 			inline void ReleaseString();
+			void ResetBuffer(std::size_t size);
 
-			static const std::shared_ptr<SharedString>& GetEmptyString();
+			static String CreateUninitialized(std::size_t size);
 
-			std::shared_ptr<SharedString> m_sharedString;
+			char* m_buffer; //< Either m_smallBuffer or a heap buffer of m_capacity + 1 characters
+			std::size_t m_size;
 
-			struct SharedString
+			union
 			{
-				inline SharedString();
-				inline SharedString(std::size_t strSize);
-				inline SharedString(std::size_t strSize, std::size_t strCapacity);
-
-				std::size_t capacity;
-				std::size_t size;
-				std::unique_ptr<char[]> string;
+				std::size_t m_capacity;
+				char m_smallBuffer[SmallCapacity + 1];
 			};
 	};
 
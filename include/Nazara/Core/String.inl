@@ -3,19 +3,45 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/AbstractHash.hpp>
+#include <cstring>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
 {
-	inline Nz::String::String(String&& string) noexcept :
-	m_sharedString(std::move(string.m_sharedString))
+	/*!
+	* \brief Constructs a String object by moving another one
+	*
+	* \param string String to move, empty after the call
+	*/
+
+	inline String::String(String&& string) noexcept :
+	m_size(string.m_size)
 	{
-		string.m_sharedString = GetEmptyString();
+		if (string.IsSmall())
+		{
+			m_buffer = m_smallBuffer;
+			std::memcpy(m_smallBuffer, string.m_smallBuffer, sizeof(m_smallBuffer));
+		}
+		else
+		{
+			m_buffer = string.m_buffer;
+			m_capacity = string.m_capacity;
+
+			string.m_buffer = string.m_smallBuffer;
+		}
+
+		string.m_size = 0;
+		string.m_smallBuffer[0] = '\0';
 	}
 
-	inline String::String(std::shared_ptr<SharedString>&& sharedString) :
-	m_sharedString(std::move(sharedString))
+	/*!
+	* \brief Destructs the object and frees its buffer
+	*/
+
+	inline String::~String()
 	{
+		if (!IsSmall())
+			delete[] m_buffer;
 	}
 
 	/*!
@@ -36,51 +62,29 @@ namespace Nz
 	}
 
 	/*!
-	* \brief Releases the content to the string
-	*/
-
-	inline void String::ReleaseString()
-	{
-		m_sharedString = GetEmptyString();
-	}
-
-	/*!
-	* \brief Constructs a SharedString object by default
+	* \brief Checks whether the characters are stored inside the string object
+	* \return true if no heap buffer is used
 	*/
 
-	inline String::SharedString::SharedString() : // Special case: empty string
-	capacity(0),
-	size(0)
+	inline bool String::IsSmall() const
 	{
+		return m_buffer == m_smallBuffer;
 	}
 
 	/*!
-	* \brief Constructs a SharedString object with a size
-	*
-	* \param strSize Number of characters in the string
+	* \brief Releases the content to the string
 	*/
 
-	inline String::SharedString::SharedString(std::size_t strSize) :
-	capacity(strSize),
-	size(strSize),
-	string(new char[strSize + 1])
+	inline void String::ReleaseString()
 	{
-		string[strSize] = '\0';
-	}
-
-	/*!
-	* \brief Constructs a SharedString object with a size and a capacity
-	*
-	* \param strSize Number of characters in the string
-	* \param strCapacity Capacity in characters in the string
-	*/
+		if (!IsSmall())
+		{
+			delete[] m_buffer;
+			m_buffer = m_smallBuffer;
+		}
 
-	inline String::SharedString::SharedString(std::size_t strSize, std::size_t strCapacity) :
-	capacity(strCapacity),
-	size(strSize),
-	string(new char[strCapacity + 1])
-	{
-		string[strSize] = '\0';
+		m_size = 0;
+		m_smallBuffer[0] = '\0';
 	}
 
 	/*!
@@ -9,27 +9,85 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Functor.hpp>
+#include <atomic>
+#include <functional>
+#include <type_traits>
 
 namespace Nz
 {
+	class TaskSchedulerImpl;
+
 	class NAZARA_CORE_API TaskScheduler
 	{
+		friend TaskSchedulerImpl;
+
 		public:
+			class Counter;
+
 			TaskScheduler() = delete;
 			~TaskScheduler() = delete;
 
 			template<typename F> static void AddTask(F function);
 			template<typename F, typename... Args> static void AddTask(F function, Args&&... args);
 			template<typename C> static void AddTask(void (C::*function)(), C* object);
+			static void AddMainThreadTask(std::function<void()> function);
 			static unsigned int GetWorkerCount();
 			static bool Initialize();
+			static bool IsWorkerThread();
 			static void Run();
+			static void RunMainThreadTasks();
 			static void SetWorkerCount(unsigned int workerCount);
+			template<typename F> static void Spawn(F function);
+			template<typename F> static void Spawn(Counter& counter, F function);
 			static void Uninitialize();
+			static void Wait(const Counter& counter);
 			static void WaitForTasks();
 
 		private:
-			static void AddTaskFunctor(Functor* taskFunctor);
+			struct Task;
+
+			template<typename F> static void EmplaceTask(Task* task, F&& function, std::true_type /*fitsInline*/);
+			template<typename F> static void EmplaceTask(Task* task, F&& function, std::false_type /*fitsInline*/);
+			template<typename F> static Task* CreateTask(F&& function);
+
+			static void AddPendingTask(Task* task);
+			static Task* AllocateTask();
+			static void SubmitDetachedTask(Task* task);
+			static void SubmitTask(Task* task, Counter& counter);
+
+			static constexpr std::size_t InlineStorageSize = 64;
+	};
+
+	class TaskScheduler::Counter
+	{
+		friend TaskScheduler;
+		friend TaskSchedulerImpl;
+
+		public:
+			inline Counter();
+			Counter(const Counter&) = delete;
+			Counter(Counter&&) = delete;
+			~Counter() = default;
+
+			inline unsigned int GetPendingCount() const;
+
+			inline bool IsDone() const;
+
+			Counter& operator=(const Counter&) = delete;
+			Counter& operator=(Counter&&) = delete;
+
+		private:
+			std::atomic<unsigned int> m_pendingTasks;
+	};
+
+	struct TaskScheduler::Task
+	{
+		using Executor = void (*)(Task* task, bool run);
+
+		Counter* counter;
+		Executor execute;
+		Task* next;
+		std::aligned_storage<InlineStorageSize>::type storage;
 	};
 }
 
@@ -2,6 +2,10 @@
 // This file is part of the "Nazara Engine - Core module"
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <tuple>
+#include <utility>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -21,7 +25,7 @@ namespace Nz
 	template<typename F>
 	void TaskScheduler::AddTask(F function)
 	{
-		AddTaskFunctor(new FunctorWithoutArgs<F>(function));
+		AddPendingTask(CreateTask(std::move(function)));
 	}
 
 	/*!
@@ -34,7 +38,12 @@ namespace Nz
 	template<typename F, typename... Args>
 	void TaskScheduler::AddTask(F function, Args&&... args)
 	{
-		AddTaskFunctor(new FunctorWithArgs<F, Args...>(function, std::forward<Args>(args)...));
+		std::tuple<Args...> arguments(std::forward<Args>(args)...);
+
+		AddPendingTask(CreateTask([function, arguments = std::move(arguments)]() mutable
+		{
+			Apply(function, arguments);
+		}));
 	}
 
 	/*!
@@ -47,7 +56,122 @@ namespace Nz
 	template<typename C>
 	void TaskScheduler::AddTask(void (C::*function)(), C* object)
 	{
-		AddTaskFunctor(new MemberWithoutArgs<C>(function, object));
+		AddPendingTask(CreateTask([function, object]()
+		{
+			(object->*function)();
+		}));
+	}
+
+	/*!
+	* \brief Starts a task right away, without tracking it
+	*
+	* Nothing can wait for such a task, it has to signal its completion by itself if needed.
+	* Detached tasks are all executed before the scheduler is uninitialized.
+	*
+	* \param function Task that the pool will execute
+	*/
+
+	template<typename F>
+	void TaskScheduler::Spawn(F function)
+	{
+		SubmitDetachedTask(CreateTask(std::move(function)));
+	}
+
+	/*!
+	* \brief Starts a task right away, tracking it with a counter
+	*
+	* Unlike AddTask, the task does not wait for a call to Run and is not part of the WaitForTasks barrier.
+	* When called from a task, the new task is pushed on the current worker queue, which makes it possible to split work recursively.
+	*
+	* \param counter Counter which will track the task, it must outlive the task
+	* \param function Task that the pool will execute
+	*
+	* \see Wait
+	*/
+
+	template<typename F>
+	void TaskScheduler::Spawn(Counter& counter, F function)
+	{
+		SubmitTask(CreateTask(std::move(function)), counter);
+	}
+
+	template<typename F>
+	void TaskScheduler::EmplaceTask(Task* task, F&& function, std::true_type /*fitsInline*/)
+	{
+		using Function = std::decay_t<F>;
+
+		PlacementNew(reinterpret_cast<Function*>(&task->storage), std::forward<F>(function));
+		task->execute = [](Task* taskToExecute, bool run)
+		{
+			Function* func = reinterpret_cast<Function*>(&taskToExecute->storage);
+			if (run)
+				(*func)();
+
+			PlacementDestroy(func);
+		};
+	}
+
+	template<typename F>
+	void TaskScheduler::EmplaceTask(Task* task, F&& function, std::false_type /*fitsInline*/)
+	{
+		using Function = std::decay_t<F>;
+
+		// Too big to fit in the task, fallback on a heap-allocated functor
+		PlacementNew(reinterpret_cast<Functor**>(&task->storage), new FunctorWithoutArgs<Function>(std::forward<F>(function)));
+		task->execute = [](Task* taskToExecute, bool run)
+		{
+			Functor* functor = *reinterpret_cast<Functor**>(&taskToExecute->storage);
+			if (run)
+				functor->Run();
+
+			delete functor;
+		};
+	}
+
+	template<typename F>
+	TaskScheduler::Task* TaskScheduler::CreateTask(F&& function)
+	{
+		using Function = std::decay_t<F>;
+		using FitsInline = std::integral_constant<bool, sizeof(Function) <= InlineStorageSize && alignof(Function) <= alignof(decltype(Task::storage))>;
+
+		Task* task = AllocateTask();
+		EmplaceTask(task, std::forward<F>(function), FitsInline());
+
+		return task;
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::TaskScheduler::Counter
+	* \brief Core class that tracks the completion of a group of tasks
+	*
+	* Every task spawned with a counter increments it, and decrements it once done.
+	*/
+
+	/*!
+	* \brief Constructs a Counter object with no pending task
+	*/
+	inline TaskScheduler::Counter::Counter() :
+	m_pendingTasks(0)
+	{
+	}
+
+	/*!
+	* \brief Gets the number of tasks tracked by this counter which are not done yet
+	* \return Number of pending tasks
+	*/
+	inline unsigned int TaskScheduler::Counter::GetPendingCount() const
+	{
+		return m_pendingTasks.load(std::memory_order_acquire);
+	}
+
+	/*!
+	* \brief Checks whether all tasks tracked by this counter are done
+	* \return true if no task is pending
+	*/
+	inline bool TaskScheduler::Counter::IsDone() const
+	{
+		return GetPendingCount() == 0;
 	}
 }
 
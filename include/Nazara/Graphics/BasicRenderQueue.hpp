@@ -35,6 +35,8 @@ namespace Nz
 			struct BillboardData;
 
 			BasicRenderQueue() = default;
+			BasicRenderQueue(const BasicRenderQueue&) = delete;
+			BasicRenderQueue(BasicRenderQueue&&) noexcept = default;
 			~BasicRenderQueue() = default;
 
 			void AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const Vector2f> sizePtr, SparsePtr<const Vector2f> sinCosPtr = nullptr, SparsePtr<const Color> colorPtr = nullptr) override;
@@ -48,6 +50,7 @@ namespace Nz
 			void AddDrawable(int renderOrder, const Drawable* drawable) override;
 			void AddMesh(int renderOrder, const Material* material, const MeshData& meshData, const Boxf& meshAABB, const Matrix4f& transformMatrix, const Recti& scissorRect) override;
 			void AddSprites(int renderOrder, const Material* material, const VertexStruct_XYZ_Color_UV* vertices, std::size_t spriteCount, const Recti& scissorRect, const Texture* overlay = nullptr) override;
+			void AddToRenderQueue(AbstractRenderQueue* renderQueue) const;
 
 			void Clear(bool fully = false) override;
 
@@ -55,6 +58,9 @@ namespace Nz
 
 			void Sort(const AbstractViewer* viewer);
 
+			BasicRenderQueue& operator=(const BasicRenderQueue&) = delete;
+			BasicRenderQueue& operator=(BasicRenderQueue&&) noexcept = default;
+
 			struct BillboardData
 			{
 				Color color;
@@ -95,6 +101,7 @@ namespace Nz
 			{
 				int layerIndex;
 				MeshData meshData;
+				Nz::Boxf meshAABB;
 				MovablePtr<const Nz::Material> material;
 				Nz::Matrix4f matrix;
 				Nz::Recti scissorRect;
@@ -122,15 +129,9 @@ namespace Nz
 			inline Vector2f ComputeSinCos(float angle);
 			inline Vector2f ComputeSize(float size);
 
-			inline void RegisterLayer(int layerIndex);
+			inline UInt64 GetLayerSortIndex(int layerIndex) const;
 
-			std::unordered_map<const MaterialPipeline*, std::size_t> m_pipelineCache;
-			std::unordered_map<const Material*, std::size_t> m_materialCache;
-			std::unordered_map<const Texture*, std::size_t> m_overlayCache;
-			std::unordered_map<const UberShader*, std::size_t> m_shaderCache;
-			std::unordered_map<const Texture*, std::size_t> m_textureCache;
-			std::unordered_map<const VertexBuffer*, std::size_t> m_vertexBufferCache;
-			std::unordered_map<int, std::size_t> m_layerCache;
+			inline void RegisterLayer(int layerIndex);
 
 			std::vector<BillboardData> m_billboards;
 			std::vector<int> m_renderLayers;
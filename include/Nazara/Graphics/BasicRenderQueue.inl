@@ -29,6 +29,15 @@ namespace Nz
 		return Vector2f(size, size);
 	}
 
+	inline UInt64 BasicRenderQueue::GetLayerSortIndex(int layerIndex) const
+	{
+		// Layers are kept sorted, their position is their sort index
+		auto it = std::lower_bound(m_renderLayers.begin(), m_renderLayers.end(), layerIndex);
+		assert(it != m_renderLayers.end() && *it == layerIndex);
+
+		return static_cast<UInt64>(it - m_renderLayers.begin());
+	}
+
 	inline void BasicRenderQueue::RegisterLayer(int layerIndex)
 	{
 		auto it = std::lower_bound(m_renderLayers.begin(), m_renderLayers.end(), layerIndex);
@@ -8,10 +8,15 @@
 #define NAZARA_CULLINGLIST_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Bitset.hpp>
+#include <Nazara/Core/FrameArena.hpp>
+#include <Nazara/Core/FrameArenaAllocator.hpp>
 #include <Nazara/Core/Signal.hpp>
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Graphics/Enums.hpp>
+#include <Nazara/Graphics/FrustumCulling.hpp>
 #include <Nazara/Math/BoundingVolume.hpp>
+#include <Nazara/Math/BoxTree.hpp>
 #include <Nazara/Math/Frustum.hpp>
 #include <Nazara/Math/Sphere.hpp>
 #include <vector>
@@ -34,15 +39,17 @@ namespace Nz
 			friend SphereEntry;
 			friend VolumeEntry;
 
-			using ResultContainer = std::vector<const T*>;
+			using ResultContainer = std::vector<const T*, FrameArenaAllocator<const T*>>;
 
-			CullingList() = default;
+			CullingList();
 			CullingList(const CullingList& renderable) = delete;
 			CullingList(CullingList&& renderable) = delete;
 			~CullingList();
 
 			std::size_t Cull(const Frustumf& frustum, bool* forceInvalidation = nullptr);
 
+			void EnableBoxTree(bool enable, float margin = 0.f);
+
 			std::size_t FillWithAllEntries(bool* forceInvalidation = nullptr);
 
 			const ResultContainer& GetFullyVisibleResults() const;
@@ -53,6 +60,8 @@ namespace Nz
 			SphereEntry RegisterSphereTest(const T* renderable);
 			VolumeEntry RegisterVolumeTest(const T* renderable);
 
+			inline bool IsBoxTreeEnabled() const;
+
 			CullingList& operator=(const CullingList& renderable) = delete;
 			CullingList& operator=(CullingList&& renderable) = delete;
 
@@ -65,12 +74,16 @@ namespace Nz
 			inline void NotifyRelease(CullTest type, std::size_t index);
 			inline void NotifySphereUpdate(std::size_t index, const Spheref& sphere);
 			inline void NotifyVolumeUpdate(std::size_t index, const BoundingVolumef& boundingVolume);
+			void QueryBoxTree(const Frustumf& frustum);
+			void ResetResults();
+
+			static inline Boxf GetSphereBox(const Spheref& sphere);
 
 			struct BoxVisibilityEntry
 			{
-				Boxf box;
 				BoxEntry* entry;
 				const T* renderable;
+				std::size_t treeProxy;
 				bool forceInvalidation;
 			};
 
@@ -83,9 +96,9 @@ namespace Nz
 
 			struct SphereVisibilityEntry
 			{
-				Spheref sphere;
 				SphereEntry* entry;
 				const T* renderable;
+				std::size_t treeProxy;
 				bool forceInvalidation;
 			};
 
@@ -98,11 +111,21 @@ namespace Nz
 			};
 
 			std::vector<BoxVisibilityEntry> m_boxTestList;
+			std::vector<IntersectionSide> m_intersectionSides;
 			std::vector<NoTestVisibilityEntry> m_noTestList;
 			std::vector<SphereVisibilityEntry> m_sphereTestList;
 			std::vector<VolumeVisibilityEntry> m_volumeTestList;
+			std::vector<float> m_boxBounds; //< Bounds of box entries, see FrustumCulling
+			std::vector<float> m_sphereBounds; //< Bounds of sphere entries, see FrustumCulling
+			Bitset<UInt64> m_fullyVisibleBoxes;
+			Bitset<UInt64> m_fullyVisibleSpheres;
+			Bitset<UInt64> m_partiallyVisibleBoxes;
+			Bitset<UInt64> m_partiallyVisibleSpheres;
+			BoxTreef m_boxTree; //< User data is the entry index shifted by one bit, the lowest bit being set for sphere entries
+			FrameArena m_resultArena; //< Must be declared before the result containers
 			ResultContainer m_fullyVisibleResults;
 			ResultContainer m_partiallyVisibleResults;
+			bool m_isBoxTreeEnabled = false;
 	};
 
 	template<typename T>
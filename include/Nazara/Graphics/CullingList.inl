@@ -7,6 +7,13 @@
 
 namespace Nz
 {
+	template<typename T>
+	CullingList<T>::CullingList() :
+	m_fullyVisibleResults(FrameArenaAllocator<const T*>(m_resultArena)),
+	m_partiallyVisibleResults(FrameArenaAllocator<const T*>(m_resultArena))
+	{
+	}
+
 	template<typename T>
 	CullingList<T>::~CullingList()
 	{
@@ -16,8 +23,7 @@ namespace Nz
 	template<typename T>
 	std::size_t CullingList<T>::Cull(const Frustumf& frustum, bool* forceInvalidation)
 	{
-		m_fullyVisibleResults.clear();
-		m_partiallyVisibleResults.clear();
+		ResetResults();
 
 		bool forcedInvalidation = false;
 
@@ -29,9 +35,9 @@ namespace Nz
 			return currentHash * 23 + newHash;
 		};
 
-		for (BoxVisibilityEntry& entry : m_boxTestList)
+		auto AddResult = [&](auto& entry, IntersectionSide side)
 		{
-			switch (frustum.Intersect(entry.box))
+			switch (side)
 			{
 				case IntersectionSide_Inside:
 					m_fullyVisibleResults.push_back(entry.renderable);
@@ -52,6 +58,31 @@ namespace Nz
 				case IntersectionSide_Outside:
 					break;
 			}
+		};
+
+		// Entries found by the box tree are added in list order, giving the same results (and hash) as testing every entry
+		auto AddTreeResults = [&](auto& testList, const Bitset<UInt64>& fullyVisibleEntries, const Bitset<UInt64>& partiallyVisibleEntries)
+		{
+			for (std::size_t i = fullyVisibleEntries.FindFirst(); i != fullyVisibleEntries.npos; i = fullyVisibleEntries.FindNext(i))
+				AddResult(testList[i], IntersectionSide_Inside);
+
+			for (std::size_t i = partiallyVisibleEntries.FindFirst(); i != partiallyVisibleEntries.npos; i = partiallyVisibleEntries.FindNext(i))
+				AddResult(testList[i], IntersectionSide_Intersecting);
+		};
+
+		if (m_isBoxTreeEnabled)
+		{
+			QueryBoxTree(frustum);
+
+			AddTreeResults(m_boxTestList, m_fullyVisibleBoxes, m_partiallyVisibleBoxes);
+		}
+		else
+		{
+			m_intersectionSides.resize(m_boxTestList.size());
+			FrustumCulling::IntersectBoxes(frustum, m_boxBounds.data(), m_boxTestList.size(), m_intersectionSides.data());
+
+			for (std::size_t i = 0; i < m_boxTestList.size(); ++i)
+				AddResult(m_boxTestList[i], m_intersectionSides[i]);
 		}
 
 		for (NoTestVisibilityEntry& entry : m_noTestList)
@@ -66,67 +97,65 @@ namespace Nz
 			}
 		}
 
-		for (SphereVisibilityEntry& entry : m_sphereTestList)
+		if (m_isBoxTreeEnabled)
+			AddTreeResults(m_sphereTestList, m_fullyVisibleSpheres, m_partiallyVisibleSpheres);
+		else
 		{
-			switch (frustum.Intersect(entry.sphere))
-			{
-				case IntersectionSide_Inside:
-					m_fullyVisibleResults.push_back(entry.renderable);
-					fullyVisibleHash = CombineHash(fullyVisibleHash, std::hash<const T*>()(entry.renderable));
-
-					forcedInvalidation = forcedInvalidation | entry.forceInvalidation;
-					entry.forceInvalidation = false;
-					break;
+			m_intersectionSides.resize(m_sphereTestList.size());
+			FrustumCulling::IntersectSpheres(frustum, m_sphereBounds.data(), m_sphereTestList.size(), m_intersectionSides.data());
 
-				case IntersectionSide_Intersecting:
-					m_partiallyVisibleResults.push_back(entry.renderable);
-					partiallyVisibleHash = CombineHash(partiallyVisibleHash, std::hash<const T*>()(entry.renderable));
-
-					forcedInvalidation = forcedInvalidation | entry.forceInvalidation;
-					entry.forceInvalidation = false;
-					break;
-
-				case IntersectionSide_Outside:
-					break;
-			}
+			for (std::size_t i = 0; i < m_sphereTestList.size(); ++i)
+				AddResult(m_sphereTestList[i], m_intersectionSides[i]);
 		}
-		
+
 		for (VolumeVisibilityEntry& entry : m_volumeTestList)
-		{
-			switch (frustum.Intersect(entry.volume))
-			{
-				case IntersectionSide_Inside:
-					m_fullyVisibleResults.push_back(entry.renderable);
-					fullyVisibleHash = CombineHash(fullyVisibleHash, std::hash<const T*>()(entry.renderable));
+			AddResult(entry, frustum.Intersect(entry.volume));
 
-					forcedInvalidation = forcedInvalidation | entry.forceInvalidation;
-					entry.forceInvalidation = false;
-					break;
+		if (forceInvalidation)
+			*forceInvalidation = forcedInvalidation;
 
-				case IntersectionSide_Intersecting:
-					m_partiallyVisibleResults.push_back(entry.renderable);
-					partiallyVisibleHash = CombineHash(partiallyVisibleHash, std::hash<const T*>()(entry.renderable));
+		return 5 + partiallyVisibleHash * 17 + fullyVisibleHash;
+	}
 
-					forcedInvalidation = forcedInvalidation | entry.forceInvalidation;
-					entry.forceInvalidation = false;
-					break;
+	/*!
+	* \brief Enables or disables the box tree used to cull box and sphere entries
+	*
+	* When enabled, box and sphere entries are stored in a bounding volume hierarchy (see BoxTree), updated along with the entries,
+	* allowing Cull to skip whole groups of entries outside of the frustum instead of testing every one of them.
+	* Culling results are the same with or without the tree.
+	*
+	* \param enable Should the box tree be used
+	* \param margin Distance by which boxes are enlarged in the tree, a higher margin reduces the cost of moving entries but makes culling less precise
+	*/
+	template<typename T>
+	void CullingList<T>::EnableBoxTree(bool enable, float margin)
+	{
+		m_boxTree.Clear();
+		m_boxTree.SetMargin(margin);
 
-				case IntersectionSide_Outside:
-					break;
-			}
-		}
+		if (enable)
+		{
+			for (std::size_t i = 0; i < m_boxTestList.size(); ++i)
+				m_boxTestList[i].treeProxy = m_boxTree.Insert(FrustumCulling::GetBox(m_boxBounds.data(), i), i << 1);
 
-		if (forceInvalidation)
-			*forceInvalidation = forcedInvalidation;
+			for (std::size_t i = 0; i < m_sphereTestList.size(); ++i)
+				m_sphereTestList[i].treeProxy = m_boxTree.Insert(GetSphereBox(FrustumCulling::GetSphere(m_sphereBounds.data(), i)), (i << 1) | 1);
+		}
+		else
+		{
+			m_fullyVisibleBoxes.Clear();
+			m_fullyVisibleSpheres.Clear();
+			m_partiallyVisibleBoxes.Clear();
+			m_partiallyVisibleSpheres.Clear();
+		}
 
-		return 5 + partiallyVisibleHash * 17 + fullyVisibleHash;
+		m_isBoxTreeEnabled = enable;
 	}
 
 	template<typename T>
 	std::size_t CullingList<T>::FillWithAllEntries(bool* forceInvalidation)
 	{
-		m_fullyVisibleResults.clear();
-		m_partiallyVisibleResults.clear();
+		ResetResults();
 
 		bool forcedInvalidation = false;
 
@@ -170,8 +199,14 @@ namespace Nz
 	template<typename T>
 	auto CullingList<T>::RegisterBoxTest(const T* renderable) -> BoxEntry
 	{
-		BoxEntry newEntry(this, m_boxTestList.size());
-		m_boxTestList.emplace_back(BoxVisibilityEntry{ Nz::Boxf(), &newEntry, renderable, false }); //< Address of entry will be updated when moving
+		std::size_t index = m_boxTestList.size();
+		std::size_t treeProxy = (m_isBoxTreeEnabled) ? m_boxTree.Insert(Nz::Boxf::Zero(), index << 1) : BoxTreef::InvalidProxy;
+
+		BoxEntry newEntry(this, index);
+		m_boxTestList.emplace_back(BoxVisibilityEntry{ &newEntry, renderable, treeProxy, false }); //< Address of entry will be updated when moving
+
+		m_boxBounds.resize(FrustumCulling::GetBoxBoundsSize(index + 1));
+		FrustumCulling::SetBox(m_boxBounds.data(), index, Nz::Boxf::Zero());
 
 		return newEntry;
 	}
@@ -188,8 +223,14 @@ namespace Nz
 	template<typename T>
 	auto CullingList<T>::RegisterSphereTest(const T* renderable) -> SphereEntry
 	{
-		SphereEntry newEntry(this, m_sphereTestList.size());
-		m_sphereTestList.emplace_back(SphereVisibilityEntry{Nz::Spheref(), &newEntry, renderable, false}); //< Address of entry will be updated when moving
+		std::size_t index = m_sphereTestList.size();
+		std::size_t treeProxy = (m_isBoxTreeEnabled) ? m_boxTree.Insert(Nz::Boxf::Zero(), (index << 1) | 1) : BoxTreef::InvalidProxy;
+
+		SphereEntry newEntry(this, index);
+		m_sphereTestList.emplace_back(SphereVisibilityEntry{&newEntry, renderable, treeProxy, false}); //< Address of entry will be updated when moving
+
+		m_sphereBounds.resize(FrustumCulling::GetSphereBoundsSize(index + 1));
+		FrustumCulling::SetSphere(m_sphereBounds.data(), index, Nz::Spheref::Zero());
 
 		return newEntry;
 	}
@@ -203,10 +244,19 @@ namespace Nz
 		return newEntry;
 	}
 
+	template<typename T>
+	inline bool CullingList<T>::IsBoxTreeEnabled() const
+	{
+		return m_isBoxTreeEnabled;
+	}
+
 	template<typename T>
 	inline void CullingList<T>::NotifyBoxUpdate(std::size_t index, const Boxf& box)
 	{
-		m_boxTestList[index].box = box;
+		FrustumCulling::SetBox(m_boxBounds.data(), index, box);
+
+		if (m_isBoxTreeEnabled)
+			m_boxTree.Update(m_boxTestList[index].treeProxy, box);
 	}
 
 	template<typename T>
@@ -300,9 +350,20 @@ namespace Nz
 		{
 			case CullTest::Box:
 			{
+				if (m_isBoxTreeEnabled)
+					m_boxTree.Remove(m_boxTestList[index].treeProxy);
+
+				std::size_t lastIndex = m_boxTestList.size() - 1;
+				FrustumCulling::CopyBox(m_boxBounds.data(), lastIndex, index);
+				m_boxBounds.resize(FrustumCulling::GetBoxBoundsSize(lastIndex));
+
 				m_boxTestList[index] = std::move(m_boxTestList.back());
 				m_boxTestList[index].entry->UpdateIndex(index);
 				m_boxTestList.pop_back();
+
+				if (m_isBoxTreeEnabled && index < m_boxTestList.size())
+					m_boxTree.SetUserData(m_boxTestList[index].treeProxy, index << 1);
+
 				break;
 			}
 
@@ -316,9 +377,20 @@ namespace Nz
 
 			case CullTest::Sphere:
 			{
+				if (m_isBoxTreeEnabled)
+					m_boxTree.Remove(m_sphereTestList[index].treeProxy);
+
+				std::size_t lastIndex = m_sphereTestList.size() - 1;
+				FrustumCulling::CopySphere(m_sphereBounds.data(), lastIndex, index);
+				m_sphereBounds.resize(FrustumCulling::GetSphereBoundsSize(lastIndex));
+
 				m_sphereTestList[index] = std::move(m_sphereTestList.back());
 				m_sphereTestList[index].entry->UpdateIndex(index);
 				m_sphereTestList.pop_back();
+
+				if (m_isBoxTreeEnabled && index < m_sphereTestList.size())
+					m_boxTree.SetUserData(m_sphereTestList[index].treeProxy, (index << 1) | 1);
+
 				break;
 			}
 
@@ -339,7 +411,10 @@ namespace Nz
 	template<typename T>
 	void CullingList<T>::NotifySphereUpdate(std::size_t index, const Spheref& sphere)
 	{
-		m_sphereTestList[index].sphere = sphere;
+		FrustumCulling::SetSphere(m_sphereBounds.data(), index, sphere);
+
+		if (m_isBoxTreeEnabled)
+			m_boxTree.Update(m_sphereTestList[index].treeProxy, GetSphereBox(sphere));
 	}
 
 	template<typename T>
@@ -348,6 +423,65 @@ namespace Nz
 		m_volumeTestList[index].volume = boundingVolume;
 	}
 
+	template<typename T>
+	void CullingList<T>::QueryBoxTree(const Frustumf& frustum)
+	{
+		m_fullyVisibleBoxes.Clear();
+		m_fullyVisibleBoxes.Resize(m_boxTestList.size());
+		m_partiallyVisibleBoxes.Clear();
+		m_partiallyVisibleBoxes.Resize(m_boxTestList.size());
+
+		m_fullyVisibleSpheres.Clear();
+		m_fullyVisibleSpheres.Resize(m_sphereTestList.size());
+		m_partiallyVisibleSpheres.Clear();
+		m_partiallyVisibleSpheres.Resize(m_sphereTestList.size());
+
+		m_boxTree.Query(frustum, [&](std::size_t userData, IntersectionSide side)
+		{
+			std::size_t index = userData >> 1;
+			bool isSphere = (userData & 1) != 0;
+
+			// Entries whose tree box is not completely inside the frustum are tested with their exact volume
+			if (side != IntersectionSide_Inside)
+				side = (isSphere) ? FrustumCulling::IntersectSphere(frustum, m_sphereBounds.data(), index) : FrustumCulling::IntersectBox(frustum, m_boxBounds.data(), index);
+
+			switch (side)
+			{
+				case IntersectionSide_Inside:
+					((isSphere) ? m_fullyVisibleSpheres : m_fullyVisibleBoxes).Set(index);
+					break;
+
+				case IntersectionSide_Intersecting:
+					((isSphere) ? m_partiallyVisibleSpheres : m_partiallyVisibleBoxes).Set(index);
+					break;
+
+				case IntersectionSide_Outside:
+					break;
+			}
+		});
+	}
+
+	template<typename T>
+	void CullingList<T>::ResetResults()
+	{
+		// Previous results are dropped at once, their memory being reclaimed by the arena reset (containers can still be reassigned)
+		m_fullyVisibleResults = ResultContainer(FrameArenaAllocator<const T*>(m_resultArena));
+		m_partiallyVisibleResults = ResultContainer(FrameArenaAllocator<const T*>(m_resultArena));
+
+		m_resultArena.Reset();
+
+		// Every entry may end up in either list, reserving them up front makes each list a single arena allocation
+		std::size_t entryCount = m_boxTestList.size() + m_noTestList.size() + m_sphereTestList.size() + m_volumeTestList.size();
+		m_fullyVisibleResults.reserve(entryCount);
+		m_partiallyVisibleResults.reserve(entryCount);
+	}
+
+	template<typename T>
+	Boxf CullingList<T>::GetSphereBox(const Spheref& sphere)
+	{
+		return Boxf(sphere.x - sphere.radius, sphere.y - sphere.radius, sphere.z - sphere.radius, sphere.radius * 2.f, sphere.radius * 2.f, sphere.radius * 2.f);
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 
 	template<typename T>
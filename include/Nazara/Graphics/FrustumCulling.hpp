@@ -0,0 +1,49 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_FRUSTUMCULLING_HPP
+#define NAZARA_FRUSTUMCULLING_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/Enums.hpp>
+#include <Nazara/Math/Frustum.hpp>
+#include <Nazara/Math/Sphere.hpp>
+
+namespace Nz
+{
+	class NAZARA_GRAPHICS_API FrustumCulling
+	{
+		public:
+			FrustumCulling() = delete;
+			~FrustumCulling() = delete;
+
+			static inline void CopyBox(float* boxBounds, std::size_t source, std::size_t destination);
+			static inline void CopySphere(float* sphereBounds, std::size_t source, std::size_t destination);
+
+			static inline Boxf GetBox(const float* boxBounds, std::size_t index);
+			static inline std::size_t GetBoxBoundsSize(std::size_t boxCount);
+			static inline Spheref GetSphere(const float* sphereBounds, std::size_t index);
+			static inline std::size_t GetSphereBoundsSize(std::size_t sphereCount);
+
+			static IntersectionSide IntersectBox(const Frustumf& frustum, const float* boxBounds, std::size_t index);
+			static void IntersectBoxes(const Frustumf& frustum, const float* boxBounds, std::size_t boxCount, IntersectionSide* sides);
+			static IntersectionSide IntersectSphere(const Frustumf& frustum, const float* sphereBounds, std::size_t index);
+			static void IntersectSpheres(const Frustumf& frustum, const float* sphereBounds, std::size_t sphereCount, IntersectionSide* sides);
+
+			static inline void SetBox(float* boxBounds, std::size_t index, const Boxf& box);
+			static inline void SetSphere(float* sphereBounds, std::size_t index, const Spheref& sphere);
+
+			static constexpr std::size_t BatchSize = 4;
+			static constexpr std::size_t BoxBatchStride = 6 * BatchSize;
+			static constexpr std::size_t SphereBatchStride = 4 * BatchSize;
+	};
+}
+
+#include <Nazara/Graphics/FrustumCulling.inl>
+
+#endif // NAZARA_FRUSTUMCULLING_HPP
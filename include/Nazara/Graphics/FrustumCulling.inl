@@ -0,0 +1,133 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/FrustumCulling.hpp>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Copies a box to another index of bounds arrays
+	*
+	* \param boxBounds Box bounds arrays
+	* \param source Index of the box to copy
+	* \param destination Index receiving the box
+	*/
+	inline void FrustumCulling::CopyBox(float* boxBounds, std::size_t source, std::size_t destination)
+	{
+		const float* sourceBatch = &boxBounds[(source / BatchSize) * BoxBatchStride + source % BatchSize];
+		float* destinationBatch = &boxBounds[(destination / BatchSize) * BoxBatchStride + destination % BatchSize];
+
+		for (std::size_t i = 0; i < 6; ++i)
+			destinationBatch[i * BatchSize] = sourceBatch[i * BatchSize];
+	}
+
+	/*!
+	* \brief Copies a sphere to another index of bounds arrays
+	*
+	* \param sphereBounds Sphere bounds arrays
+	* \param source Index of the sphere to copy
+	* \param destination Index receiving the sphere
+	*/
+	inline void FrustumCulling::CopySphere(float* sphereBounds, std::size_t source, std::size_t destination)
+	{
+		const float* sourceBatch = &sphereBounds[(source / BatchSize) * SphereBatchStride + source % BatchSize];
+		float* destinationBatch = &sphereBounds[(destination / BatchSize) * SphereBatchStride + destination % BatchSize];
+
+		for (std::size_t i = 0; i < 4; ++i)
+			destinationBatch[i * BatchSize] = sourceBatch[i * BatchSize];
+	}
+
+	/*!
+	* \brief Gets a box from bounds arrays
+	* \return Box stored at this index
+	*
+	* \param boxBounds Box bounds arrays
+	* \param index Index of the box
+	*/
+	inline Boxf FrustumCulling::GetBox(const float* boxBounds, std::size_t index)
+	{
+		const float* batch = &boxBounds[(index / BatchSize) * BoxBatchStride + index % BatchSize];
+
+		Vector3f minimum(batch[0 * BatchSize], batch[1 * BatchSize], batch[2 * BatchSize]);
+		Vector3f maximum(batch[3 * BatchSize], batch[4 * BatchSize], batch[5 * BatchSize]);
+
+		return Boxf(minimum.x, minimum.y, minimum.z, maximum.x - minimum.x, maximum.y - minimum.y, maximum.z - minimum.z);
+	}
+
+	/*!
+	* \brief Gets the number of floats required to store box bounds
+	* \return Size of the bounds arrays, always a multiple of BoxBatchStride
+	*
+	* \param boxCount Number of boxes
+	*/
+	inline std::size_t FrustumCulling::GetBoxBoundsSize(std::size_t boxCount)
+	{
+		return (boxCount + BatchSize - 1) / BatchSize * BoxBatchStride;
+	}
+
+	/*!
+	* \brief Gets a sphere from bounds arrays
+	* \return Sphere stored at this index
+	*
+	* \param sphereBounds Sphere bounds arrays
+	* \param index Index of the sphere
+	*/
+	inline Spheref FrustumCulling::GetSphere(const float* sphereBounds, std::size_t index)
+	{
+		const float* batch = &sphereBounds[(index / BatchSize) * SphereBatchStride + index % BatchSize];
+
+		return Spheref(batch[0 * BatchSize], batch[1 * BatchSize], batch[2 * BatchSize], batch[3 * BatchSize]);
+	}
+
+	/*!
+	* \brief Gets the number of floats required to store sphere bounds
+	* \return Size of the bounds arrays, always a multiple of SphereBatchStride
+	*
+	* \param sphereCount Number of spheres
+	*/
+	inline std::size_t FrustumCulling::GetSphereBoundsSize(std::size_t sphereCount)
+	{
+		return (sphereCount + BatchSize - 1) / BatchSize * SphereBatchStride;
+	}
+
+	/*!
+	* \brief Stores a box in bounds arrays
+	*
+	* \param boxBounds Box bounds arrays, holding at least GetBoxBoundsSize(index + 1) floats
+	* \param index Index of the box
+	* \param box Box to store
+	*/
+	inline void FrustumCulling::SetBox(float* boxBounds, std::size_t index, const Boxf& box)
+	{
+		float* batch = &boxBounds[(index / BatchSize) * BoxBatchStride + index % BatchSize];
+
+		// Maximum is computed like Box::GetPositiveVertex does, to get the same results as Frustum::Intersect
+		batch[0 * BatchSize] = box.x;
+		batch[1 * BatchSize] = box.y;
+		batch[2 * BatchSize] = box.z;
+		batch[3 * BatchSize] = box.x + box.width;
+		batch[4 * BatchSize] = box.y + box.height;
+		batch[5 * BatchSize] = box.z + box.depth;
+	}
+
+	/*!
+	* \brief Stores a sphere in bounds arrays
+	*
+	* \param sphereBounds Sphere bounds arrays, holding at least GetSphereBoundsSize(index + 1) floats
+	* \param index Index of the sphere
+	* \param sphere Sphere to store
+	*/
+	inline void FrustumCulling::SetSphere(float* sphereBounds, std::size_t index, const Spheref& sphere)
+	{
+		float* batch = &sphereBounds[(index / BatchSize) * SphereBatchStride + index % BatchSize];
+
+		batch[0 * BatchSize] = sphere.x;
+		batch[1 * BatchSize] = sphere.y;
+		batch[2 * BatchSize] = sphere.z;
+		batch[3 * BatchSize] = sphere.radius;
+	}
+}
+
+#include <Nazara/Graphics/DebugOff.hpp>
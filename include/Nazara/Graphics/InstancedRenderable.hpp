@@ -38,12 +38,14 @@ namespace Nz
 			virtual ~InstancedRenderable();
 
 			virtual void AddToRenderQueue(AbstractRenderQueue* renderQueue, const InstanceData& instanceData, const Recti& scissorRect) const = 0;
+			virtual void AddToRenderQueueByCulling(const Frustumf& frustum, AbstractRenderQueue* renderQueue, const InstanceData& instanceData, const Recti& scissorRect) const;
 
 			virtual std::unique_ptr<InstancedRenderable> Clone() const = 0;
 
 			virtual bool Cull(const Frustumf& frustum, const InstanceData& instanceData) const;
 
 			inline void EnsureBoundingVolumeUpdated() const;
+			virtual void EnsureRenderQueueDataUpdated() const;
 
 			virtual const BoundingVolumef& GetBoundingVolume() const;
 
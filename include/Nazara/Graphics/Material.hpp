@@ -9,6 +9,7 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Color.hpp>
+#include <Nazara/Core/IndexPool.hpp>
 #include <Nazara/Core/ObjectLibrary.hpp>
 #include <Nazara/Core/ObjectRef.hpp>
 #include <Nazara/Core/RefCounted.hpp>
@@ -109,6 +110,7 @@ namespace Nz
 			inline ReflectionMode GetReflectionMode() const;
 			inline const UberShader* GetShader() const;
 			inline float GetShininess() const;
+			inline UInt32 GetSortIndex() const;
 			inline Color GetSpecularColor() const;
 			inline const TextureRef& GetSpecularMap() const;
 			inline TextureSampler& GetSpecularSampler();
@@ -199,6 +201,7 @@ namespace Nz
 			Color m_ambientColor;
 			Color m_diffuseColor;
 			Color m_specularColor;
+			IndexPool::Index m_sortIndex{s_sortIndexPool};
 			MaterialRef m_depthMaterial; //< Materialception
 			mutable const MaterialPipeline* m_pipeline;
 			MaterialPipelineInfo m_pipelineInfo;
@@ -223,6 +226,7 @@ namespace Nz
 			static MaterialManager::ManagerMap s_managerMap;
 			static MaterialManager::ManagerParams s_managerParameters;
 			static MaterialRef s_defaultMaterial;
+			static IndexPool s_sortIndexPool;
 	};
 }
 
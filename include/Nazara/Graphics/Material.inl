@@ -676,6 +676,17 @@ namespace Nz
 		return m_shininess;
 	}
 
+	/*!
+	* \brief Gets the sort index
+	* \return Index unique among living materials, reused once the material is destroyed
+	*
+	* \remark This index is meant to order render queues, it is not kept by copies
+	*/
+	inline UInt32 Material::GetSortIndex() const
+	{
+		return m_sortIndex.Get();
+	}
+
 	/*!
 	* \brief Gets the specular color
 	* \return Specular color
@@ -8,6 +8,7 @@
 #define NAZARA_MATERIALPIPELINE_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/IndexPool.hpp>
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Graphics/Enums.hpp>
 #include <Nazara/Renderer/RenderPipeline.hpp>
@@ -61,6 +62,7 @@ namespace Nz
 
 			inline const MaterialPipelineInfo& GetInfo() const;
 			inline const Instance& GetInstance(UInt32 flags = ShaderFlags_None) const;
+			inline UInt32 GetSortIndex() const;
 
 			static MaterialPipelineRef GetPipeline(const MaterialPipelineInfo& pipelineInfo);
 
@@ -82,11 +84,13 @@ namespace Nz
 
 			MaterialPipelineInfo m_pipelineInfo;
 			mutable std::array<Instance, ShaderFlags_Max + 1> m_instances;
+			IndexPool::Index m_sortIndex{s_sortIndexPool};
 
 			using PipelineCache = std::unordered_map<MaterialPipelineInfo, MaterialPipelineRef>;
 			static PipelineCache s_pipelineCache;
 
 			static MaterialPipelineLibrary::LibraryMap s_library;
+			static IndexPool s_sortIndexPool;
 	};
 }
 
@@ -55,6 +55,15 @@ namespace Nz
 		return instance;
 	}
 
+	/*!
+	* \brief Gets the sort index
+	* \return Index unique among living pipelines, reused once the pipeline is destroyed
+	*/
+	inline UInt32 MaterialPipeline::GetSortIndex() const
+	{
+		return m_sortIndex.Get();
+	}
+
 	bool operator==(const MaterialPipelineInfo& lhs, const MaterialPipelineInfo& rhs)
 	{
 		if (!operator==(static_cast<const RenderStates&>(lhs), static_cast<const RenderStates&>(rhs)))
@@ -32,6 +32,7 @@ namespace Nz
 			void Sort();
 
 			std::vector<RenderDataPair> m_orderedRenderQueue;
+			std::vector<RenderDataPair> m_sortBuffer;
 	};
 
 	template<typename RenderData>
@@ -43,6 +43,7 @@ namespace Nz
 			SkeletalModel* Create() const;
 
 			void EnableAnimation(bool animation);
+			void EnsureRenderQueueDataUpdated() const override;
 
 			Animation* GetAnimation() const;
 			Skeleton* GetSkeleton();
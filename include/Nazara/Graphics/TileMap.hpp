@@ -34,6 +34,7 @@ namespace Nz
 			~TileMap() = default;
 
 			void AddToRenderQueue(AbstractRenderQueue* renderQueue, const InstanceData& instanceData, const Recti& scissorRect) const override;
+			void AddToRenderQueueByCulling(const Frustumf& frustum, AbstractRenderQueue* renderQueue, const InstanceData& instanceData, const Recti& scissorRect) const override;
 
 			std::unique_ptr<InstancedRenderable> Clone() const override;
 
@@ -64,6 +65,8 @@ namespace Nz
 
 			template<typename... Args> static TileMapRef New(Args&&... args);
 
+			static constexpr unsigned int ChunkSize = 32;
+
 			struct Tile
 			{
 				std::size_t layerIndex = 0U;
@@ -73,6 +76,10 @@ namespace Nz
 			};
 
 		private:
+			void AddChunksToRenderQueue(const Frustumf* frustum, AbstractRenderQueue* renderQueue, const InstanceData& instanceData, const Recti& scissorRect) const;
+			inline std::size_t GetChunkIndex(const Vector2ui& tilePos) const;
+			inline void InvalidateChunk(std::size_t chunkIndex);
+			inline void InvalidateChunks();
 			void MakeBoundingVolume() const override;
 			void UpdateData(InstanceData* instanceData) const override;
 
@@ -84,8 +91,16 @@ namespace Nz
 				std::set<std::size_t> tiles;
 			};
 
+			struct Chunk
+			{
+				std::vector<Layer> layers;
+				UInt64 version;
+			};
+
+			std::vector<Chunk> m_chunks;
 			std::vector<Tile> m_tiles;
-			std::vector<Layer> m_layers;
+			UInt64 m_chunkVersion;
+			Vector2ui m_chunkCount;
 			Vector2ui m_mapSize;
 			Vector2f m_tileSize;
 			bool m_isometricModeEnabled;
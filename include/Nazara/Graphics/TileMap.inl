@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/Error.hpp>
+#include <algorithm>
 #include <memory>
 #include <Nazara/Graphics/Debug.hpp>
 
@@ -22,14 +23,21 @@ namespace Nz
 	*/
 	inline TileMap::TileMap(const Nz::Vector2ui& mapSize, const Nz::Vector2f& tileSize, std::size_t materialCount) :
 	m_tiles(mapSize.x * mapSize.y),
-	m_layers(materialCount),
+	m_chunkVersion(0),
+	m_chunkCount((mapSize.x + ChunkSize - 1) / ChunkSize, (mapSize.y + ChunkSize - 1) / ChunkSize),
 	m_mapSize(mapSize),
 	m_tileSize(tileSize),
 	m_isometricModeEnabled(false)
 	{
 		NazaraAssert(m_tiles.size() != 0U, "Invalid map size");
 		NazaraAssert(m_tileSize.x > 0 && m_tileSize.y > 0, "Invalid tile size");
-		NazaraAssert(m_layers.size() != 0U, "Invalid material count");
+		NazaraAssert(materialCount != 0U, "Invalid material count");
+
+		m_chunks.resize(m_chunkCount.x * m_chunkCount.y);
+		for (Chunk& chunk : m_chunks)
+			chunk.layers.resize(materialCount);
+
+		InvalidateChunks();
 
 		ResetMaterials(materialCount);
 
@@ -51,8 +59,10 @@ namespace Nz
 		Tile& tile = m_tiles[tileIndex];
 		tile.enabled = false;
 
-		m_layers[tile.layerIndex].tiles.erase(tileIndex);
+		std::size_t chunkIndex = GetChunkIndex(tilePos);
+		m_chunks[chunkIndex].layers[tile.layerIndex].tiles.erase(tileIndex);
 
+		InvalidateChunk(chunkIndex);
 		InvalidateInstanceData(1U << tile.layerIndex);
 	}
 
@@ -64,9 +74,13 @@ namespace Nz
 		for (Tile& tile : m_tiles)
 			tile.enabled = false;
 
-		for (Layer& layer : m_layers)
-			layer.tiles.clear();
+		for (Chunk& chunk : m_chunks)
+		{
+			for (Layer& layer : chunk.layers)
+				layer.tiles.clear();
+		}
 
+		InvalidateChunks();
 		InvalidateInstanceData(0xFFFFFFFF);
 	}
 
@@ -96,7 +110,10 @@ namespace Nz
 			Tile& tile = m_tiles[tileIndex];
 			tile.enabled = false;
 
-			m_layers[tile.layerIndex].tiles.erase(tileIndex);
+			std::size_t chunkIndex = GetChunkIndex(*tilesPos);
+			m_chunks[chunkIndex].layers[tile.layerIndex].tiles.erase(tileIndex);
+
+			InvalidateChunk(chunkIndex);
 
 			invalidatedLayers |= 1U << tile.layerIndex;
 
@@ -120,6 +137,7 @@ namespace Nz
 	{
 		m_isometricModeEnabled = isometric;
 
+		InvalidateChunks();
 		InvalidateInstanceData(0xFFFFFFFF);
 	}
 
@@ -138,19 +156,22 @@ namespace Nz
 	inline void TileMap::EnableTile(const Vector2ui& tilePos, const Rectf& coords, const Color& color, std::size_t materialIndex)
 	{
 		NazaraAssert(tilePos.x < m_mapSize.x && tilePos.y < m_mapSize.y, "Tile position is out of bounds");
-		NazaraAssert(materialIndex < m_layers.size(), "Material out of bounds");
+		NazaraAssert(materialIndex < GetMaterialCount(), "Material out of bounds");
 
 		UInt32 invalidatedLayers = 1U << materialIndex;
 
 		std::size_t tileIndex = tilePos.y * m_mapSize.x + tilePos.x;
 		Tile& tile = m_tiles[tilePos.y * m_mapSize.x + tilePos.x];
 
+		std::size_t chunkIndex = GetChunkIndex(tilePos);
+		Chunk& chunk = m_chunks[chunkIndex];
+
 		if (!tile.enabled)
-			m_layers[materialIndex].tiles.insert(tileIndex);
+			chunk.layers[materialIndex].tiles.insert(tileIndex);
 		else if (materialIndex != tile.layerIndex)
 		{
-			m_layers[tile.layerIndex].tiles.erase(tileIndex);
-			m_layers[materialIndex].tiles.insert(tileIndex);
+			chunk.layers[tile.layerIndex].tiles.erase(tileIndex);
+			chunk.layers[materialIndex].tiles.insert(tileIndex);
 
 			invalidatedLayers |= 1U << tile.layerIndex;
 		}
@@ -160,6 +181,7 @@ namespace Nz
 		tile.textureCoords = coords;
 		tile.layerIndex = materialIndex;
 
+		InvalidateChunk(chunkIndex);
 		InvalidateInstanceData(invalidatedLayers);
 	}
 
@@ -180,7 +202,7 @@ namespace Nz
 	*/
 	inline void TileMap::EnableTile(const Vector2ui& tilePos, const Rectui& rect, const Color& color, std::size_t materialIndex)
 	{
-		NazaraAssert(materialIndex < m_layers.size(), "Material out of bounds");
+		NazaraAssert(materialIndex < GetMaterialCount(), "Material out of bounds");
 
 		const MaterialRef& material = GetMaterial(materialIndex);
 		NazaraAssert(material->HasDiffuseMap(), "Material has no diffuse map");
@@ -209,22 +231,30 @@ namespace Nz
 	*/
 	inline void TileMap::EnableTiles(const Rectf& coords, const Color& color, std::size_t materialIndex)
 	{
-		NazaraAssert(materialIndex < m_layers.size(), "Material out of bounds");
+		NazaraAssert(materialIndex < GetMaterialCount(), "Material out of bounds");
 
-		for (Layer& layer : m_layers)
-			layer.tiles.clear();
+		for (Chunk& chunk : m_chunks)
+		{
+			for (Layer& layer : chunk.layers)
+				layer.tiles.clear();
+		}
 
 		std::size_t tileIndex = 0;
-		for (Tile& tile : m_tiles)
+		for (unsigned int y = 0; y < m_mapSize.y; ++y)
 		{
-			tile.enabled = true;
-			tile.color = color;
-			tile.textureCoords = coords;
-			tile.layerIndex = materialIndex;
+			for (unsigned int x = 0; x < m_mapSize.x; ++x)
+			{
+				Tile& tile = m_tiles[tileIndex];
+				tile.enabled = true;
+				tile.color = color;
+				tile.textureCoords = coords;
+				tile.layerIndex = materialIndex;
 
-			m_layers[materialIndex].tiles.insert(tileIndex++);
+				m_chunks[GetChunkIndex(Vector2ui(x, y))].layers[materialIndex].tiles.insert(tileIndex++);
+			}
 		}
 
+		InvalidateChunks();
 		InvalidateInstanceData(0xFFFFFFFF);
 	}
 
@@ -244,7 +274,7 @@ namespace Nz
 	*/
 	inline void TileMap::EnableTiles(const Rectui& rect, const Color& color, std::size_t materialIndex)
 	{
-		NazaraAssert(materialIndex < m_layers.size(), "Material out of bounds");
+		NazaraAssert(materialIndex < GetMaterialCount(), "Material out of bounds");
 
 		Texture* diffuseMap = GetMaterial(materialIndex)->GetDiffuseMap();
 		float invWidth = 1.f / diffuseMap->GetWidth();
@@ -270,7 +300,7 @@ namespace Nz
 	inline void TileMap::EnableTiles(const Vector2ui* tilesPos, std::size_t tileCount, const Rectf& coords, const Color& color, std::size_t materialIndex)
 	{
 		NazaraAssert(tilesPos || tileCount == 0, "Invalid tile position array with a non-zero tileCount");
-		NazaraAssert(materialIndex < m_layers.size(), "Material out of bounds");
+		NazaraAssert(materialIndex < GetMaterialCount(), "Material out of bounds");
 
 		UInt32 invalidatedLayers = 1U << materialIndex;
 
@@ -281,16 +311,21 @@ namespace Nz
 			std::size_t tileIndex = tilesPos->y * m_mapSize.x + tilesPos->x;
 			Tile& tile = m_tiles[tileIndex];
 
+			std::size_t chunkIndex = GetChunkIndex(*tilesPos);
+			Chunk& chunk = m_chunks[chunkIndex];
+
 			if (!tile.enabled)
-				m_layers[materialIndex].tiles.insert(tileIndex);
+				chunk.layers[materialIndex].tiles.insert(tileIndex);
 			else if (materialIndex != tile.layerIndex)
 			{
-				m_layers[tile.layerIndex].tiles.erase(tileIndex);
-				m_layers[materialIndex].tiles.insert(tileIndex);
+				chunk.layers[tile.layerIndex].tiles.erase(tileIndex);
+				chunk.layers[materialIndex].tiles.insert(tileIndex);
 
 				invalidatedLayers |= 1U << tile.layerIndex;
 			}
 
+			InvalidateChunk(chunkIndex);
+
 			tile.enabled = true;
 			tile.color = color;
 			tile.textureCoords = coords;
@@ -320,7 +355,7 @@ namespace Nz
 	*/
 	inline void TileMap::EnableTiles(const Vector2ui* tilesPos, std::size_t tileCount, const Rectui& rect, const Color& color, std::size_t materialIndex)
 	{
-		NazaraAssert(materialIndex < m_layers.size(), "Material out of bounds");
+		NazaraAssert(materialIndex < GetMaterialCount(), "Material out of bounds");
 
 		const MaterialRef& material = GetMaterial(materialIndex);
 		NazaraAssert(material->HasDiffuseMap(), "Material has no diffuse map");
@@ -404,13 +439,16 @@ namespace Nz
 	{
 		InstancedRenderable::operator=(tileMap);
 
-		m_layers = tileMap.m_layers;
+		m_chunkCount = tileMap.m_chunkCount;
+		m_chunks = tileMap.m_chunks;
+		m_chunkVersion = std::max(m_chunkVersion, tileMap.m_chunkVersion);
 		m_mapSize = tileMap.m_mapSize;
 		m_tiles = tileMap.m_tiles;
 		m_tileSize = tileMap.m_tileSize;
 
 		// We do not copy final vertices because it's highly probable that our parameters are modified and they must be regenerated
 		InvalidateBoundingVolume();
+		InvalidateChunks();
 		InvalidateInstanceData(0xFFFFFFFF);
 
 		return *this;
@@ -430,6 +468,37 @@ namespace Nz
 
 		return object.release();
 	}
+
+	/*!
+	* \brief Gets the index of the chunk holding a tile
+	* \return Index of the chunk
+	*
+	* \param tilePos Position of the tile
+	*/
+	inline std::size_t TileMap::GetChunkIndex(const Vector2ui& tilePos) const
+	{
+		return (tilePos.y / ChunkSize) * m_chunkCount.x + tilePos.x / ChunkSize;
+	}
+
+	/*!
+	* \brief Invalidates a chunk, its vertices will be regenerated on next data update
+	*
+	* \param chunkIndex Index of the chunk
+	*/
+	inline void TileMap::InvalidateChunk(std::size_t chunkIndex)
+	{
+		m_chunks[chunkIndex].version = ++m_chunkVersion;
+	}
+
+	/*!
+	* \brief Invalidates every chunk
+	*/
+	inline void TileMap::InvalidateChunks()
+	{
+		++m_chunkVersion;
+		for (Chunk& chunk : m_chunks)
+			chunk.version = m_chunkVersion;
+	}
 }
 
 #include <Nazara/Graphics/DebugOff.hpp>
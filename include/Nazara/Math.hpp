@@ -34,6 +34,7 @@
 #include <Nazara/Math/Angle.hpp>
 #include <Nazara/Math/BoundingVolume.hpp>
 #include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/BoxTree.hpp>
 #include <Nazara/Math/Config.hpp>
 #include <Nazara/Math/Enums.hpp>
 #include <Nazara/Math/EulerAngles.hpp>
@@ -0,0 +1,91 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Mathematics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_BOXTREE_HPP
+#define NAZARA_BOXTREE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/Enums.hpp>
+#include <Nazara/Math/Frustum.hpp>
+#include <limits>
+#include <vector>
+
+namespace Nz
+{
+	template<typename T>
+	class BoxTree
+	{
+		public:
+			explicit BoxTree(T margin = T(0));
+			BoxTree(const BoxTree& tree) = default;
+			BoxTree(BoxTree&& tree) noexcept = default;
+			~BoxTree() = default;
+
+			void Clear();
+
+			const Box<T>& GetBox(std::size_t proxy) const;
+			std::size_t GetHeight() const;
+			std::size_t GetLeafCount() const;
+			T GetMargin() const;
+			std::size_t GetUserData(std::size_t proxy) const;
+
+			std::size_t Insert(const Box<T>& box, std::size_t userData);
+
+			bool IsEmpty() const;
+
+			template<typename F> void Query(const Frustum<T>& frustum, F&& callback) const;
+
+			void Remove(std::size_t proxy);
+
+			void SetMargin(T margin);
+			void SetUserData(std::size_t proxy, std::size_t userData);
+
+			bool Update(std::size_t proxy, const Box<T>& box);
+
+			BoxTree& operator=(const BoxTree& tree) = default;
+			BoxTree& operator=(BoxTree&& tree) noexcept = default;
+
+			static constexpr std::size_t InvalidProxy = std::numeric_limits<std::size_t>::max();
+
+		private:
+			struct Node
+			{
+				Box<T> box;
+				std::size_t children[2];
+				std::size_t parent; //< Next free node when the node is not used
+				std::size_t userData;
+				int height; //< Zero for leaves, -1 for free nodes
+
+				bool IsLeaf() const;
+			};
+
+			std::size_t AllocateNode();
+			std::size_t Balance(std::size_t index);
+			Box<T> ComputeFatBox(const Box<T>& box) const;
+			void FreeNode(std::size_t index);
+			void InsertLeaf(std::size_t leaf);
+			void RefitAncestors(std::size_t index);
+			void RemoveLeaf(std::size_t leaf);
+			void ReplaceChild(std::size_t parent, std::size_t oldChild, std::size_t newChild);
+
+			static T ComputeCost(const Box<T>& box);
+			static Box<T> Merge(const Box<T>& lhs, const Box<T>& rhs);
+
+			std::vector<Node> m_nodes;
+			std::size_t m_freeList;
+			std::size_t m_leafCount;
+			std::size_t m_root;
+			T m_margin;
+	};
+
+	using BoxTreed = BoxTree<double>;
+	using BoxTreef = BoxTree<float>;
+}
+
+#include <Nazara/Math/BoxTree.inl>
+
+#endif // NAZARA_BOXTREE_HPP
@@ -0,0 +1,599 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Mathematics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+// Sources:
+// https://github.com/erincatto/Box2D/blob/master/Box2D/Box2D/Collision/b2DynamicTree.cpp
+// http://www.cs.utah.edu/~thiago/papers/rotations.pdf
+
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <utility>
+#include <Nazara/Core/Debug.hpp>
+
+#define F(a) static_cast<T>(a)
+
+namespace Nz
+{
+	/*!
+	* \ingroup math
+	* \class Nz::BoxTree
+	* \brief Math class that represents a dynamic bounding volume hierarchy of axis-aligned boxes
+	*
+	* Each inserted box is a leaf (called a proxy) of a binary tree whose internal nodes bound their children, allowing queries to reject whole subtrees.
+	* The tree is kept balanced by rotations as leaves are inserted and removed.
+	* Leaves store a box enlarged by a margin, so that objects moving a little don't need to be reinserted
+	*
+	* \remark Queries report leaves whose enlarged box passes the test, callers needing an exact result must test their own volume
+	*/
+
+	/*!
+	* \brief Constructs an empty BoxTree object
+	*
+	* \param margin Distance by which leaf boxes are enlarged in every direction
+	*/
+
+	template<typename T>
+	BoxTree<T>::BoxTree(T margin) :
+	m_freeList(InvalidProxy),
+	m_leafCount(0),
+	m_root(InvalidProxy),
+	m_margin(margin)
+	{
+	}
+
+	/*!
+	* \brief Removes every proxy from the tree
+	*/
+
+	template<typename T>
+	void BoxTree<T>::Clear()
+	{
+		m_nodes.clear();
+		m_freeList = InvalidProxy;
+		m_leafCount = 0;
+		m_root = InvalidProxy;
+	}
+
+	/*!
+	* \brief Gets the enlarged box stored for a proxy
+	* \return Box of the proxy, containing the last box it was inserted or reinserted with
+	*
+	* \param proxy Proxy returned by Insert
+	*/
+
+	template<typename T>
+	const Box<T>& BoxTree<T>::GetBox(std::size_t proxy) const
+	{
+		NazaraAssert(proxy < m_nodes.size() && m_nodes[proxy].IsLeaf(), "Invalid proxy");
+
+		return m_nodes[proxy].box;
+	}
+
+	/*!
+	* \brief Gets the height of the tree
+	* \return Number of levels of the tree, zero if it is empty
+	*/
+
+	template<typename T>
+	std::size_t BoxTree<T>::GetHeight() const
+	{
+		return (m_root != InvalidProxy) ? static_cast<std::size_t>(m_nodes[m_root].height) + 1 : 0;
+	}
+
+	/*!
+	* \brief Gets the number of proxies in the tree
+	* \return Proxy count
+	*/
+
+	template<typename T>
+	std::size_t BoxTree<T>::GetLeafCount() const
+	{
+		return m_leafCount;
+	}
+
+	/*!
+	* \brief Gets the margin by which leaf boxes are enlarged
+	* \return Margin of the tree
+	*/
+
+	template<typename T>
+	T BoxTree<T>::GetMargin() const
+	{
+		return m_margin;
+	}
+
+	/*!
+	* \brief Gets the user data of a proxy
+	* \return User data passed to Insert or SetUserData
+	*
+	* \param proxy Proxy returned by Insert
+	*/
+
+	template<typename T>
+	std::size_t BoxTree<T>::GetUserData(std::size_t proxy) const
+	{
+		NazaraAssert(proxy < m_nodes.size() && m_nodes[proxy].IsLeaf(), "Invalid proxy");
+
+		return m_nodes[proxy].userData;
+	}
+
+	/*!
+	* \brief Inserts a box in the tree
+	* \return Proxy identifying the box in the tree, stable until the proxy is removed
+	*
+	* \param box Box to insert
+	* \param userData Value reported by queries for this box
+	*/
+
+	template<typename T>
+	std::size_t BoxTree<T>::Insert(const Box<T>& box, std::size_t userData)
+	{
+		std::size_t proxy = AllocateNode();
+
+		Node& node = m_nodes[proxy];
+		node.box = ComputeFatBox(box);
+		node.height = 0;
+		node.userData = userData;
+
+		InsertLeaf(proxy);
+		m_leafCount++;
+
+		return proxy;
+	}
+
+	/*!
+	* \brief Checks whether or not the tree is empty
+	* \return true If it is the case
+	*/
+
+	template<typename T>
+	bool BoxTree<T>::IsEmpty() const
+	{
+		return m_root == InvalidProxy;
+	}
+
+	/*!
+	* \brief Reports every proxy whose box is not outside a frustum
+	*
+	* \param frustum Frustum to test the tree against
+	* \param callback Function called as callback(userData, side) for every proxy not outside the frustum,
+	*        side is IntersectionSide_Inside if the proxy box (or one of its ancestors) was found to be inside the frustum and IntersectionSide_Intersecting otherwise
+	*
+	* \remark Planes a node is completely in front of are not tested again for its descendants
+	*/
+
+	template<typename T>
+	template<typename F>
+	void BoxTree<T>::Query(const Frustum<T>& frustum, F&& callback) const
+	{
+		if (m_root == InvalidProxy)
+			return;
+
+		constexpr UInt32 allPlanes = (1U << (FrustumPlane_Max + 1)) - 1;
+
+		std::vector<std::pair<std::size_t, UInt32>> stack; //< Node index, mask of the planes to test
+		stack.reserve(64);
+		stack.emplace_back(m_root, allPlanes);
+
+		while (!stack.empty())
+		{
+			std::size_t index = stack.back().first;
+			UInt32 planeMask = stack.back().second;
+			stack.pop_back();
+
+			const Node& node = m_nodes[index];
+
+			bool outside = false;
+			for (unsigned int i = 0; i <= FrustumPlane_Max; ++i)
+			{
+				if ((planeMask & (1U << i)) == 0)
+					continue;
+
+				const Plane<T>& plane = frustum.GetPlane(static_cast<FrustumPlane>(i));
+				if (plane.Distance(node.box.GetPositiveVertex(plane.normal)) < F(0.0))
+				{
+					outside = true;
+					break;
+				}
+				else if (plane.Distance(node.box.GetNegativeVertex(plane.normal)) >= F(0.0))
+					planeMask &= ~(1U << i);
+			}
+
+			if (outside)
+				continue;
+
+			if (planeMask == 0)
+			{
+				// The whole subtree is inside the frustum, report its leaves without testing them
+				std::size_t stackSize = stack.size();
+				stack.emplace_back(index, 0U);
+				while (stack.size() > stackSize)
+				{
+					const Node& insideNode = m_nodes[stack.back().first];
+					stack.pop_back();
+
+					if (insideNode.IsLeaf())
+						callback(insideNode.userData, IntersectionSide_Inside);
+					else
+					{
+						stack.emplace_back(insideNode.children[0], 0U);
+						stack.emplace_back(insideNode.children[1], 0U);
+					}
+				}
+			}
+			else if (node.IsLeaf())
+				callback(node.userData, IntersectionSide_Intersecting);
+			else
+			{
+				stack.emplace_back(node.children[0], planeMask);
+				stack.emplace_back(node.children[1], planeMask);
+			}
+		}
+	}
+
+	/*!
+	* \brief Removes a proxy from the tree
+	*
+	* \param proxy Proxy returned by Insert, invalid after this call (and may be returned again by Insert)
+	*/
+
+	template<typename T>
+	void BoxTree<T>::Remove(std::size_t proxy)
+	{
+		NazaraAssert(proxy < m_nodes.size() && m_nodes[proxy].IsLeaf(), "Invalid proxy");
+
+		RemoveLeaf(proxy);
+		FreeNode(proxy);
+
+		m_leafCount--;
+	}
+
+	/*!
+	* \brief Sets the margin by which leaf boxes are enlarged
+	*
+	* \param margin New margin, only applied to boxes inserted or reinserted afterwards
+	*/
+
+	template<typename T>
+	void BoxTree<T>::SetMargin(T margin)
+	{
+		m_margin = margin;
+	}
+
+	/*!
+	* \brief Sets the user data of a proxy
+	*
+	* \param proxy Proxy returned by Insert
+	* \param userData Value reported by queries for this proxy
+	*/
+
+	template<typename T>
+	void BoxTree<T>::SetUserData(std::size_t proxy, std::size_t userData)
+	{
+		NazaraAssert(proxy < m_nodes.size() && m_nodes[proxy].IsLeaf(), "Invalid proxy");
+
+		m_nodes[proxy].userData = userData;
+	}
+
+	/*!
+	* \brief Updates the box of a proxy
+	* \return true If the proxy had to be reinserted
+	*
+	* \param proxy Proxy returned by Insert
+	* \param box New box of the proxy
+	*
+	* \remark The tree is only modified if the new box is not contained in the enlarged box of the proxy
+	*/
+
+	template<typename T>
+	bool BoxTree<T>::Update(std::size_t proxy, const Box<T>& box)
+	{
+		NazaraAssert(proxy < m_nodes.size() && m_nodes[proxy].IsLeaf(), "Invalid proxy");
+
+		if (m_nodes[proxy].box.Contains(box))
+			return false;
+
+		RemoveLeaf(proxy);
+		m_nodes[proxy].box = ComputeFatBox(box);
+		InsertLeaf(proxy);
+
+		return true;
+	}
+
+	template<typename T>
+	bool BoxTree<T>::Node::IsLeaf() const
+	{
+		return height == 0;
+	}
+
+	template<typename T>
+	std::size_t BoxTree<T>::AllocateNode()
+	{
+		std::size_t index;
+		if (m_freeList != InvalidProxy)
+		{
+			index = m_freeList;
+			m_freeList = m_nodes[index].parent;
+		}
+		else
+		{
+			index = m_nodes.size();
+			m_nodes.emplace_back();
+		}
+
+		Node& node = m_nodes[index];
+		node.children[0] = InvalidProxy;
+		node.children[1] = InvalidProxy;
+		node.parent = InvalidProxy;
+		node.height = 0;
+
+		return index;
+	}
+
+	template<typename T>
+	std::size_t BoxTree<T>::Balance(std::size_t indexA)
+	{
+		// Performs a left or right rotation if node A is imbalanced, returns the new root of the subtree
+		Node& a = m_nodes[indexA];
+		if (a.IsLeaf() || a.height < 2)
+			return indexA;
+
+		std::size_t indexB = a.children[0];
+		std::size_t indexC = a.children[1];
+		Node& b = m_nodes[indexB];
+		Node& c = m_nodes[indexC];
+
+		int balance = c.height - b.height;
+		if (balance > 1)
+		{
+			// Rotate C up
+			std::size_t indexF = c.children[0];
+			std::size_t indexG = c.children[1];
+			Node& f = m_nodes[indexF];
+			Node& g = m_nodes[indexG];
+
+			c.children[0] = indexA;
+			c.parent = a.parent;
+			a.parent = indexC;
+
+			if (c.parent != InvalidProxy)
+				ReplaceChild(c.parent, indexA, indexC);
+			else
+				m_root = indexC;
+
+			if (f.height > g.height)
+			{
+				c.children[1] = indexF;
+				a.children[1] = indexG;
+				g.parent = indexA;
+				a.box = Merge(b.box, g.box);
+				c.box = Merge(a.box, f.box);
+
+				a.height = 1 + std::max(b.height, g.height);
+				c.height = 1 + std::max(a.height, f.height);
+			}
+			else
+			{
+				c.children[1] = indexG;
+				a.children[1] = indexF;
+				f.parent = indexA;
+				a.box = Merge(b.box, f.box);
+				c.box = Merge(a.box, g.box);
+
+				a.height = 1 + std::max(b.height, f.height);
+				c.height = 1 + std::max(a.height, g.height);
+			}
+
+			return indexC;
+		}
+		else if (balance < -1)
+		{
+			// Rotate B up
+			std::size_t indexD = b.children[0];
+			std::size_t indexE = b.children[1];
+			Node& d = m_nodes[indexD];
+			Node& e = m_nodes[indexE];
+
+			b.children[0] = indexA;
+			b.parent = a.parent;
+			a.parent = indexB;
+
+			if (b.parent != InvalidProxy)
+				ReplaceChild(b.parent, indexA, indexB);
+			else
+				m_root = indexB;
+
+			if (d.height > e.height)
+			{
+				b.children[1] = indexD;
+				a.children[0] = indexE;
+				e.parent = indexA;
+				a.box = Merge(c.box, e.box);
+				b.box = Merge(a.box, d.box);
+
+				a.height = 1 + std::max(c.height, e.height);
+				b.height = 1 + std::max(a.height, d.height);
+			}
+			else
+			{
+				b.children[1] = indexE;
+				a.children[0] = indexD;
+				d.parent = indexA;
+				a.box = Merge(c.box, d.box);
+				b.box = Merge(a.box, e.box);
+
+				a.height = 1 + std::max(c.height, d.height);
+				b.height = 1 + std::max(a.height, e.height);
+			}
+
+			return indexB;
+		}
+
+		return indexA;
+	}
+
+	template<typename T>
+	Box<T> BoxTree<T>::ComputeFatBox(const Box<T>& box) const
+	{
+		return Box<T>(box.x - m_margin, box.y - m_margin, box.z - m_margin, box.width + F(2.0) * m_margin, box.height + F(2.0) * m_margin, box.depth + F(2.0) * m_margin);
+	}
+
+	template<typename T>
+	void BoxTree<T>::FreeNode(std::size_t index)
+	{
+		Node& node = m_nodes[index];
+		node.height = -1;
+		node.parent = m_freeList;
+
+		m_freeList = index;
+	}
+
+	template<typename T>
+	void BoxTree<T>::InsertLeaf(std::size_t leaf)
+	{
+		if (m_root == InvalidProxy)
+		{
+			m_root = leaf;
+			m_nodes[leaf].parent = InvalidProxy;
+			return;
+		}
+
+		// Find the best sibling for the new leaf, by descending the tree while it lowers the surface area cost
+		Box<T> leafBox = m_nodes[leaf].box;
+
+		std::size_t index = m_root;
+		while (!m_nodes[index].IsLeaf())
+		{
+			const Node& node = m_nodes[index];
+
+			T area = ComputeCost(node.box);
+			T combinedArea = ComputeCost(Merge(node.box, leafBox));
+
+			// Cost of creating a new parent for this node and the new leaf, and minimal cost of pushing the leaf further down
+			T cost = F(2.0) * combinedArea;
+			T inheritanceCost = F(2.0) * (combinedArea - area);
+
+			T childCosts[2];
+			for (unsigned int i = 0; i < 2; ++i)
+			{
+				const Node& child = m_nodes[node.children[i]];
+
+				childCosts[i] = ComputeCost(Merge(leafBox, child.box)) + inheritanceCost;
+				if (!child.IsLeaf())
+					childCosts[i] -= ComputeCost(child.box);
+			}
+
+			if (cost < childCosts[0] && cost < childCosts[1])
+				break;
+
+			index = (childCosts[0] < childCosts[1]) ? node.children[0] : node.children[1];
+		}
+
+		std::size_t sibling = index;
+
+		// Create a new parent for the sibling and the leaf
+		std::size_t oldParent = m_nodes[sibling].parent;
+		std::size_t newParent = AllocateNode();
+
+		Node& parentNode = m_nodes[newParent];
+		parentNode.box = Merge(leafBox, m_nodes[sibling].box);
+		parentNode.children[0] = sibling;
+		parentNode.children[1] = leaf;
+		parentNode.height = m_nodes[sibling].height + 1;
+		parentNode.parent = oldParent;
+
+		if (oldParent != InvalidProxy)
+			ReplaceChild(oldParent, sibling, newParent);
+		else
+			m_root = newParent;
+
+		m_nodes[sibling].parent = newParent;
+		m_nodes[leaf].parent = newParent;
+
+		RefitAncestors(newParent);
+	}
+
+	template<typename T>
+	void BoxTree<T>::RefitAncestors(std::size_t index)
+	{
+		while (index != InvalidProxy)
+		{
+			index = Balance(index);
+
+			Node& node = m_nodes[index];
+			const Node& child0 = m_nodes[node.children[0]];
+			const Node& child1 = m_nodes[node.children[1]];
+
+			node.box = Merge(child0.box, child1.box);
+			node.height = 1 + std::max(child0.height, child1.height);
+
+			index = node.parent;
+		}
+	}
+
+	template<typename T>
+	void BoxTree<T>::RemoveLeaf(std::size_t leaf)
+	{
+		if (leaf == m_root)
+		{
+			m_root = InvalidProxy;
+			return;
+		}
+
+		std::size_t parent = m_nodes[leaf].parent;
+		std::size_t grandParent = m_nodes[parent].parent;
+		std::size_t sibling = (m_nodes[parent].children[0] == leaf) ? m_nodes[parent].children[1] : m_nodes[parent].children[0];
+
+		// The sibling takes the place of the parent
+		m_nodes[sibling].parent = grandParent;
+		if (grandParent != InvalidProxy)
+		{
+			ReplaceChild(grandParent, parent, sibling);
+			FreeNode(parent);
+
+			RefitAncestors(grandParent);
+		}
+		else
+		{
+			m_root = sibling;
+			FreeNode(parent);
+		}
+	}
+
+	template<typename T>
+	void BoxTree<T>::ReplaceChild(std::size_t parent, std::size_t oldChild, std::size_t newChild)
+	{
+		Node& parentNode = m_nodes[parent];
+		if (parentNode.children[0] == oldChild)
+			parentNode.children[0] = newChild;
+		else
+		{
+			NazaraAssert(parentNode.children[1] == oldChild, "Node is not a child of its parent");
+			parentNode.children[1] = newChild;
+		}
+	}
+
+	template<typename T>
+	T BoxTree<T>::ComputeCost(const Box<T>& box)
+	{
+		// Surface area heuristic (the constant factor doesn't matter)
+		return box.width * box.height + box.height * box.depth + box.depth * box.width;
+	}
+
+	template<typename T>
+	Box<T> BoxTree<T>::Merge(const Box<T>& lhs, const Box<T>& rhs)
+	{
+		Box<T> box(lhs);
+		box.ExtendTo(rhs);
+
+		return box;
+	}
+
+	template<typename T>
+	constexpr std::size_t BoxTree<T>::InvalidProxy;
+}
+
+#undef F
+
+#include <Nazara/Core/DebugOff.hpp>
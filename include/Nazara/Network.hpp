@@ -34,9 +34,12 @@
 #include <Nazara/Network/Config.hpp>
 #include <Nazara/Network/ENetCompressor.hpp>
 #include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetLZCompressor.hpp>
 #include <Nazara/Network/ENetPacket.hpp>
 #include <Nazara/Network/ENetPeer.hpp>
 #include <Nazara/Network/ENetProtocol.hpp>
+#include <Nazara/Network/ENetRangeCoderCompressor.hpp>
+#include <Nazara/Network/ENetShardedHost.hpp>
 #include <Nazara/Network/Enums.hpp>
 #include <Nazara/Network/IpAddress.hpp>
 #include <Nazara/Network/NetBuffer.hpp>
@@ -47,7 +50,9 @@
 #include <Nazara/Network/SocketHandle.hpp>
 #include <Nazara/Network/SocketPoller.hpp>
 #include <Nazara/Network/TcpClient.hpp>
+#include <Nazara/Network/TcpReactor.hpp>
 #include <Nazara/Network/TcpServer.hpp>
+#include <Nazara/Network/UdpDatagram.hpp>
 #include <Nazara/Network/UdpSocket.hpp>
 
 #endif // NAZARA_GLOBAL_NETWORK_HPP
@@ -20,6 +20,7 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Bitset.hpp>
 #include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/ConcurrentMemoryPool.hpp>
 #include <Nazara/Core/MemoryPool.hpp>
 #include <Nazara/Network/ENetCompressor.hpp>
 #include <Nazara/Network/ENetPeer.hpp>
@@ -28,20 +29,23 @@
 #include <Nazara/Network/NetBuffer.hpp>
 #include <Nazara/Network/NetPacket.hpp>
 #include <Nazara/Network/SocketPoller.hpp>
+#include <Nazara/Network/UdpDatagram.hpp>
 #include <Nazara/Network/UdpSocket.hpp>
 #include <random>
+#include <vector>
 
 namespace Nz
 {
 	class NAZARA_NETWORK_API ENetHost
 	{
 		friend ENetPeer;
+		friend class ENetShardedHost;
 		friend class Network;
 
 		public:
 			inline ENetHost();
 			ENetHost(const ENetHost&) = delete;
-			ENetHost(ENetHost&&) = default;
+			ENetHost(ENetHost&&) = delete; //< Peers and their command lists point to the host and its pools
 			inline ~ENetHost();
 
 			inline void AllowsIncomingConnections(bool allow = true);
@@ -76,7 +80,7 @@ namespace Nz
 			void SimulateNetwork(double packetLossProbability, UInt16 minDelay, UInt16 maxDelay);
 
 			ENetHost& operator=(const ENetHost&) = delete;
-			ENetHost& operator=(ENetHost&&) = default;
+			ENetHost& operator=(ENetHost&&) = delete;
 
 		private:
 			ENetPacketRef AllocatePacket(ENetPacketFlags flags);
@@ -97,9 +101,12 @@ namespace Nz
 			void NotifyConnect(ENetPeer* peer, ENetEvent* event, bool incoming);
 			void NotifyDisconnect(ENetPeer*, ENetEvent* event);
 
+			bool QueueOutgoingDatagram(const IpAddress& to, const NetBuffer* buffers, std::size_t bufferCount);
+
 			void SendAcknowledgements(ENetPeer* peer);
 			bool SendReliableOutgoingCommands(ENetPeer* peer);
 			int SendOutgoingCommands(ENetEvent* event, bool checkForTimeouts);
+			bool SendOutgoingDatagrams();
 			void SendUnreliableOutgoingCommands(ENetPeer* peer);
 
 			void ThrottleBandwidth();
@@ -133,19 +140,27 @@ namespace Nz
 			std::size_t m_channelLimit;
 			std::size_t m_commandCount;
 			std::size_t m_duplicatePeers;
+			std::size_t m_incomingDatagramCount;
+			std::size_t m_incomingDatagramOffset;
 			std::size_t m_maximumPacketSize;
 			std::size_t m_maximumWaitingData;
+			std::size_t m_outgoingDatagramCount;
 			std::size_t m_packetSize;
 			std::size_t m_peerCount;
 			std::size_t m_receivedDataLength;
 			std::uniform_int_distribution<UInt16> m_packetDelayDistribution;
 			std::unique_ptr<ENetCompressor> m_compressor;
+			ConcurrentMemoryPool m_packetPool; //< Packets may be released by other threads than the one servicing the host
+			MemoryPool m_commandPool; //< Must outlive m_peers, whose command lists allocate from it
 			std::vector<ENetPeer> m_peers;
+			std::vector<NetBuffer> m_datagramBuffers;
 			std::vector<PendingIncomingPacket> m_pendingIncomingPackets;
 			std::vector<PendingOutgoingPacket> m_pendingOutgoingPackets;
+			std::vector<UdpDatagram> m_incomingDatagrams;
+			std::vector<UdpDatagram> m_outgoingDatagrams;
+			std::vector<UInt8> m_datagramData;
 			MovablePtr<UInt8> m_receivedData;
 			Bitset<UInt64> m_dispatchQueue;
-			MemoryPool m_packetPool;
 			IpAddress m_address;
 			IpAddress m_receivedAddress;
 			SocketPoller m_poller;
@@ -165,6 +180,7 @@ namespace Nz
 			bool m_allowsIncomingConnections;
 			bool m_continueSending;
 			bool m_isUsingDualStack;
+			bool m_isReusingPort;
 			bool m_isSimulationEnabled;
 			bool m_recalculateBandwidthLimits;
 
@@ -10,7 +10,9 @@ namespace Nz
 {
 	inline ENetHost::ENetHost() :
 	m_packetPool(sizeof(ENetPacket)),
+	m_commandPool(ENetPeer::commandNodeSize),
 	m_isUsingDualStack(false),
+	m_isReusingPort(false),
 	m_isSimulationEnabled(false)
 	{
 	}
@@ -0,0 +1,37 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_ENETLZCOMPRESSOR_HPP
+#define NAZARA_ENETLZCOMPRESSOR_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Network/ENetCompressor.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API ENetLZCompressor : public ENetCompressor
+	{
+		public:
+			ENetLZCompressor(std::size_t minimumInputSize = 128);
+			~ENetLZCompressor() = default;
+
+			std::size_t Compress(const ENetPeer* peer, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize) override;
+			std::size_t Decompress(const ENetPeer* peer, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize) override;
+
+			inline std::size_t GetMinimumInputSize() const;
+
+			inline void SetMinimumInputSize(std::size_t minimumInputSize);
+
+		private:
+			std::size_t m_minimumInputSize;
+			std::vector<UInt8> m_inputBuffer;
+	};
+}
+
+#include <Nazara/Network/ENetLZCompressor.inl>
+
+#endif // NAZARA_ENETLZCOMPRESSOR_HPP
@@ -0,0 +1,21 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetLZCompressor.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	inline std::size_t ENetLZCompressor::GetMinimumInputSize() const
+	{
+		return m_minimumInputSize;
+	}
+
+	inline void ENetLZCompressor::SetMinimumInputSize(std::size_t minimumInputSize)
+	{
+		m_minimumInputSize = minimumInputSize;
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
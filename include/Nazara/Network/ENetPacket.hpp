@@ -29,11 +29,11 @@ namespace Nz
 
 	constexpr ENetPacketFlags ENetPacketFlag_Unreliable = 0;
 
-	class MemoryPool;
+	class ConcurrentMemoryPool;
 
 	struct ENetPacket
 	{
-		MemoryPool* owner;
+		ConcurrentMemoryPool* owner; //< Null if the packet was allocated with new
 		ENetPacketFlags flags;
 		NetPacket data;
 		std::size_t referenceCount = 0;
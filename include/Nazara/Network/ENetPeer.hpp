@@ -19,10 +19,12 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Bitset.hpp>
+#include <Nazara/Core/MemoryPoolAllocator.hpp>
 #include <Nazara/Core/MovablePtr.hpp>
 #include <Nazara/Network/ENetPacket.hpp>
 #include <Nazara/Network/ENetProtocol.hpp>
 #include <Nazara/Network/IpAddress.hpp>
+#include <algorithm>
 #include <array>
 #include <list>
 #include <random>
@@ -35,10 +37,11 @@ namespace Nz
 	class NAZARA_NETWORK_API ENetPeer
 	{
 		friend ENetHost;
+		friend class ENetShardedHost;
 		friend struct PacketRef;
 
 		public:
-			inline ENetPeer(ENetHost* host, UInt16 peerId);
+			ENetPeer(ENetHost* host, UInt16 peerId);
 			ENetPeer(const ENetPeer&) = delete;
 			ENetPeer(ENetPeer&&) = default;
 			~ENetPeer() = default;
@@ -90,6 +93,9 @@ namespace Nz
 			struct IncomingCommmand;
 			struct OutgoingCommand;
 
+			// Commands nodes are allocated from the host command pool
+			template<typename T> using CommandList = std::list<T, MemoryPoolAllocator<T>>;
+
 			inline void ChangeState(ENetPeerState state);
 
 			bool CheckTimeouts(ENetEvent* event);
@@ -136,7 +142,9 @@ namespace Nz
 
 			struct Channel
 			{
-				Channel()
+				Channel(MemoryPool& commandPool) :
+				incomingReliableCommands(commandPool),
+				incomingUnreliableCommands(commandPool)
 				{
 					incomingReliableSequenceNumber = 0;
 					incomingUnreliableSequenceNumber = 0;
@@ -147,8 +155,8 @@ namespace Nz
 				}
 
 				std::array<UInt16, ENetPeer_ReliableWindows> reliableWindows;
-				std::list<IncomingCommmand>                  incomingReliableCommands;
-				std::list<IncomingCommmand>                  incomingUnreliableCommands;
+				CommandList<IncomingCommmand>                incomingReliableCommands;
+				CommandList<IncomingCommmand>                incomingUnreliableCommands;
 				UInt16                                       incomingReliableSequenceNumber;
 				UInt16                                       incomingUnreliableSequenceNumber;
 				UInt16                                       outgoingReliableSequenceNumber;
@@ -180,17 +188,19 @@ namespace Nz
 				UInt32        sentTime;
 			};
 
+			// Size of a command list node, which holds two links besides the command
+			static constexpr std::size_t commandNodeSize = std::max(sizeof(IncomingCommmand), sizeof(OutgoingCommand)) + 2 * sizeof(void*);
 			static constexpr std::size_t unsequencedWindow = ENetPeer_ReliableWindowSize / 32;
 
 			MovablePtr<ENetHost>                  m_host;
 			IpAddress                             m_address; //< Internet address of the peer
 			std::array<UInt32, unsequencedWindow> m_unsequencedWindow;
 			std::bernoulli_distribution           m_packetLossProbability;
-			std::list<IncomingCommmand>           m_dispatchedCommands;
-			std::list<OutgoingCommand>            m_outgoingReliableCommands;
-			std::list<OutgoingCommand>            m_outgoingUnreliableCommands;
-			std::list<OutgoingCommand>            m_sentReliableCommands;
-			std::list<OutgoingCommand>            m_sentUnreliableCommands;
+			CommandList<IncomingCommmand>         m_dispatchedCommands;
+			CommandList<OutgoingCommand>          m_outgoingReliableCommands;
+			CommandList<OutgoingCommand>          m_outgoingUnreliableCommands;
+			CommandList<OutgoingCommand>          m_sentReliableCommands;
+			CommandList<OutgoingCommand>          m_sentUnreliableCommands;
 			std::size_t                           m_totalWaitingData;
 			std::uniform_int_distribution<UInt16> m_packetDelayDistribution;
 			std::vector<Acknowledgement>          m_acknowledgements;
@@ -6,17 +6,6 @@
 
 namespace Nz
 {
-	inline ENetPeer::ENetPeer(ENetHost* host, UInt16 peerId) :
-	m_host(host),
-	m_state(ENetPeerState::Disconnected),
-	m_incomingSessionID(0xFF),
-	m_outgoingSessionID(0xFF),
-	m_incomingPeerID(peerId),
-	m_isSimulationEnabled(false)
-	{
-		Reset();
-	}
-
 	inline const IpAddress& ENetPeer::GetAddress() const
 	{
 		return m_address;
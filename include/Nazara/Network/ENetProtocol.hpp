@@ -27,12 +27,17 @@ namespace Nz
 	enum ENetConstants
 	{
 		ENetHost_BandwidthThrottleInterval = 1000,
+		ENetHost_DatagramBatchSize         = 32,
 		ENetHost_DefaultMaximumPacketSize  = 32 * 1024 * 1024,
 		ENetHost_DefaultMaximumWaitingData = 32 * 1024 * 1024,
 		ENetHost_DefaultMTU                = 1400,
 		ENetHost_ReceiveBufferSize         = 256 * 1024,
 		ENetHost_SendBufferSize            = 256 * 1024,
 
+		ENetShardedHost_CommandQueueSize   = 4096,
+		ENetShardedHost_EventQueueSize     = 4096,
+		ENetShardedHost_ServiceTimeout     = 1,
+
 		ENetPeer_DefaultPacketThrottle      = 32,
 		ENetPeer_DefaultRoundTripTime       = 500,
 		ENetPeer_FreeReliableWindows        = 8,
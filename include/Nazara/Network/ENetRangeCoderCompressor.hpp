@@ -0,0 +1,66 @@
+/*
+	Copyright(c) 2002 - 2016 Lee Salzman
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_ENETRANGECODERCOMPRESSOR_HPP
+#define NAZARA_ENETRANGECODERCOMPRESSOR_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Network/ENetCompressor.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API ENetRangeCoderCompressor : public ENetCompressor
+	{
+		public:
+			ENetRangeCoderCompressor();
+			~ENetRangeCoderCompressor() = default;
+
+			std::size_t Compress(const ENetPeer* peer, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize) override;
+			std::size_t Decompress(const ENetPeer* peer, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize) override;
+
+		private:
+			struct Symbol
+			{
+				// Binary indexed tree of the symbols
+				UInt8 value;
+				UInt8 count;
+				UInt16 under;
+				UInt16 left;
+				UInt16 right;
+
+				// Context defined by this symbol
+				UInt16 symbols;
+				UInt16 escapes;
+				UInt16 total;
+				UInt16 parent;
+			};
+
+			Symbol* CreateContext(UInt16 escapes, UInt16 minimum);
+			Symbol* CreateSymbol(UInt8 value, UInt8 count);
+			Symbol* DecodeRootSymbol(Symbol* context, UInt16 code, UInt8 update, UInt16 minimum, UInt8* value, UInt16* under, UInt16* count);
+			Symbol* DecodeSymbol(Symbol* context, UInt16 code, UInt8 update, UInt8* value, UInt16* under, UInt16* count);
+			Symbol* EncodeSymbol(Symbol* context, UInt8 value, UInt8 update, UInt16 minimum, UInt16* under, UInt16* count);
+
+			static void RescaleContext(Symbol* context, UInt16 minimum);
+			static UInt16 RescaleSymbol(Symbol* symbol);
+
+			std::size_t m_nextSymbol;
+			std::vector<Symbol> m_symbols;
+	};
+}
+
+#endif // NAZARA_ENETRANGECODERCOMPRESSOR_HPP
@@ -0,0 +1,120 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_ENETSHARDEDHOST_HPP
+#define NAZARA_ENETSHARDEDHOST_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ConcurrentQueue.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetPacket.hpp>
+#include <Nazara/Network/ENetProtocol.hpp>
+#include <Nazara/Network/IpAddress.hpp>
+#include <Nazara/Network/NetPacket.hpp>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	struct ENetShardedPeer
+	{
+		UInt32 connectId = 0;
+		UInt16 peerId = 0;
+		UInt16 shardIndex = 0;
+	};
+
+	struct ENetShardedEvent
+	{
+		ENetEventType type = ENetEventType::None;
+		ENetShardedPeer peer;
+		IpAddress address;
+		NetPacket packet;
+		UInt32 data = 0;
+		UInt8 channelId = 0;
+	};
+
+	class NAZARA_NETWORK_API ENetShardedHost
+	{
+		public:
+			ENetShardedHost();
+			ENetShardedHost(const ENetShardedHost&) = delete;
+			ENetShardedHost(ENetShardedHost&&) = delete;
+			inline ~ENetShardedHost();
+
+			void Broadcast(UInt8 channelId, ENetPacketFlags flags, NetPacket&& packet);
+
+			inline bool Create(NetProtocol protocol, UInt16 port, std::size_t shardCount, std::size_t peerCountPerShard, std::size_t channelCount = 0);
+			bool Create(const IpAddress& listenAddress, std::size_t shardCount, std::size_t peerCountPerShard, std::size_t channelCount = 0);
+			void Destroy();
+
+			void Disconnect(const ENetShardedPeer& peer, UInt32 data = 0);
+
+			inline IpAddress GetBoundAddress() const;
+			inline std::size_t GetShardCount() const;
+
+			bool PollEvent(ENetShardedEvent* event);
+
+			void Send(const ENetShardedPeer& peer, UInt8 channelId, ENetPacketFlags flags, NetPacket&& packet);
+
+			ENetShardedHost& operator=(const ENetShardedHost&) = delete;
+			ENetShardedHost& operator=(ENetShardedHost&&) = delete;
+
+		private:
+			enum class CommandType
+			{
+				Broadcast,
+				Disconnect,
+				Send
+			};
+
+			struct Command
+			{
+				CommandType type = CommandType::Send;
+				ENetShardedPeer peer;
+				ENetPacketFlags flags;
+				NetPacket packet;
+				UInt32 data = 0;
+				UInt8 channelId = 0;
+			};
+
+			struct PeerSlot
+			{
+				IpAddress address;
+				UInt32 connectId = 0;
+				bool isConnected = false;
+			};
+
+			struct Shard
+			{
+				Shard();
+
+				ConcurrentQueue<Command> commands;
+				ENetHost host;
+				Thread thread;
+				std::vector<ENetShardedEvent> pendingEvents;
+				std::vector<PeerSlot> peers;
+				UInt16 index;
+			};
+
+			bool CreateShards(const IpAddress& listenAddress, bool dualStack, std::size_t shardCount, std::size_t peerCountPerShard, std::size_t channelCount);
+			void ExecuteCommands(Shard& shard);
+			void FlushEvents(Shard& shard);
+			void PushCommand(Shard& shard, Command&& command);
+			void QueueEvent(Shard& shard, ENetEvent& event);
+			void RunShard(Shard& shard);
+
+			std::atomic<bool> m_isRunning;
+			std::unique_ptr<ConcurrentQueue<ENetShardedEvent>> m_events;
+			std::vector<std::unique_ptr<Shard>> m_shards;
+			IpAddress m_boundAddress;
+	};
+}
+
+#include <Nazara/Network/ENetShardedHost.inl>
+
+#endif // NAZARA_ENETSHARDEDHOST_HPP
@@ -0,0 +1,51 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	inline ENetShardedHost::~ENetShardedHost()
+	{
+		Destroy();
+	}
+
+	inline bool ENetShardedHost::Create(NetProtocol protocol, UInt16 port, std::size_t shardCount, std::size_t peerCountPerShard, std::size_t channelCount)
+	{
+		NazaraAssert(protocol != NetProtocol_Unknown, "Invalid protocol");
+
+		IpAddress any;
+		switch (protocol)
+		{
+			case NetProtocol_Unknown:
+				NazaraInternalError("Invalid protocol");
+				return false;
+
+			case NetProtocol_IPv4:
+				any = IpAddress::AnyIpV4;
+				break;
+
+			case NetProtocol_Any:
+			case NetProtocol_IPv6:
+				any = IpAddress::AnyIpV6;
+				break;
+		}
+
+		any.SetPort(port);
+		return CreateShards(any, protocol == NetProtocol_Any, shardCount, peerCountPerShard, channelCount);
+	}
+
+	inline IpAddress ENetShardedHost::GetBoundAddress() const
+	{
+		return m_boundAddress;
+	}
+
+	inline std::size_t ENetShardedHost::GetShardCount() const
+	{
+		return m_shards.size();
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
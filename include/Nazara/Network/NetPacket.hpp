@@ -10,7 +10,6 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/ByteStream.hpp>
 #include <Nazara/Core/MemoryStream.hpp>
-#include <Nazara/Core/Mutex.hpp>
 #include <Nazara/Network/Config.hpp>
 
 namespace Nz
@@ -20,6 +19,14 @@ namespace Nz
 		friend class Network;
 
 		public:
+			struct BufferStats
+			{
+				UInt64 allocatedBuffers;  //< Buffers allocated because no recycled one was available
+				UInt64 cachedReuses;      //< Buffers recycled from a thread cache
+				UInt64 freedBuffers;      //< Buffers freed because they were too big or every cache was full
+				UInt64 sharedReuses;      //< Buffers recycled from the shared pool
+			};
+
 			inline NetPacket();
 			inline NetPacket(UInt16 netCode, std::size_t minCapacity = 0);
 			inline NetPacket(UInt16 netCode, const void* ptr, std::size_t size);
@@ -49,7 +56,13 @@ namespace Nz
 			static bool DecodeHeader(const void* data, UInt32* packetSize, UInt16* netCode);
 			static bool EncodeHeader(void* data, UInt32 packetSize, UInt16 netCode);
 
+			static BufferStats GetBufferStats();
+
+			static constexpr std::size_t BufferCacheCount = 64;
+			static constexpr std::size_t BufferCacheSize = 16;
+			static constexpr std::size_t BufferSizeClassCount = 11;
 			static constexpr std::size_t HeaderSize = sizeof(UInt32) + sizeof(UInt16); //< PacketSize + NetCode
+			static constexpr std::size_t MinBufferSize = 64;
 
 		private:
 			void OnEmptyStream() override;
@@ -63,9 +76,6 @@ namespace Nz
 			std::unique_ptr<ByteArray> m_buffer;
 			MemoryStream m_memoryStream;
 			UInt16 m_netCode;
-
-			static std::unique_ptr<Mutex> s_availableBuffersMutex;
-			static std::vector<std::pair<std::size_t, std::unique_ptr<ByteArray>>> s_availableBuffers;
 	};
 }
 
@@ -10,6 +10,7 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/MovablePtr.hpp>
 #include <Nazara/Network/AbstractSocket.hpp>
+#include <vector>
 
 namespace Nz
 {
@@ -24,12 +25,15 @@ namespace Nz
 
 			void Clear();
 
+			void GetReadySockets(std::vector<SocketHandle>* readyToRead, std::vector<SocketHandle>* readyToWrite) const;
+
 			bool IsReadyToRead(const AbstractSocket& socket) const;
 			bool IsReadyToWrite(const AbstractSocket& socket) const;
 			bool IsRegistered(const AbstractSocket& socket) const;
 
 			bool RegisterSocket(AbstractSocket& socket, SocketPollEventFlags eventFlags);
 			void UnregisterSocket(AbstractSocket& socket);
+			bool UpdateSocket(AbstractSocket& socket, SocketPollEventFlags eventFlags);
 
 			unsigned int Wait(int msTimeout, SocketError* error = nullptr);
 
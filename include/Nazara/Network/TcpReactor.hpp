@@ -0,0 +1,110 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_TCPREACTOR_HPP
+#define NAZARA_TCPREACTOR_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Signal.hpp>
+#include <Nazara/Network/NetBuffer.hpp>
+#include <Nazara/Network/NetPacket.hpp>
+#include <Nazara/Network/SocketPoller.hpp>
+#include <Nazara/Network/TcpClient.hpp>
+#include <Nazara/Network/TcpServer.hpp>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API TcpReactor
+	{
+		public:
+			TcpReactor(std::size_t receiveBufferSize = 4096, std::size_t maxPacketSize = 1024 * 1024);
+			TcpReactor(const TcpReactor&) = delete;
+			TcpReactor(TcpReactor&&) = delete;
+			~TcpReactor();
+
+			std::size_t AddClient(TcpClient&& client);
+
+			void Close();
+
+			void Disconnect(std::size_t connectionId);
+
+			void Flush();
+
+			inline IpAddress GetBoundAddress() const;
+			inline std::size_t GetConnectionCount() const;
+			inline std::size_t GetMaxPacketSize() const;
+			inline std::size_t GetReceiveBufferSize() const;
+			inline IpAddress GetRemoteAddress(std::size_t connectionId) const;
+
+			inline bool IsConnected(std::size_t connectionId) const;
+
+			inline SocketState Listen(NetProtocol protocol, UInt16 port, unsigned int queueSize = 128);
+			SocketState Listen(const IpAddress& address, unsigned int queueSize = 128);
+
+			bool Send(std::size_t connectionId, const NetPacket& packet);
+			bool Send(std::size_t connectionId, NetPacket&& packet);
+
+			bool Update(int msTimeout, SocketError* error = nullptr);
+
+			TcpReactor& operator=(const TcpReactor&) = delete;
+			TcpReactor& operator=(TcpReactor&&) = delete;
+
+			static constexpr std::size_t InvalidConnection = std::numeric_limits<std::size_t>::max();
+			static constexpr std::size_t MaxSendBufferCount = 64;
+
+			// Signals:
+			NazaraSignal(OnConnected,      TcpReactor* /*reactor*/, std::size_t /*connectionId*/);
+			NazaraSignal(OnDisconnected,   TcpReactor* /*reactor*/, std::size_t /*connectionId*/, SocketError /*error*/);
+			NazaraSignal(OnPacketReceived, TcpReactor* /*reactor*/, std::size_t /*connectionId*/, NetPacket& /*packet*/);
+
+		private:
+			struct Connection
+			{
+				TcpClient client;
+				NetPacket largePacket;
+				std::size_t largePacketReceived = 0;
+				std::size_t outgoingOffset = 0;
+				std::size_t receiveBegin = 0;
+				std::size_t receiveSize = 0;
+				std::unique_ptr<UInt8[]> receiveBuffer;
+				std::vector<NetPacket> outgoingPackets;
+				bool isConnected = false;
+				bool isFlushQueued = false;
+				bool isReceivingLargePacket = false;
+				bool isWaitingForWrite = false;
+			};
+
+			void AcceptClients();
+			std::size_t AddConnection(TcpClient&& client);
+			void CloseConnection(std::size_t connectionId, SocketError error);
+			bool FlushConnection(std::size_t connectionId);
+			void QueueFlush(std::size_t connectionId);
+			bool ReceiveLargePacket(std::size_t connectionId);
+			void ReceivePackets(std::size_t connectionId);
+
+			std::unordered_map<SocketHandle, std::size_t> m_connectionByHandle;
+			std::size_t m_maxPacketSize;
+			std::size_t m_receiveBufferSize;
+			std::vector<std::unique_ptr<Connection>> m_connections;
+			std::vector<std::size_t> m_flushQueue;
+			std::vector<std::size_t> m_freeConnections;
+			std::vector<std::size_t> m_releasedConnections;
+			std::vector<NetBuffer> m_sendBuffers;
+			std::vector<SocketHandle> m_readyToRead;
+			std::vector<SocketHandle> m_readyToWrite;
+			SocketPoller m_poller;
+			TcpServer m_server;
+			bool m_isUpdating;
+	};
+}
+
+#include <Nazara/Network/TcpReactor.inl>
+
+#endif // NAZARA_TCPREACTOR_HPP
@@ -0,0 +1,116 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/TcpReactor.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the address the reactor is listening on
+	* \return Bound address, invalid if the reactor is not listening
+	*/
+
+	inline IpAddress TcpReactor::GetBoundAddress() const
+	{
+		return m_server.GetBoundAddress();
+	}
+
+	/*!
+	* \brief Gets the number of connections handled by the reactor
+	* \return Number of connected clients
+	*/
+
+	inline std::size_t TcpReactor::GetConnectionCount() const
+	{
+		return m_connectionByHandle.size();
+	}
+
+	/*!
+	* \brief Gets the maximum size of a received packet
+	* \return Maximum packet size (header included), bigger packets close their connection
+	*/
+
+	inline std::size_t TcpReactor::GetMaxPacketSize() const
+	{
+		return m_maxPacketSize;
+	}
+
+	/*!
+	* \brief Gets the size of the receive ring buffer of each connection
+	* \return Receive buffer size
+	*/
+
+	inline std::size_t TcpReactor::GetReceiveBufferSize() const
+	{
+		return m_receiveBufferSize;
+	}
+
+	/*!
+	* \brief Gets the address of the remote peer of a connection
+	* \return Remote address
+	*
+	* \param connectionId Identifier of the connection
+	*
+	* \remark Produces a NazaraAssert if the connection identifier is invalid
+	*/
+
+	inline IpAddress TcpReactor::GetRemoteAddress(std::size_t connectionId) const
+	{
+		NazaraAssert(connectionId < m_connections.size(), "Invalid connection identifier");
+
+		return m_connections[connectionId]->client.GetRemoteAddress();
+	}
+
+	/*!
+	* \brief Checks whether a connection is still active
+	* \return true If the connection is connected
+	*
+	* \param connectionId Identifier of the connection
+	*/
+
+	inline bool TcpReactor::IsConnected(std::size_t connectionId) const
+	{
+		return connectionId < m_connections.size() && m_connections[connectionId]->isConnected;
+	}
+
+	/*!
+	* \brief Listens for incoming connections
+	* \return State of the listening socket
+	*
+	* \param protocol Net protocol to listen to
+	* \param port Port to listen to
+	* \param queueSize Size of the pending connections queue
+	*
+	* \remark Produces a NazaraAssert if protocol is unknown or any
+	*/
+
+	inline SocketState TcpReactor::Listen(NetProtocol protocol, UInt16 port, unsigned int queueSize)
+	{
+		NazaraAssert(protocol != NetProtocol_Any, "Any protocol not supported for Listen");
+		NazaraAssert(protocol != NetProtocol_Unknown, "Invalid protocol");
+
+		IpAddress any;
+		switch (protocol)
+		{
+			case NetProtocol_Any:
+			case NetProtocol_Unknown:
+				NazaraInternalError("Invalid protocol Any at this point");
+				return SocketState_NotConnected;
+
+			case NetProtocol_IPv4:
+				any = IpAddress::AnyIpV4;
+				break;
+
+			case NetProtocol_IPv6:
+				any = IpAddress::AnyIpV6;
+				break;
+		}
+
+		any.SetPort(port);
+		return Listen(any, queueSize);
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
@@ -0,0 +1,25 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_UDPDATAGRAM_HPP
+#define NAZARA_UDPDATAGRAM_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Network/IpAddress.hpp>
+#include <Nazara/Network/NetBuffer.hpp>
+
+namespace Nz
+{
+	struct UdpDatagram
+	{
+		IpAddress address; //< Peer the datagram was received from or is sent to
+		NetBuffer* buffers;
+		std::size_t bufferCount;
+		std::size_t dataLength; //< Number of bytes received
+	};
+}
+
+#endif // NAZARA_UDPDATAGRAM_HPP
@@ -15,6 +15,7 @@ namespace Nz
 {
 	struct NetBuffer;
 	class NetPacket;
+	struct UdpDatagram;
 
 	class NAZARA_NETWORK_API UdpSocket : public AbstractSocket
 	{
@@ -30,19 +31,23 @@ namespace Nz
 			inline bool Create(NetProtocol protocol);
 
 			void EnableBroadcasting(bool broadcasting);
+			bool EnableReusePort(bool reusePort);
 
 			inline IpAddress GetBoundAddress() const;
 			inline UInt16 GetBoundPort() const;
 
 			inline bool IsBroadcastingEnabled() const;
+			inline bool IsReusePortEnabled() const;
 
 			std::size_t QueryMaxDatagramSize();
 
 			bool Receive(void* buffer, std::size_t size, IpAddress* from, std::size_t* received);
+			bool ReceiveDatagrams(UdpDatagram* datagrams, std::size_t datagramCount, std::size_t* received);
 			bool ReceiveMultiple(NetBuffer* buffers, std::size_t bufferCount, IpAddress* from, std::size_t* received);
 			bool ReceivePacket(NetPacket* packet, IpAddress* from);
 
 			bool Send(const IpAddress& to, const void* buffer, std::size_t size, std::size_t* sent);
+			bool SendDatagrams(const UdpDatagram* datagrams, std::size_t datagramCount, std::size_t* sent);
 			bool SendMultiple(const IpAddress& to, const NetBuffer* buffers, std::size_t bufferCount, std::size_t* sent);
 			bool SendPacket(const IpAddress& to, const NetPacket& packet);
 
@@ -52,6 +57,7 @@ namespace Nz
 
 			IpAddress m_boundAddress;
 			bool m_isBroadCastingEnabled;
+			bool m_isReusePortEnabled;
 	};
 }
 
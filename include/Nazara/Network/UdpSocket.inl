@@ -11,7 +11,9 @@ namespace Nz
 	*/
 
 	inline UdpSocket::UdpSocket() :
-	AbstractSocket(SocketType_UDP)
+	AbstractSocket(SocketType_UDP),
+	m_isBroadCastingEnabled(false),
+	m_isReusePortEnabled(false)
 	{
 	}
 
@@ -35,7 +37,9 @@ namespace Nz
 
 	inline UdpSocket::UdpSocket(UdpSocket&& udpSocket) noexcept :
 	AbstractSocket(std::move(udpSocket)),
-	m_boundAddress(std::move(udpSocket.m_boundAddress))
+	m_boundAddress(std::move(udpSocket.m_boundAddress)),
+	m_isBroadCastingEnabled(udpSocket.m_isBroadCastingEnabled),
+	m_isReusePortEnabled(udpSocket.m_isReusePortEnabled)
 	{
 	}
 
@@ -112,6 +116,16 @@ namespace Nz
 	{
 		return m_isBroadCastingEnabled;
 	}
+
+	/*!
+	* \brief Checks whether other sockets are allowed to bind the same port
+	* \return true If it is the case
+	*/
+
+	inline bool UdpSocket::IsReusePortEnabled() const
+	{
+		return m_isReusePortEnabled;
+	}
 }
 
 #include <Nazara/Network/DebugOff.hpp>
@@ -8,6 +8,7 @@
 #define NAZARA_TEXTURE_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/IndexPool.hpp>
 #include <Nazara/Core/ObjectLibrary.hpp>
 #include <Nazara/Core/ObjectRef.hpp>
 #include <Nazara/Core/Resource.hpp>
@@ -59,6 +60,7 @@ namespace Nz
 			std::size_t GetMemoryUsage() const override;
 			std::size_t GetMemoryUsage(UInt8 level) const override;
 			Vector3ui GetSize(UInt8 level = 0) const override;
+			inline UInt32 GetSortIndex() const;
 			ImageType GetType() const override;
 			unsigned int GetWidth(UInt8 level = 0) const override;
 
@@ -125,11 +127,13 @@ namespace Nz
 			static bool Initialize();
 			static void Uninitialize();
 
+			IndexPool::Index m_sortIndex{s_sortIndexPool};
 			TextureImpl* m_impl = nullptr;
 
 			static TextureLibrary::LibraryMap s_library;
 			static TextureManager::ManagerMap s_managerMap;
 			static TextureManager::ManagerParams s_managerParameters;
+			static IndexPool s_sortIndexPool;
 	};
 }
 
@@ -7,6 +7,11 @@
 
 namespace Nz
 {
+	inline UInt32 Texture::GetSortIndex() const
+	{
+		return m_sortIndex.Get();
+	}
+
 	template<typename... Args>
 	TextureRef Texture::New(Args&&... args)
 	{
@@ -17,8 +17,11 @@
 #include <Nazara/Core/ResourceParameters.hpp>
 #include <Nazara/Utility/AbstractAtlas.hpp>
 #include <Nazara/Utility/Enums.hpp>
+#include <array>
+#include <deque>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace Nz
 {
@@ -67,6 +70,7 @@ namespace Nz
 			String GetFamilyName() const;
 			int GetKerning(unsigned int characterSize, char32_t first, char32_t second) const;
 			const Glyph& GetGlyph(unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const;
+			void GetGlyphs(unsigned int characterSize, TextStyleFlags style, float outlineThickness, const char32_t* characters, std::size_t characterCount, const Glyph** glyphs) const;
 			unsigned int GetGlyphBorder() const;
 			unsigned int GetMinimumStepSize() const;
 			const SizeInfo& GetSizeInfo(unsigned int characterSize) const;
@@ -130,13 +134,17 @@ namespace Nz
 			NazaraSignal(OnFontSizeInfoCacheCleared, const Font* /*font*/);
 
 		private:
-			using GlyphMap = std::unordered_map<char32_t, Glyph>;
+			struct GlyphCacheEntry;
+			struct GlyphTable;
 
 			UInt64 ComputeKey(unsigned int characterSize, TextStyleFlags style, float outlineThickness) const;
+			GlyphCacheEntry& GetGlyphCacheEntry(UInt64 key, char32_t character) const;
+			GlyphTable& GetGlyphTable(UInt64 key) const;
 			void OnAtlasCleared(const AbstractAtlas* atlas);
 			void OnAtlasLayerChange(const AbstractAtlas* atlas, AbstractImage* oldLayer, AbstractImage* newLayer);
 			void OnAtlasRelease(const AbstractAtlas* atlas);
-			const Glyph& PrecacheGlyph(GlyphMap& glyphMap, unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const;
+			const Glyph& PrecacheGlyph(UInt64 key, unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const;
+			void ResetGlyphCache();
 
 			static bool Initialize();
 			static void Uninitialize();
@@ -145,11 +153,37 @@ namespace Nz
 			NazaraSlot(AbstractAtlas, OnAtlasLayerChange, m_atlasLayerChangeSlot);
 			NazaraSlot(AbstractAtlas, OnAtlasRelease, m_atlasReleaseSlot);
 
+			struct GlyphCacheEntry
+			{
+				UInt64 key;
+				Glyph* glyph;
+				char32_t character;
+			};
+
+			struct GlyphTable
+			{
+				UInt64 key;
+				std::array<Glyph*, 256> glyphs; //< Latin-1 glyphs, directly indexed by character
+			};
+
+			struct KerningCacheEntry
+			{
+				UInt64 characters;
+				unsigned int characterSize;
+				int kerning;
+				bool used;
+			};
+
 			std::shared_ptr<AbstractAtlas> m_atlas;
 			std::unique_ptr<FontData> m_data;
-			mutable std::unordered_map<UInt64, std::unordered_map<UInt64, int>> m_kerningCache;
-			mutable std::unordered_map<UInt64, GlyphMap> m_glyphes;
+			mutable std::deque<Glyph> m_glyphes;
 			mutable std::unordered_map<UInt64, SizeInfo> m_sizeInfoCache;
+			mutable std::vector<GlyphCacheEntry> m_glyphCache;
+			mutable std::vector<KerningCacheEntry> m_kerningCache;
+			mutable std::vector<std::unique_ptr<GlyphTable>> m_glyphTables;
+			mutable std::size_t m_glyphCacheSize;
+			mutable std::size_t m_kerningCacheSize;
+			mutable std::size_t m_lastGlyphTable;
 			unsigned int m_glyphBorder;
 			unsigned int m_minimumStepSize;
 
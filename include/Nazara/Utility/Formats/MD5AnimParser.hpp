@@ -8,6 +8,7 @@
 #define NAZARA_FORMATS_MD5ANIMPARSER_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/BufferedStream.hpp>
 #include <Nazara/Utility/Config.hpp>
 #include <Nazara/Math/Box.hpp>
 #include <Nazara/Math/Quaternion.hpp>
@@ -42,7 +43,7 @@ namespace Nz
 			};
 
 			MD5AnimParser(Stream& stream);
-			~MD5AnimParser();
+			~MD5AnimParser() = default;
 
 			Ternary Check();
 
@@ -68,8 +69,7 @@ namespace Nz
 			std::vector<float> m_animatedComponents;
 			std::vector<Frame> m_frames;
 			std::vector<Joint> m_joints;
-			Stream& m_stream;
-			StreamOptionFlags m_streamFlags;
+			BufferedStream m_stream;
 			String m_currentLine;
 			bool m_keepLastLine;
 			unsigned int m_frameIndex;
@@ -8,6 +8,7 @@
 #define NAZARA_FORMATS_MD5MESHPARSER_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/BufferedStream.hpp>
 #include <Nazara/Core/String.hpp>
 #include <Nazara/Math/Quaternion.hpp>
 #include <Nazara/Math/Vector2.hpp>
@@ -53,7 +54,7 @@ namespace Nz
 			};
 
 			MD5MeshParser(Stream& stream);
-			~MD5MeshParser();
+			~MD5MeshParser() = default;
 
 			Ternary Check();
 
@@ -74,8 +75,7 @@ namespace Nz
 
 			std::vector<Joint> m_joints;
 			std::vector<Mesh> m_meshes;
-			Stream& m_stream;
-			StreamOptionFlags m_streamFlags;
+			BufferedStream m_stream;
 			String m_currentLine;
 			bool m_keepLastLine;
 			unsigned int m_lineCount;
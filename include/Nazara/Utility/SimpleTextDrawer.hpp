@@ -75,7 +75,7 @@ namespace Nz
 			inline void ConnectFontSlots();
 			inline void DisconnectFontSlots();
 
-			bool GenerateGlyph(Glyph& glyph, char32_t character, float outlineThickness, bool lineWrap, Nz::Color color, int renderOrder, int* advance) const;
+			bool GenerateGlyph(Glyph& glyph, const Font::Glyph& fontGlyph, float outlineThickness, bool lineWrap, Nz::Color color, int renderOrder, int* advance) const;
 			void GenerateGlyphs(const String& text) const;
 
 			inline float GetLineHeight(const Font::SizeInfo& sizeInfo) const;
@@ -100,6 +100,8 @@ namespace Nz
 			NazaraSlot(Font, OnFontRelease, m_fontReleaseSlot);
 
 			mutable std::size_t m_lastSeparatorGlyph;
+			mutable std::vector<const Font::Glyph*> m_fontGlyphs;
+			mutable std::vector<const Font::Glyph*> m_fontOutlineGlyphs;
 			mutable std::vector<Glyph> m_glyphs;
 			mutable std::vector<Line> m_lines;
 			Color m_color;
@@ -0,0 +1,108 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_TRANSFORMHIERARCHY_HPP
+#define NAZARA_TRANSFORMHIERARCHY_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Bitset.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Utility/Config.hpp>
+#include <Nazara/Utility/Enums.hpp>
+#include <limits>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_UTILITY_API TransformHierarchy
+	{
+		public:
+			using NodeId = UInt32;
+
+			TransformHierarchy() = default;
+			TransformHierarchy(const TransformHierarchy&) = default;
+			TransformHierarchy(TransformHierarchy&&) noexcept = default;
+			~TransformHierarchy() = default;
+
+			void Clear();
+
+			NodeId CreateNode(NodeId parent = InvalidNodeId);
+
+			void DestroyNode(NodeId node);
+
+			inline bool GetInheritPosition(NodeId node) const;
+			inline bool GetInheritRotation(NodeId node) const;
+			inline bool GetInheritScale(NodeId node) const;
+			inline std::size_t GetNodeCount() const;
+			inline NodeId GetParent(NodeId node) const;
+			inline Vector3f GetPosition(NodeId node, CoordSys coordSys = CoordSys_Local) const;
+			inline Quaternionf GetRotation(NodeId node, CoordSys coordSys = CoordSys_Local) const;
+			inline Vector3f GetScale(NodeId node, CoordSys coordSys = CoordSys_Local) const;
+			inline const Matrix4f& GetTransformMatrix(NodeId node) const;
+
+			inline bool IsNodeValid(NodeId node) const;
+
+			void SetInheritPosition(NodeId node, bool inheritPosition);
+			void SetInheritRotation(NodeId node, bool inheritRotation);
+			void SetInheritScale(NodeId node, bool inheritScale);
+			void SetParent(NodeId node, NodeId parent = InvalidNodeId);
+			void SetPosition(NodeId node, const Vector3f& position);
+			void SetRotation(NodeId node, const Quaternionf& rotation);
+			void SetScale(NodeId node, const Vector3f& scale);
+
+			void Update(bool parallel = false);
+
+			TransformHierarchy& operator=(const TransformHierarchy&) = default;
+			TransformHierarchy& operator=(TransformHierarchy&&) noexcept = default;
+
+			static constexpr NodeId InvalidNodeId = std::numeric_limits<NodeId>::max();
+
+		private:
+			enum NodeFlags : UInt8
+			{
+				NodeFlags_InheritPosition = 0x1,
+				NodeFlags_InheritRotation = 0x2,
+				NodeFlags_InheritScale    = 0x4
+			};
+
+			inline UInt32 GetSlot(NodeId node) const;
+			inline void InvalidateSlot(UInt32 slot);
+			void PropagateInvalidation();
+			void SetFlag(NodeId node, NodeFlags flag, bool enable);
+			void SortNodes();
+			void UpdateSlots(UInt32 firstSlot, UInt32 lastSlot);
+
+			static constexpr UInt32 InvalidSlot = std::numeric_limits<UInt32>::max();
+
+			// Per-node data, indexed by slot (nodes are sorted by depth, so parents always come before their children)
+			std::vector<Matrix4f> m_transformMatrices;
+			std::vector<Quaternionf> m_globalRotations;
+			std::vector<Quaternionf> m_rotations;
+			std::vector<Vector3f> m_globalPositions;
+			std::vector<Vector3f> m_globalScales;
+			std::vector<Vector3f> m_positions;
+			std::vector<Vector3f> m_scales;
+			std::vector<NodeId> m_nodeIds;
+			std::vector<NodeId> m_parentIds;
+			std::vector<UInt32> m_parentSlots;
+			std::vector<UInt8> m_flags;
+			Bitset<UInt64> m_invalidatedSlots;
+
+			// Per-id data
+			std::vector<NodeId> m_freeIds;
+			std::vector<UInt32> m_childCounts;
+			std::vector<UInt32> m_slots;
+
+			std::vector<UInt32> m_levelOffsets; //< First slot of each depth level, followed by the slot count
+			bool m_sortRequired = false;
+	};
+}
+
+#include <Nazara/Utility/TransformHierarchy.inl>
+
+#endif // NAZARA_TRANSFORMHIERARCHY_HPP
@@ -0,0 +1,104 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/TransformHierarchy.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	inline bool TransformHierarchy::GetInheritPosition(NodeId node) const
+	{
+		return (m_flags[GetSlot(node)] & NodeFlags_InheritPosition) != 0;
+	}
+
+	inline bool TransformHierarchy::GetInheritRotation(NodeId node) const
+	{
+		return (m_flags[GetSlot(node)] & NodeFlags_InheritRotation) != 0;
+	}
+
+	inline bool TransformHierarchy::GetInheritScale(NodeId node) const
+	{
+		return (m_flags[GetSlot(node)] & NodeFlags_InheritScale) != 0;
+	}
+
+	inline std::size_t TransformHierarchy::GetNodeCount() const
+	{
+		return m_nodeIds.size();
+	}
+
+	inline TransformHierarchy::NodeId TransformHierarchy::GetParent(NodeId node) const
+	{
+		return m_parentIds[GetSlot(node)];
+	}
+
+	/*!
+	* \brief Gets the position of a node
+	* \return Local position, or global position as computed by the last call to Update
+	*
+	* \param node Identifier of the node
+	* \param coordSys Coordinate system of the position
+	*/
+	inline Vector3f TransformHierarchy::GetPosition(NodeId node, CoordSys coordSys) const
+	{
+		UInt32 slot = GetSlot(node);
+		return (coordSys == CoordSys_Global) ? m_globalPositions[slot] : m_positions[slot];
+	}
+
+	/*!
+	* \brief Gets the rotation of a node
+	* \return Local rotation, or global rotation as computed by the last call to Update
+	*
+	* \param node Identifier of the node
+	* \param coordSys Coordinate system of the rotation
+	*/
+	inline Quaternionf TransformHierarchy::GetRotation(NodeId node, CoordSys coordSys) const
+	{
+		UInt32 slot = GetSlot(node);
+		return (coordSys == CoordSys_Global) ? m_globalRotations[slot] : m_rotations[slot];
+	}
+
+	/*!
+	* \brief Gets the scale of a node
+	* \return Local scale, or global scale as computed by the last call to Update
+	*
+	* \param node Identifier of the node
+	* \param coordSys Coordinate system of the scale
+	*/
+	inline Vector3f TransformHierarchy::GetScale(NodeId node, CoordSys coordSys) const
+	{
+		UInt32 slot = GetSlot(node);
+		return (coordSys == CoordSys_Global) ? m_globalScales[slot] : m_scales[slot];
+	}
+
+	/*!
+	* \brief Gets the global transform matrix of a node, as computed by the last call to Update
+	* \return Reference to the matrix, invalidated by the next structural change (node creation, destruction or reparenting) followed by Update
+	*
+	* \param node Identifier of the node
+	*/
+	inline const Matrix4f& TransformHierarchy::GetTransformMatrix(NodeId node) const
+	{
+		return m_transformMatrices[GetSlot(node)];
+	}
+
+	inline bool TransformHierarchy::IsNodeValid(NodeId node) const
+	{
+		return node < m_slots.size() && m_slots[node] != InvalidSlot;
+	}
+
+	inline UInt32 TransformHierarchy::GetSlot(NodeId node) const
+	{
+		NazaraAssert(IsNodeValid(node), "Invalid node");
+
+		return m_slots[node];
+	}
+
+	inline void TransformHierarchy::InvalidateSlot(UInt32 slot)
+	{
+		m_invalidatedSlots.Set(static_cast<std::size_t>(slot));
+	}
+}
+
+#include <Nazara/Utility/DebugOff.hpp>
@@ -8,6 +8,7 @@
 #define NAZARA_VERTEXBUFFER_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/IndexPool.hpp>
 #include <Nazara/Core/ObjectRef.hpp>
 #include <Nazara/Core/RefCounted.hpp>
 #include <Nazara/Core/Signal.hpp>
@@ -37,6 +38,7 @@ namespace Nz
 
 			inline const BufferRef& GetBuffer() const;
 			inline UInt32 GetEndOffset() const;
+			inline UInt32 GetSortIndex() const;
 			inline UInt32 GetStartOffset() const;
 			inline UInt32 GetStride() const;
 			inline UInt32 GetVertexCount() const;
@@ -69,10 +71,13 @@ namespace Nz
 
 		private:
 			BufferRef m_buffer;
+			IndexPool::Index m_sortIndex{s_sortIndexPool};
 			UInt32 m_endOffset;
 			UInt32 m_startOffset;
 			UInt32 m_vertexCount;
 			VertexDeclarationConstRef m_vertexDeclaration;
+
+			static IndexPool s_sortIndexPool;
 	};
 }
 
@@ -17,6 +17,11 @@ namespace Nz
 		return m_endOffset;
 	}
 
+	inline UInt32 VertexBuffer::GetSortIndex() const
+	{
+		return m_sortIndex.Get();
+	}
+
 	inline UInt32 VertexBuffer::GetStride() const
 	{
 		return static_cast<UInt32>(m_vertexDeclaration->GetStride());
@@ -0,0 +1,356 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Archive.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/CallOnExit.hpp>
+#include <Nazara/Core/Directory.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/LZCodec.hpp>
+#include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		std::vector<Archive*> s_mountedArchives;
+		Mutex s_mountMutex;
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::Archive
+	* \brief Core class that represents a read-only archive packing many files in one
+	*
+	* The archive is mapped in memory and starts with a hash table indexing its entries by path, looking an entry up does not touch the disk.
+	* Entries may be compressed (see LZCodec), uncompressed entries are directly accessible from the mapping.
+	*
+	* Once mounted in a directory, the entries of an archive can be opened through MappedFile (and thus loaded by resource loaders) as if they were files in that directory.
+	*
+	* Archives are created with ArchiveBuilder.
+	*/
+
+	/*!
+	* \brief Constructs an Archive object by default
+	*/
+	Archive::Archive() :
+	m_pathTable(nullptr)
+	{
+	}
+
+	/*!
+	* \brief Destructs the object, unmounting and closing it
+	*/
+	Archive::~Archive()
+	{
+		Close();
+	}
+
+	/*!
+	* \brief Closes the archive, unmounting it first
+	*/
+	void Archive::Close()
+	{
+		Unmount();
+
+		m_entries.clear();
+		m_file.Close();
+		m_pathTable = nullptr;
+		m_slots.clear();
+	}
+
+	/*!
+	* \brief Finds an entry by its path
+	* \return Pointer to the entry, or nullptr if the archive holds no such entry
+	*
+	* \param entryPath Path of the entry inside the archive, using '/' as separator
+	*/
+	const Archive::Entry* Archive::FindEntry(const String& entryPath) const
+	{
+		if (m_slots.empty())
+			return nullptr;
+
+		UInt64 hash = ComputeEntryHash(entryPath);
+
+		std::size_t mask = m_slots.size() - 1;
+		for (std::size_t i = 0, slot = hash & mask; i < m_slots.size(); ++i, slot = (slot + 1) & mask)
+		{
+			UInt32 entryIndex = m_slots[slot];
+			if (entryIndex == InvalidEntryIndex)
+				break;
+
+			const Entry& entry = m_entries[entryIndex];
+			if (entry.pathHash == hash && entry.pathSize == entryPath.GetSize() && std::memcmp(&m_pathTable[entry.pathOffset], entryPath.GetConstBuffer(), entry.pathSize) == 0)
+				return &entry;
+		}
+
+		return nullptr;
+	}
+
+	/*!
+	* \brief Gets the path of an entry
+	* \return Path of the entry inside the archive
+	*
+	* \param entry Entry of this archive
+	*/
+	String Archive::GetEntryPath(const Entry& entry) const
+	{
+		NazaraAssert(IsOpen(), "Archive is not open");
+
+		return String(reinterpret_cast<const char*>(&m_pathTable[entry.pathOffset]), entry.pathSize);
+	}
+
+	/*!
+	* \brief Mounts the archive in a directory
+	* \return true if successful
+	*
+	* \param mountPoint Directory in which the entries of the archive will appear
+	*
+	* \remark Archives mounted last have priority over the others, and over the files of the disk
+	* \remark Mounting should be done before starting to load resources from other threads
+	*/
+	bool Archive::Mount(const String& mountPoint)
+	{
+		NazaraAssert(IsOpen(), "Archive is not open");
+
+		Unmount();
+
+		String mountPath = File::AbsolutePath(mountPoint);
+		if (mountPath.IsEmpty())
+		{
+			NazaraError("Invalid mount point: " + mountPoint);
+			return false;
+		}
+
+		if (mountPath[mountPath.GetSize() - 1] != NAZARA_DIRECTORY_SEPARATOR)
+			mountPath += NAZARA_DIRECTORY_SEPARATOR;
+
+		LockGuard lock(s_mountMutex);
+
+		m_mountPoint = std::move(mountPath);
+		s_mountedArchives.push_back(this);
+
+		return true;
+	}
+
+	/*!
+	* \brief Opens an archive file
+	* \return true if the file is a valid archive
+	*
+	* \param filePath Path to the archive
+	*
+	* \remark Produces a NazaraError if the file cannot be mapped or is not a valid archive
+	*/
+	bool Archive::Open(const String& filePath)
+	{
+		Close();
+
+		if (!m_file.Open(filePath))
+		{
+			NazaraError("Failed to open archive " + filePath);
+			return false;
+		}
+
+		CallOnExit closeOnFailure([this]() { Close(); });
+
+		UInt64 fileSize = m_file.GetSize();
+		if (fileSize < HeaderSize)
+		{
+			NazaraError(filePath + " is not an archive: file is too small");
+			return false;
+		}
+
+		MemoryView memory(m_file.GetData(), fileSize);
+
+		ByteStream stream(&memory);
+		stream.SetDataEndianness(Endianness_LittleEndian);
+
+		UInt32 magic, version, entryCount, slotCount;
+		UInt64 entryTableOffset, slotTableOffset, pathTableOffset, pathTableSize;
+		stream >> magic >> version >> entryCount >> slotCount >> entryTableOffset >> slotTableOffset >> pathTableOffset >> pathTableSize;
+
+		if (magic != Magic)
+		{
+			NazaraError(filePath + " is not an archive: invalid magic number");
+			return false;
+		}
+
+		if (version != Version)
+		{
+			NazaraError("Archive " + filePath + " has an unsupported version (" + String::Number(version) + ')');
+			return false;
+		}
+
+		// Validate the tables before reading anything, we don't want a corrupted archive to make us read out of the mapping
+		bool validSlotCount = (slotCount == 0) ? entryCount == 0 : (slotCount & (slotCount - 1)) == 0 && slotCount > entryCount;
+		if (!validSlotCount ||
+		    entryTableOffset > fileSize || (fileSize - entryTableOffset) / EntrySize < entryCount ||
+		    slotTableOffset > fileSize || (fileSize - slotTableOffset) / sizeof(UInt32) < slotCount ||
+		    pathTableOffset > fileSize || fileSize - pathTableOffset < pathTableSize)
+		{
+			NazaraError("Archive " + filePath + " is corrupted: invalid tables");
+			return false;
+		}
+
+		m_entries.resize(entryCount);
+
+		memory.SetCursorPos(entryTableOffset);
+		for (Entry& entry : m_entries)
+		{
+			UInt32 compression, reserved;
+			stream >> entry.pathHash >> entry.offset >> entry.size >> entry.storedSize >> entry.pathOffset >> entry.pathSize >> compression >> reserved;
+
+			// Compressed entries are decompressed in a buffer of their size, which must be bounded by what their stored data can expand to
+			if (compression > ArchiveCompression_Max ||
+			    (compression == ArchiveCompression_None && entry.size != entry.storedSize) ||
+			    entry.offset > fileSize || fileSize - entry.offset < entry.storedSize ||
+			    entry.pathOffset > pathTableSize || pathTableSize - entry.pathOffset < entry.pathSize ||
+			    entry.size > entry.storedSize * MaxCompressionRatio + 16 ||
+			    entry.size > std::numeric_limits<std::size_t>::max())
+			{
+				NazaraError("Archive " + filePath + " is corrupted: invalid entry");
+				return false;
+			}
+
+			entry.compression = static_cast<ArchiveCompression>(compression);
+		}
+
+		m_slots.resize(slotCount);
+
+		memory.SetCursorPos(slotTableOffset);
+		for (UInt32& slot : m_slots)
+		{
+			stream >> slot;
+			if (slot != InvalidEntryIndex && slot >= entryCount)
+			{
+				NazaraError("Archive " + filePath + " is corrupted: invalid slot");
+				return false;
+			}
+		}
+
+		m_pathTable = m_file.GetData() + pathTableOffset;
+
+		closeOnFailure.Reset();
+		return true;
+	}
+
+	/*!
+	* \brief Reads the decompressed data of an entry
+	* \return true if successful
+	*
+	* \param entry Entry of this archive
+	* \param buffer Buffer receiving the data, it must be at least entry.size bytes long
+	*
+	* \remark Produces a NazaraError if the entry data is corrupted
+	*/
+	bool Archive::ReadEntry(const Entry& entry, void* buffer) const
+	{
+		NazaraAssert(IsOpen(), "Archive is not open");
+		NazaraAssert(buffer || entry.size == 0, "Invalid buffer");
+
+		const UInt8* data = GetEntryData(entry);
+		switch (entry.compression)
+		{
+			case ArchiveCompression_None:
+				if (entry.size > 0)
+					std::memcpy(buffer, data, static_cast<std::size_t>(entry.size));
+
+				return true;
+
+			case ArchiveCompression_LZ:
+				if (LZCodec::Decompress(data, static_cast<std::size_t>(entry.storedSize), buffer, static_cast<std::size_t>(entry.size)) != entry.size)
+				{
+					NazaraError("Failed to decompress entry " + GetEntryPath(entry) + ": data is corrupted");
+					return false;
+				}
+
+				return true;
+		}
+
+		NazaraError("Compression not handled (0x" + String::Number(entry.compression, 16) + ')');
+		return false;
+	}
+
+	/*!
+	* \brief Unmounts the archive, its entries are no longer accessible through the file system
+	*
+	* \remark Files opened from the archive must be closed before unmounting it
+	*/
+	void Archive::Unmount()
+	{
+		if (m_mountPoint.IsEmpty())
+			return;
+
+		LockGuard lock(s_mountMutex);
+
+		s_mountedArchives.erase(std::find(s_mountedArchives.begin(), s_mountedArchives.end(), this));
+		m_mountPoint.Clear();
+	}
+
+	/*!
+	* \brief Computes the hash used to index an entry path
+	* \return 64 bits FNV-1a hash of the path
+	*
+	* \param entryPath Path of the entry
+	*/
+	UInt64 Archive::ComputeEntryHash(const String& entryPath)
+	{
+		UInt64 hash = 14695981039346656037ULL;
+		for (std::size_t i = 0; i < entryPath.GetSize(); ++i)
+		{
+			hash ^= static_cast<UInt8>(entryPath[i]);
+			hash *= 1099511628211ULL;
+		}
+
+		return hash;
+	}
+
+	/*!
+	* \brief Finds the mounted archive holding a file
+	* \return Archive holding the file, or nullptr if the file is not part of any mounted archive
+	*
+	* \param filePath Absolute path of the file
+	* \param entry Optional pointer receiving the entry of the file
+	*/
+	const Archive* Archive::FindMountedEntry(const String& filePath, const Entry** entry)
+	{
+		LockGuard lock(s_mountMutex);
+
+		for (auto it = s_mountedArchives.rbegin(); it != s_mountedArchives.rend(); ++it)
+		{
+			const Archive* archive = *it;
+			if (!filePath.StartsWith(archive->m_mountPoint))
+				continue;
+
+			String entryPath = filePath.SubString(archive->m_mountPoint.GetSize());
+			#ifdef NAZARA_PLATFORM_WINDOWS
+			entryPath.Replace(NAZARA_DIRECTORY_SEPARATOR, '/');
+			#endif
+
+			if (const Entry* archiveEntry = archive->FindEntry(entryPath))
+			{
+				if (entry)
+					*entry = archiveEntry;
+
+				return archive;
+			}
+		}
+
+		return nullptr;
+	}
+
+	constexpr std::size_t Archive::DataAlignment;
+	constexpr std::size_t Archive::EntrySize;
+	constexpr std::size_t Archive::HeaderSize;
+	constexpr UInt32 Archive::InvalidEntryIndex;
+	constexpr UInt32 Archive::Magic;
+	constexpr UInt32 Archive::Version;
+}
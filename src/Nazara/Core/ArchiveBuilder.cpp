@@ -0,0 +1,287 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ArchiveBuilder.hpp>
+#include <Nazara/Core/Archive.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/Directory.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/LZCodec.hpp>
+#include <Nazara/Core/MappedFile.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		UInt64 Align(UInt64 offset, UInt64 alignment)
+		{
+			return (offset + alignment - 1) / alignment * alignment;
+		}
+
+		bool WritePadding(File& file, UInt64 offset)
+		{
+			static const UInt8 zeroes[64] = {};
+
+			UInt64 cursorPos = file.GetCursorPos();
+			NazaraAssert(offset - cursorPos <= sizeof(zeroes), "Padding is too big");
+
+			std::size_t paddingSize = static_cast<std::size_t>(offset - cursorPos);
+			return file.Write(zeroes, paddingSize) == paddingSize;
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::ArchiveBuilder
+	* \brief Core class that packs files into an archive readable by Archive
+	*
+	* The layout of an archive is the following (every integer is stored in little-endian):
+	* - A header: magic number, version, entry count, slot count, and the offsets of the tables
+	* - The data of the entries, each aligned on 16 bytes
+	* - The entry table: hash, offset, size, stored size, path offset, path size and compression of each entry
+	* - The slot table: a power of two sized open-addressing hash table of entry indices, indexed by the path hash
+	* - The path table: the paths of the entries, one after the other
+	*/
+
+	/*!
+	* \brief Adds every file of a directory (and of its subdirectories) to the archive
+	* \return true if every file was added
+	*
+	* \param directoryPath Path of the directory
+	* \param entryDirectory Directory of the archive in which the files are stored, empty for the root
+	* \param compression Compression of the entries
+	*/
+	bool ArchiveBuilder::AddDirectory(const String& directoryPath, const String& entryDirectory, ArchiveCompression compression)
+	{
+		Directory directory(directoryPath);
+		if (!directory.Open())
+		{
+			NazaraError("Failed to open directory " + directoryPath);
+			return false;
+		}
+
+		String entryPrefix = entryDirectory;
+		if (!entryPrefix.IsEmpty() && !entryPrefix.EndsWith('/'))
+			entryPrefix += '/';
+
+		while (directory.NextResult())
+		{
+			String entryPath = entryPrefix + directory.GetResultName();
+			if (directory.IsResultDirectory())
+			{
+				if (!AddDirectory(directory.GetResultPath(), entryPath, compression))
+					return false;
+			}
+			else if (!AddFile(entryPath, directory.GetResultPath(), compression))
+				return false;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Adds an entry to the archive
+	* \return true if successful
+	*
+	* \param entryPath Path of the entry inside the archive, '/' being the separator
+	* \param data Content of the entry
+	* \param size Size of the content
+	* \param compression Compression of the entry, if compressing does not reduce the size the entry is stored without compression
+	*
+	* \remark Produces a NazaraError if an entry with the same path was already added
+	*/
+	bool ArchiveBuilder::AddEntry(const String& entryPath, const void* data, std::size_t size, ArchiveCompression compression)
+	{
+		NazaraAssert(data || size == 0, "Invalid data");
+
+		String path = entryPath;
+		path.Replace('\\', '/');
+		while (path.StartsWith('/'))
+			path = path.SubString(1);
+
+		if (path.IsEmpty())
+		{
+			NazaraError("Invalid entry path: " + entryPath);
+			return false;
+		}
+
+		if (m_entryIndices.find(path) != m_entryIndices.end())
+		{
+			NazaraError("Archive already has an entry named " + path);
+			return false;
+		}
+
+		PendingEntry entry;
+		entry.compression = ArchiveCompression_None;
+		entry.size = size;
+
+		switch (compression)
+		{
+			case ArchiveCompression_None:
+				break;
+
+			case ArchiveCompression_LZ:
+			{
+				ByteArray compressedData(LZCodec::GetMaxCompressedSize(size), 0);
+
+				std::size_t compressedSize = LZCodec::Compress(data, size, compressedData.GetBuffer(), compressedData.GetSize());
+				if (compressedSize > 0 && compressedSize < size)
+				{
+					compressedData.Resize(compressedSize);
+					compressedData.ShrinkToFit();
+
+					entry.compression = ArchiveCompression_LZ;
+					entry.data = std::move(compressedData);
+				}
+				break;
+			}
+		}
+
+		if (entry.compression == ArchiveCompression_None)
+			entry.data = ByteArray(data, size);
+
+		entry.path = path;
+
+		m_entryIndices.emplace(std::move(path), m_entries.size());
+		m_entries.emplace_back(std::move(entry));
+
+		return true;
+	}
+
+	/*!
+	* \brief Adds the content of a file to the archive
+	* \return true if successful
+	*
+	* \param entryPath Path of the entry inside the archive, '/' being the separator
+	* \param filePath Path of the file to add
+	* \param compression Compression of the entry
+	*/
+	bool ArchiveBuilder::AddFile(const String& entryPath, const String& filePath, ArchiveCompression compression)
+	{
+		MappedFile file;
+		if (!file.Open(filePath))
+		{
+			NazaraError("Failed to open file " + filePath);
+			return false;
+		}
+
+		return AddEntry(entryPath, file.GetData(), static_cast<std::size_t>(file.GetSize()), compression);
+	}
+
+	/*!
+	* \brief Removes every entry added so far
+	*/
+	void ArchiveBuilder::Clear()
+	{
+		m_entries.clear();
+		m_entryIndices.clear();
+	}
+
+	/*!
+	* \brief Writes the archive to a file
+	* \return true if successful
+	*
+	* \param filePath Path of the archive file, which is overwritten if it exists
+	*/
+	bool ArchiveBuilder::Save(const String& filePath) const
+	{
+		std::size_t entryCount = m_entries.size();
+		if (entryCount >= Archive::InvalidEntryIndex)
+		{
+			NazaraError("Too many entries");
+			return false;
+		}
+
+		// Keep the hash table at most half full, which keeps probe sequences short
+		UInt32 slotCount = 0;
+		if (entryCount > 0)
+		{
+			slotCount = 1;
+			while (slotCount < entryCount * 2)
+				slotCount *= 2;
+		}
+
+		std::vector<UInt32> slots(slotCount, Archive::InvalidEntryIndex);
+		std::vector<UInt64> hashes(entryCount);
+		std::vector<UInt64> offsets(entryCount);
+		std::vector<UInt32> pathOffsets(entryCount);
+
+		UInt64 offset = Archive::HeaderSize;
+		UInt64 pathTableSize = 0;
+		for (std::size_t i = 0; i < entryCount; ++i)
+		{
+			const PendingEntry& entry = m_entries[i];
+
+			hashes[i] = Archive::ComputeEntryHash(entry.path);
+
+			UInt32 mask = slotCount - 1;
+			UInt32 slot = static_cast<UInt32>(hashes[i] & mask);
+			while (slots[slot] != Archive::InvalidEntryIndex)
+				slot = (slot + 1) & mask;
+
+			slots[slot] = static_cast<UInt32>(i);
+
+			offset = Align(offset, Archive::DataAlignment);
+			offsets[i] = offset;
+			offset += entry.data.GetSize();
+
+			pathOffsets[i] = static_cast<UInt32>(pathTableSize);
+			pathTableSize += entry.path.GetSize();
+		}
+
+		UInt64 entryTableOffset = Align(offset, Archive::DataAlignment);
+		UInt64 slotTableOffset = entryTableOffset + entryCount * Archive::EntrySize;
+		UInt64 pathTableOffset = slotTableOffset + slotCount * sizeof(UInt32);
+
+		File file(filePath, OpenMode_WriteOnly | OpenMode_Truncate);
+		if (!file.IsOpen())
+		{
+			NazaraError("Failed to open " + filePath);
+			return false;
+		}
+
+		ByteStream stream(&file);
+		stream.SetDataEndianness(Endianness_LittleEndian);
+
+		stream << Archive::Magic << Archive::Version << static_cast<UInt32>(entryCount) << slotCount << entryTableOffset << slotTableOffset << pathTableOffset << pathTableSize;
+
+		for (std::size_t i = 0; i < entryCount; ++i)
+		{
+			const ByteArray& data = m_entries[i].data;
+			if (!WritePadding(file, offsets[i]) || file.Write(data.GetConstBuffer(), data.GetSize()) != data.GetSize())
+			{
+				NazaraError("Failed to write entry data");
+				return false;
+			}
+		}
+
+		if (!WritePadding(file, entryTableOffset))
+		{
+			NazaraError("Failed to write entry table");
+			return false;
+		}
+
+		for (std::size_t i = 0; i < entryCount; ++i)
+		{
+			const PendingEntry& entry = m_entries[i];
+			stream << hashes[i] << offsets[i] << entry.size << static_cast<UInt64>(entry.data.GetSize()) << pathOffsets[i] << static_cast<UInt32>(entry.path.GetSize()) << static_cast<UInt32>(entry.compression) << UInt32(0);
+		}
+
+		for (UInt32 slot : slots)
+			stream << slot;
+
+		for (const PendingEntry& entry : m_entries)
+		{
+			if (file.Write(entry.path.GetConstBuffer(), entry.path.GetSize()) != entry.path.GetSize())
+			{
+				NazaraError("Failed to write path table");
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
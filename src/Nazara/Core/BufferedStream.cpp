@@ -0,0 +1,341 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/BufferedStream.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/String.hpp>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::BufferedStream
+	* \brief Core class that adds read-ahead and write-behind buffering to another stream
+	*
+	* Small reads and writes are served from memory and reach the underlying stream in big blocks, which saves a system call per operation on files.
+	* Moving the cursor inside the data which has been read ahead does not touch the underlying stream either, and ReadLine never needs to move the cursor back.
+	*
+	* The underlying stream must not be used directly while a BufferedStream is working on it.
+	* Once destroyed, the buffered stream writes its pending data and puts the cursor of the underlying stream where it would have been without buffering.
+	*/
+
+	/*!
+	* \brief Constructs a BufferedStream object working on another stream
+	*
+	* The stream options and open mode are copied from the underlying stream.
+	*
+	* \param stream Stream to work on, it must outlive this object
+	* \param readBufferSize Number of bytes read at once from the underlying stream, must be over zero
+	* \param writeBufferSize Number of bytes which can be kept before being written to the underlying stream, zero disables write buffering
+	*/
+	BufferedStream::BufferedStream(Stream& stream, std::size_t readBufferSize, std::size_t writeBufferSize) :
+	Stream(stream.GetStreamOptions(), stream.GetOpenMode()),
+	m_stream(stream),
+	m_bufferOffset(stream.GetCursorPos()),
+	m_readBufferPos(0),
+	m_readBufferSize(0),
+	m_writeBufferSize(0)
+	{
+		NazaraAssert(readBufferSize > 0, "Read buffer size must be over zero");
+
+		if (IsReadable())
+			m_readBuffer.resize(readBufferSize);
+
+		if (IsWritable())
+			m_writeBuffer.resize(writeBufferSize);
+	}
+
+	/*!
+	* \brief Destructs the object, writing pending data and synchronizing the underlying stream cursor
+	*/
+	BufferedStream::~BufferedStream()
+	{
+		FlushWriteBuffer();
+		DiscardReadBuffer();
+	}
+
+	/*!
+	* \brief Checks whether the stream reached the end of the stream
+	* \return true if cursor is at the end of the stream
+	*/
+	bool BufferedStream::EndOfStream() const
+	{
+		if (m_readBufferPos < m_readBufferSize)
+			return false;
+
+		if (m_writeBufferSize > 0)
+			return GetCursorPos() >= GetSize();
+
+		return m_stream.EndOfStream();
+	}
+
+	/*!
+	* \brief Gets the position of the cursor
+	* \return Position of the cursor, taking buffered data into account
+	*/
+	UInt64 BufferedStream::GetCursorPos() const
+	{
+		return m_bufferOffset + m_readBufferPos + m_writeBufferSize;
+	}
+
+	/*!
+	* \brief Gets the directory of the underlying stream
+	* \return Directory of the underlying stream
+	*/
+	String BufferedStream::GetDirectory() const
+	{
+		return m_stream.GetDirectory();
+	}
+
+	/*!
+	* \brief Gets the path of the underlying stream
+	* \return Path of the underlying stream
+	*/
+	String BufferedStream::GetPath() const
+	{
+		return m_stream.GetPath();
+	}
+
+	/*!
+	* \brief Gets the size of the stream
+	* \return Size of the underlying stream, including data which is not written yet
+	*/
+	UInt64 BufferedStream::GetSize() const
+	{
+		return std::max(m_stream.GetSize(), GetCursorPos());
+	}
+
+	/*!
+	* \brief Reads a line from the stream
+	*
+	* Unlike the generic implementation, lines are searched directly in the read buffer and the cursor is never moved back.
+	*
+	* \param lineSize Maximum number of characters to read, or zero for no limit
+	*
+	* \return Line read from the stream
+	*
+	* \remark With the text stream option, "\r\n" is treated as "\n"
+	* \remark The line separator character is not returned as part of the string
+	*/
+	String BufferedStream::ReadLine(unsigned int lineSize)
+	{
+		NazaraAssert(IsReadable(), "Stream is not readable");
+
+		String line;
+		if (!FlushWriteBuffer())
+			return line;
+
+		std::size_t maxSize = (lineSize > 0) ? lineSize : std::numeric_limits<std::size_t>::max();
+		std::size_t readSize = 0;
+		bool separatorFound = false;
+		while (readSize < maxSize)
+		{
+			if (m_readBufferPos == m_readBufferSize && !FillReadBuffer())
+				break;
+
+			const char* start = reinterpret_cast<const char*>(&m_readBuffer[m_readBufferPos]);
+			std::size_t available = std::min(m_readBufferSize - m_readBufferPos, maxSize - readSize);
+
+			const char* separator = static_cast<const char*>(std::memchr(start, '\n', available));
+			if (separator)
+			{
+				std::size_t length = separator - start;
+				line.Append(start, length);
+
+				m_readBufferPos += length + 1;
+				separatorFound = true;
+				break;
+			}
+
+			line.Append(start, available);
+
+			m_readBufferPos += available;
+			readSize += available;
+		}
+
+		if (separatorFound && m_streamOptions & StreamOption_Text && !line.IsEmpty() && line.GetConstBuffer()[line.GetSize() - 1] == '\r')
+			line.Resize(-1);
+
+		return line;
+	}
+
+	/*!
+	* \brief Sets the position of the cursor
+	* \return true if successful
+	*
+	* \param offset Offset according to the beginning of the stream
+	*
+	* \remark The underlying stream is left untouched if the new position is part of the data which has been read ahead
+	*/
+	bool BufferedStream::SetCursorPos(UInt64 offset)
+	{
+		if (!FlushWriteBuffer())
+			return false;
+
+		if (m_readBufferSize > 0 && offset >= m_bufferOffset && offset <= m_bufferOffset + m_readBufferSize)
+		{
+			m_readBufferPos = static_cast<std::size_t>(offset - m_bufferOffset);
+			return true;
+		}
+
+		m_readBufferPos = 0;
+		m_readBufferSize = 0;
+
+		bool success = m_stream.SetCursorPos(offset);
+		m_bufferOffset = m_stream.GetCursorPos();
+
+		return success;
+	}
+
+	/*!
+	* \brief Drops the data which has been read ahead and moves the underlying stream cursor back to the current position
+	*/
+	void BufferedStream::DiscardReadBuffer()
+	{
+		if (m_readBufferPos < m_readBufferSize)
+		{
+			if (!m_stream.SetCursorPos(m_bufferOffset + m_readBufferPos))
+				NazaraWarning("Failed to reset cursor pos");
+		}
+
+		m_bufferOffset += m_readBufferPos;
+		m_readBufferPos = 0;
+		m_readBufferSize = 0;
+	}
+
+	/*!
+	* \brief Reads the next block of the underlying stream into the read buffer
+	* \return true if at least one byte has been read
+	*
+	* \remark The read buffer must have been fully consumed
+	*/
+	bool BufferedStream::FillReadBuffer()
+	{
+		NazaraAssert(m_readBufferPos == m_readBufferSize, "Read buffer has not been consumed");
+
+		m_bufferOffset += m_readBufferSize;
+		m_readBufferPos = 0;
+		m_readBufferSize = m_stream.Read(m_readBuffer.data(), m_readBuffer.size());
+
+		return m_readBufferSize > 0;
+	}
+
+	/*!
+	* \brief Writes pending data and flushes the underlying stream
+	*/
+	void BufferedStream::FlushStream()
+	{
+		if (FlushWriteBuffer())
+			m_stream.Flush();
+	}
+
+	/*!
+	* \brief Writes pending data to the underlying stream
+	* \return true if successful
+	*/
+	bool BufferedStream::FlushWriteBuffer()
+	{
+		if (m_writeBufferSize == 0)
+			return true;
+
+		std::size_t writtenSize = m_stream.Write(m_writeBuffer.data(), m_writeBufferSize);
+		m_bufferOffset += writtenSize;
+
+		bool success = (writtenSize == m_writeBufferSize);
+		if (!success)
+			NazaraError("Failed to write buffered data (" + String::Number(m_writeBufferSize - writtenSize) + " bytes lost)");
+
+		m_writeBufferSize = 0;
+		return success;
+	}
+
+	/*!
+	* \brief Reads blocks
+	* \return Number of blocks read
+	*
+	* \param buffer Preallocated buffer to contain information read, or nullptr to skip data
+	* \param size Size of the read and thus of the buffer
+	*/
+	std::size_t BufferedStream::ReadBlock(void* buffer, std::size_t size)
+	{
+		if (!FlushWriteBuffer())
+			return 0;
+
+		UInt8* ptr = static_cast<UInt8*>(buffer);
+
+		std::size_t readSize = 0;
+		while (readSize < size)
+		{
+			std::size_t available = m_readBufferSize - m_readBufferPos;
+			if (available == 0)
+			{
+				std::size_t remainingSize = size - readSize;
+				if (remainingSize >= m_readBuffer.size())
+				{
+					// Big reads bypass the buffer
+					m_bufferOffset += m_readBufferSize;
+					m_readBufferPos = 0;
+					m_readBufferSize = 0;
+
+					std::size_t directReadSize = m_stream.Read((ptr) ? ptr + readSize : nullptr, remainingSize);
+					m_bufferOffset += directReadSize;
+					readSize += directReadSize;
+					break;
+				}
+
+				if (!FillReadBuffer())
+					break;
+
+				available = m_readBufferSize;
+			}
+
+			std::size_t copySize = std::min(available, size - readSize);
+			if (ptr)
+				std::memcpy(ptr + readSize, &m_readBuffer[m_readBufferPos], copySize);
+
+			m_readBufferPos += copySize;
+			readSize += copySize;
+		}
+
+		return readSize;
+	}
+
+	/*!
+	* \brief Writes blocks
+	* \return Number of blocks written
+	*
+	* \param buffer Preallocated buffer containing information to write
+	* \param size Size of the writting and thus of the buffer
+	*/
+	std::size_t BufferedStream::WriteBlock(const void* buffer, std::size_t size)
+	{
+		NazaraAssert(buffer, "Invalid buffer");
+
+		DiscardReadBuffer();
+
+		if (m_writeBufferSize + size > m_writeBuffer.size())
+		{
+			if (!FlushWriteBuffer())
+				return 0;
+
+			// Big writes bypass the buffer
+			if (size >= m_writeBuffer.size())
+			{
+				std::size_t writtenSize = m_stream.Write(buffer, size);
+				m_bufferOffset += writtenSize;
+
+				return writtenSize;
+			}
+		}
+
+		std::memcpy(&m_writeBuffer[m_writeBufferSize], buffer, size);
+		m_writeBufferSize += size;
+
+		return size;
+	}
+}
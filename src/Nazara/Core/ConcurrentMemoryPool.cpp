@@ -0,0 +1,355 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ConcurrentMemoryPool.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Math/Algorithm.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+
+#if defined(NAZARA_PLATFORM_WINDOWS)
+	#include <malloc.h>
+#endif
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		constexpr UInt32 InvalidBlock = 0xFFFFFFFF;
+
+		std::atomic<unsigned int> s_nextThreadCacheIndex(0);
+		thread_local unsigned int s_threadCacheIndex = std::numeric_limits<unsigned int>::max();
+
+		void* AllocateAligned(std::size_t size, std::size_t alignment)
+		{
+			#if defined(NAZARA_PLATFORM_WINDOWS)
+			return _aligned_malloc(size, alignment);
+			#else
+			void* ptr;
+			if (posix_memalign(&ptr, alignment, size) != 0)
+				return nullptr;
+
+			return ptr;
+			#endif
+		}
+
+		void FreeAligned(void* ptr)
+		{
+			#if defined(NAZARA_PLATFORM_WINDOWS)
+			_aligned_free(ptr);
+			#else
+			std::free(ptr);
+			#endif
+		}
+
+		UInt64 MakeDepotHead(UInt64 previousHead, UInt32 blockIndex)
+		{
+			// The upper half is a tag incremented on each modification, preventing the ABA problem
+			return (((previousHead >> 32) + 1) << 32) | blockIndex;
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::ConcurrentMemoryPool
+	* \brief Core class that represents a fixed-size memory pool which can be used from multiple threads at once
+	*
+	* Blocks are allocated in slabs aligned on their size, which allows to find the slab of a block in constant time.
+	* Threads first allocate from and free to a cache (shared between a few threads if there are more than ThreadCacheCount of them),
+	* which exchanges batches of blocks with a lock-free shared depot.
+	*
+	* \remark Memory is only given back to the system when the pool is destroyed
+	*/
+
+	/*!
+	* \brief Constructs a ConcurrentMemoryPool object
+	*
+	* \param blockSize Size of blocks that will be allocated
+	* \param blocksPerSlab Number of blocks allocated each time the pool has to grow (may be increased to fill the slab)
+	*/
+	ConcurrentMemoryPool::ConcurrentMemoryPool(std::size_t blockSize, std::size_t blocksPerSlab) :
+	m_depotHead(InvalidBlock),
+	m_depotBlockCount(0),
+	m_highWaterMark(0),
+	m_uncachedLiveBlocks(0),
+	m_slabCount(0)
+	{
+		constexpr std::size_t alignment = alignof(std::max_align_t);
+
+		// Blocks must be able to hold the index of the next free block and stay aligned
+		m_blockSize = std::max(blockSize, sizeof(UInt32));
+		m_blockSize = (m_blockSize + alignment - 1) / alignment * alignment;
+		m_headerSize = (sizeof(SlabHeader) + alignment - 1) / alignment * alignment;
+
+		blocksPerSlab = Clamp<std::size_t>(blocksPerSlab, 1, MaxBlocksPerSlab);
+		m_slabSize = GetNearestPowerOfTwo(m_headerSize + blocksPerSlab * m_blockSize);
+		m_blocksPerSlab = std::min((m_slabSize - m_headerSize) / m_blockSize, MaxBlocksPerSlab);
+
+		m_slabs.reset(new std::atomic<UInt8*>[MaxSlabCount]);
+		m_threadCaches.reset(new ThreadCache[ThreadCacheCount]);
+		for (std::size_t i = 0; i < ThreadCacheCount; ++i)
+		{
+			ThreadCache& cache = m_threadCaches[i];
+			cache.firstFreeBlock = InvalidBlock;
+			cache.freeBlockCount = 0;
+			cache.liveBlocks = 0;
+		}
+	}
+
+	/*!
+	* \brief Destructs the pool and releases all of its memory
+	*
+	* \remark Objects still allocated from the pool are not destroyed
+	*/
+	ConcurrentMemoryPool::~ConcurrentMemoryPool()
+	{
+		UInt32 slabCount = m_slabCount.load(std::memory_order_acquire);
+		for (UInt32 i = 0; i < slabCount; ++i)
+			FreeAligned(m_slabs[i].load(std::memory_order_relaxed));
+	}
+
+	/*!
+	* \brief Allocates a block
+	* \return A pointer to the block, or a null pointer if the pool reached its maximum size
+	*
+	* \remark This method can be called from multiple threads at once
+	*/
+	void* ConcurrentMemoryPool::Allocate()
+	{
+		ThreadCache& cache = GetThreadCache();
+		if (!cache.lock.test_and_set(std::memory_order_acquire))
+		{
+			if (cache.freeBlockCount == 0)
+			{
+				// Refill the cache with a batch of blocks from the depot
+				UInt32 blockIndex;
+				while (cache.freeBlockCount < CacheBatchSize && (blockIndex = PopDepot()) != InvalidBlock)
+				{
+					GetNextBlock(blockIndex).store(cache.firstFreeBlock, std::memory_order_relaxed);
+					cache.firstFreeBlock = blockIndex;
+					cache.freeBlockCount++;
+				}
+			}
+
+			UInt32 blockIndex = cache.firstFreeBlock;
+			if (blockIndex != InvalidBlock)
+			{
+				cache.firstFreeBlock = GetNextBlock(blockIndex).load(std::memory_order_relaxed);
+				cache.freeBlockCount--;
+			}
+			else
+				blockIndex = AllocateBlock();
+
+			if (blockIndex != InvalidBlock)
+				cache.liveBlocks.store(cache.liveBlocks.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+			cache.lock.clear(std::memory_order_release);
+
+			return (blockIndex != InvalidBlock) ? GetBlock(blockIndex) : nullptr;
+		}
+		else
+		{
+			// Another thread is using this cache, don't wait for it
+			UInt32 blockIndex = AllocateBlock();
+			if (blockIndex == InvalidBlock)
+				return nullptr;
+
+			m_uncachedLiveBlocks++;
+
+			return GetBlock(blockIndex);
+		}
+	}
+
+	/*!
+	* \brief Frees a block
+	*
+	* \param ptr Pointer to a block allocated by this pool
+	*
+	* \remark This method can be called from multiple threads at once
+	* \remark Throws a std::runtime_error if pointer does not point to a block of the pool with NAZARA_CORE_SAFE defined
+	* \remark If ptr is null, nothing is done
+	*/
+	void ConcurrentMemoryPool::Free(void* ptr)
+	{
+		if (!ptr)
+			return;
+
+		UInt32 blockIndex = GetBlockIndex(ptr);
+
+		ThreadCache& cache = GetThreadCache();
+		if (!cache.lock.test_and_set(std::memory_order_acquire))
+		{
+			GetNextBlock(blockIndex).store(cache.firstFreeBlock, std::memory_order_relaxed);
+			cache.firstFreeBlock = blockIndex;
+			cache.freeBlockCount++;
+			cache.liveBlocks.store(cache.liveBlocks.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+
+			if (cache.freeBlockCount >= 2 * CacheBatchSize)
+			{
+				// Give a batch back to the depot, so other threads can use it
+				UInt32 firstBlock = cache.firstFreeBlock;
+				UInt32 lastBlock = firstBlock;
+				for (std::size_t i = 1; i < CacheBatchSize; ++i)
+					lastBlock = GetNextBlock(lastBlock).load(std::memory_order_relaxed);
+
+				cache.firstFreeBlock = GetNextBlock(lastBlock).load(std::memory_order_relaxed);
+				cache.freeBlockCount -= CacheBatchSize;
+
+				PushDepot(firstBlock, lastBlock, CacheBatchSize);
+			}
+
+			cache.lock.clear(std::memory_order_release);
+		}
+		else
+		{
+			PushDepot(blockIndex, blockIndex, 1);
+			m_uncachedLiveBlocks--;
+		}
+	}
+
+	/*!
+	* \brief Gets the number of blocks currently allocated
+	* \return Number of live blocks
+	*
+	* \remark The value may be outdated if other threads are using the pool at the same time
+	*/
+	std::size_t ConcurrentMemoryPool::GetLiveCount() const
+	{
+		Int64 liveBlocks = m_uncachedLiveBlocks.load(std::memory_order_relaxed);
+		for (std::size_t i = 0; i < ThreadCacheCount; ++i)
+			liveBlocks += m_threadCaches[i].liveBlocks.load(std::memory_order_relaxed);
+
+		return static_cast<std::size_t>(std::max<Int64>(liveBlocks, 0));
+	}
+
+	UInt32 ConcurrentMemoryPool::AllocateBlock()
+	{
+		UInt32 blockIndex = PopDepot();
+		if (blockIndex == InvalidBlock)
+			blockIndex = AllocateSlab();
+
+		return blockIndex;
+	}
+
+	UInt32 ConcurrentMemoryPool::AllocateSlab()
+	{
+		LockGuard lock(m_slabMutex);
+
+		// Another thread may have grown the pool while we were waiting
+		UInt32 blockIndex = PopDepot();
+		if (blockIndex != InvalidBlock)
+			return blockIndex;
+
+		UInt32 slabIndex = m_slabCount.load(std::memory_order_relaxed);
+		if (slabIndex >= MaxSlabCount)
+		{
+			NazaraError("Pool reached its maximum size");
+			return InvalidBlock;
+		}
+
+		UInt8* slab = static_cast<UInt8*>(AllocateAligned(m_slabSize, m_slabSize));
+		if (!slab)
+		{
+			NazaraError("Failed to allocate slab");
+			return InvalidBlock;
+		}
+
+		SlabHeader* header = reinterpret_cast<SlabHeader*>(slab);
+		header->owner = this;
+		header->slabIndex = slabIndex;
+
+		// Count the new blocks as part of the depot before the slab, so the high-water mark never sees them as used
+		m_depotBlockCount += m_blocksPerSlab - 1;
+
+		m_slabs[slabIndex].store(slab, std::memory_order_release);
+		m_slabCount.store(slabIndex + 1, std::memory_order_release);
+
+		// Keep the first block for us and link the others before giving them to the depot
+		UInt32 firstBlock = slabIndex << 16;
+		UInt32 lastBlock = firstBlock + static_cast<UInt32>(m_blocksPerSlab) - 1;
+		for (UInt32 i = firstBlock + 1; i < lastBlock; ++i)
+			GetNextBlock(i).store(i + 1, std::memory_order_relaxed);
+
+		if (m_blocksPerSlab > 1)
+			PushDepot(firstBlock + 1, lastBlock, 0);
+
+		UpdateHighWaterMark();
+
+		return firstBlock;
+	}
+
+	UInt32 ConcurrentMemoryPool::GetBlockIndex(void* ptr) const
+	{
+		// Slabs are aligned on their size, masking the pointer gives us the slab header
+		UInt8* slab = reinterpret_cast<UInt8*>(reinterpret_cast<std::uintptr_t>(ptr) & ~static_cast<std::uintptr_t>(m_slabSize - 1));
+		const SlabHeader* header = reinterpret_cast<const SlabHeader*>(slab);
+
+		std::size_t offset = static_cast<UInt8*>(ptr) - slab;
+
+		#if NAZARA_CORE_SAFE
+		if (header->owner != this || offset < m_headerSize || (offset - m_headerSize) % m_blockSize != 0)
+			throw std::runtime_error("Invalid pointer (does not point to a block of the pool)");
+		#endif
+
+		return (header->slabIndex << 16) | static_cast<UInt32>((offset - m_headerSize) / m_blockSize);
+	}
+
+	ConcurrentMemoryPool::ThreadCache& ConcurrentMemoryPool::GetThreadCache()
+	{
+		if (s_threadCacheIndex == std::numeric_limits<unsigned int>::max())
+			s_threadCacheIndex = s_nextThreadCacheIndex++;
+
+		return m_threadCaches[s_threadCacheIndex % ThreadCacheCount];
+	}
+
+	UInt32 ConcurrentMemoryPool::PopDepot()
+	{
+		UInt64 head = m_depotHead.load(std::memory_order_acquire);
+		for (;;)
+		{
+			UInt32 blockIndex = static_cast<UInt32>(head);
+			if (blockIndex == InvalidBlock)
+				return InvalidBlock;
+
+			// The block may be popped and modified by another thread before our exchange, in which case the tag will have changed
+			UInt32 nextBlock = GetNextBlock(blockIndex).load(std::memory_order_relaxed);
+			if (m_depotHead.compare_exchange_weak(head, MakeDepotHead(head, nextBlock), std::memory_order_acquire, std::memory_order_acquire))
+			{
+				m_depotBlockCount--;
+				UpdateHighWaterMark();
+
+				return blockIndex;
+			}
+		}
+	}
+
+	void ConcurrentMemoryPool::PushDepot(UInt32 firstBlock, UInt32 lastBlock, std::size_t blockCount)
+	{
+		m_depotBlockCount += blockCount;
+
+		UInt64 head = m_depotHead.load(std::memory_order_relaxed);
+		do
+		{
+			GetNextBlock(lastBlock).store(static_cast<UInt32>(head), std::memory_order_relaxed);
+		}
+		while (!m_depotHead.compare_exchange_weak(head, MakeDepotHead(head, firstBlock), std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	void ConcurrentMemoryPool::UpdateHighWaterMark()
+	{
+		std::size_t blockCount = GetBlockCount();
+		std::size_t depotBlockCount = m_depotBlockCount.load(std::memory_order_relaxed);
+		std::size_t usedBlocks = (blockCount > depotBlockCount) ? blockCount - depotBlockCount : 0;
+
+		std::size_t highWaterMark = m_highWaterMark.load(std::memory_order_relaxed);
+		while (usedBlocks > highWaterMark && !m_highWaterMark.compare_exchange_weak(highWaterMark, usedBlocks, std::memory_order_relaxed))
+			;
+	}
+}
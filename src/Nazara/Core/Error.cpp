@@ -19,10 +19,22 @@
 
 namespace Nz
 {
+	namespace
+	{
+		// Errors may be triggered by tasks running on other threads, each thread has its own error state
+		thread_local UInt32 s_flags = ErrorFlag_None;
+		thread_local String s_lastError;
+		thread_local const char* s_lastErrorFunction = "";
+		thread_local const char* s_lastErrorFile = "";
+		thread_local unsigned int s_lastErrorLine = 0;
+	}
+
 	/*!
 	* \ingroup core
 	* \class Nz::Error
 	* \brief Core class that represents an error
+	*
+	* Flags and last error are specific to each thread.
 	*/
 
 	/*!
@@ -185,10 +197,4 @@ namespace Nz
 			(s_flags & ErrorFlag_ThrowException) != 0 && (s_flags & ErrorFlag_ThrowExceptionDisabled) == 0))
 			throw std::runtime_error(error.ToStdString());
 	}
-
-	UInt32 Error::s_flags = ErrorFlag_None;
-	String Error::s_lastError;
-	const char* Error::s_lastErrorFunction = "";
-	const char* Error::s_lastErrorFile = "";
-	unsigned int Error::s_lastErrorLine = 0;
 }
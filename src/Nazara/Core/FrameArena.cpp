@@ -0,0 +1,85 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/FrameArena.hpp>
+#include <algorithm>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::FrameArena
+	* \brief Core class that represents a linear (bump-pointer) allocator
+	*
+	* Allocations are only a pointer increment and are never freed individually: all memory is reclaimed at once by Reset.
+	* It is meant for transient data rebuilt every frame (render queues, culling results, ...).
+	* Memory blocks are kept across resets so an arena reaches a steady state where it does not allocate anymore.
+	*
+	* \see FrameArenaAllocator
+	*/
+
+	/*!
+	* \brief Constructs a FrameArena object
+	*
+	* \param blockSize Minimum size of the memory blocks allocated by the arena
+	*
+	* \remark No memory is allocated until the first allocation
+	*/
+	FrameArena::FrameArena(std::size_t blockSize) :
+	m_blockSize(blockSize),
+	m_currentBlock(0),
+	m_offset(0),
+	m_usedMemory(0)
+	{
+		NazaraAssert(blockSize > 0, "Block size must be over zero");
+	}
+
+	/*!
+	* \brief Gets the total size of the memory blocks owned by the arena
+	* \return Capacity in bytes
+	*/
+	std::size_t FrameArena::GetCapacity() const
+	{
+		std::size_t capacity = 0;
+		for (const Block& block : m_blocks)
+			capacity += block.size;
+
+		return capacity;
+	}
+
+	/*!
+	* \brief Frees every allocation made from the arena at once
+	*
+	* If the arena had to use more than one block since the last reset, its blocks are merged into a single one big enough to hold all of them.
+	*
+	* \remark Every pointer returned by the arena is invalidated
+	*/
+	void FrameArena::Reset()
+	{
+		if (m_blocks.size() > 1)
+		{
+			std::size_t capacity = GetCapacity();
+
+			m_blocks.clear();
+			m_blocks.push_back(Block{std::make_unique<UInt8[]>(capacity), capacity});
+		}
+
+		m_currentBlock = 0;
+		m_offset = 0;
+		m_usedMemory = 0;
+	}
+
+	void* FrameArena::AllocateFromNextBlock(std::size_t size, std::size_t alignment)
+	{
+		// Blocks are only merged on reset, the remaining space of the current block is lost until then
+		std::size_t blockSize = std::max(m_blockSize, size + alignment - 1);
+		m_blocks.push_back(Block{std::make_unique<UInt8[]>(blockSize), blockSize});
+
+		m_currentBlock = m_blocks.size() - 1;
+		m_offset = 0;
+
+		return Allocate(size, alignment);
+	}
+}
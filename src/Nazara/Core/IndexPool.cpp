@@ -0,0 +1,87 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/IndexPool.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <algorithm>
+#include <functional>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::IndexPool
+	* \brief Core class that hands out unique indices and recycles released ones
+	*
+	* The lowest released index is always reused first, so indices stay as small as possible: they are bounded by the highest number of indices used at once.
+	* This class is thread-safe.
+	*/
+
+	/*!
+	* \brief Constructs an IndexPool object with no index used
+	*/
+	IndexPool::IndexPool() :
+	m_nextIndex(0)
+	{
+	}
+
+	/*!
+	* \brief Acquires an unused index
+	* \return Index, which stays unique until it is released
+	*/
+	UInt32 IndexPool::Acquire()
+	{
+		LockGuard lock(m_mutex);
+
+		if (m_freeIndices.empty())
+			return m_nextIndex++;
+
+		// Free indices are kept as a min-heap
+		std::pop_heap(m_freeIndices.begin(), m_freeIndices.end(), std::greater<UInt32>());
+
+		UInt32 index = m_freeIndices.back();
+		m_freeIndices.pop_back();
+
+		return index;
+	}
+
+	/*!
+	* \brief Gets the number of indices handed out at least once
+	* \return One more than the highest index ever acquired
+	*/
+	UInt32 IndexPool::GetCount() const
+	{
+		LockGuard lock(m_mutex);
+
+		return m_nextIndex;
+	}
+
+	/*!
+	* \brief Gets the number of indices currently acquired
+	* \return Number of acquired indices not released yet
+	*/
+	UInt32 IndexPool::GetUsedCount() const
+	{
+		LockGuard lock(m_mutex);
+
+		return m_nextIndex - static_cast<UInt32>(m_freeIndices.size());
+	}
+
+	/*!
+	* \brief Releases an index, making it available to Acquire
+	*
+	* \param index Index previously returned by Acquire
+	*/
+	void IndexPool::Release(UInt32 index)
+	{
+		LockGuard lock(m_mutex);
+
+		NazaraAssert(index < m_nextIndex, "Index was not acquired from this pool");
+
+		m_freeIndices.push_back(index);
+		std::push_heap(m_freeIndices.begin(), m_freeIndices.end(), std::greater<UInt32>());
+	}
+}
@@ -0,0 +1,277 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/LZCodec.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		constexpr std::size_t MaxHashLog = 14;
+		constexpr std::size_t MinHashLog = 8;
+		constexpr std::size_t LastLiterals = 5;      // The last bytes of a block are always literals
+		constexpr std::size_t MatchSearchLimit = 12; // No match can start in the last bytes of a block
+		constexpr std::size_t MaxOffset = 0xFFFF;
+		constexpr std::size_t MinMatch = 4;
+
+		UInt32 Hash(UInt32 sequence, std::size_t hashLog)
+		{
+			return (sequence * 2654435761U) >> (32 - hashLog);
+		}
+
+		UInt32 Read32(const UInt8* ptr)
+		{
+			UInt32 value;
+			std::memcpy(&value, ptr, sizeof(UInt32));
+
+			return value;
+		}
+
+		bool ReadLength(const UInt8*& input, const UInt8* inputEnd, std::size_t* length)
+		{
+			UInt8 byte;
+			do
+			{
+				if (input >= inputEnd)
+					return false;
+
+				byte = *input++;
+				*length += byte;
+			}
+			while (byte == 255);
+
+			return true;
+		}
+
+		bool WriteLength(UInt8*& output, const UInt8* outputEnd, std::size_t length)
+		{
+			for (; length >= 255; length -= 255)
+			{
+				if (output >= outputEnd)
+					return false;
+
+				*output++ = 255;
+			}
+
+			if (output >= outputEnd)
+				return false;
+
+			*output++ = static_cast<UInt8>(length);
+			return true;
+		}
+
+		bool WriteSequence(UInt8*& output, const UInt8* outputEnd, const UInt8* literals, std::size_t literalCount, std::size_t offset, std::size_t matchLength)
+		{
+			if (output >= outputEnd)
+				return false;
+
+			UInt8* token = output++;
+			*token = static_cast<UInt8>(std::min<std::size_t>(literalCount, 15) << 4);
+			if (literalCount >= 15 && !WriteLength(output, outputEnd, literalCount - 15))
+				return false;
+
+			if (static_cast<std::size_t>(outputEnd - output) < literalCount)
+				return false;
+
+			if (literalCount > 0)
+			{
+				std::memcpy(output, literals, literalCount);
+				output += literalCount;
+			}
+
+			// The last sequence only holds literals
+			if (matchLength == 0)
+				return true;
+
+			if (outputEnd - output < 2)
+				return false;
+
+			*output++ = static_cast<UInt8>(offset & 0xFF);
+			*output++ = static_cast<UInt8>(offset >> 8);
+
+			std::size_t lengthCode = matchLength - MinMatch;
+			*token |= static_cast<UInt8>(std::min<std::size_t>(lengthCode, 15));
+			if (lengthCode >= 15 && !WriteLength(output, outputEnd, lengthCode - 15))
+				return false;
+
+			return true;
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::LZCodec
+	* \brief Core class that compresses and decompresses blocks of data with a fast LZ77 algorithm
+	*
+	* The compressed blocks use the LZ4 block format: sequences of literals followed by a back-reference of at most 64KiB.
+	* Compression favors speed over ratio, decompression is a simple copy loop.
+	*/
+
+	/*!
+	* \brief Compresses a block of data
+	* \return Size of the compressed data, or 0 if the output buffer is too small
+	*
+	* \param input Data to compress
+	* \param inputSize Size of the data to compress
+	* \param output Buffer receiving the compressed data
+	* \param outputSize Size of the output buffer, compression cannot fail if it is at least GetMaxCompressedSize(inputSize)
+	*
+	* \see GetMaxCompressedSize
+	*/
+	std::size_t LZCodec::Compress(const void* input, std::size_t inputSize, void* output, std::size_t outputSize)
+	{
+		NazaraAssert(input || inputSize == 0, "Invalid input");
+		NazaraAssert(output || outputSize == 0, "Invalid output");
+		NazaraAssert(inputSize <= std::numeric_limits<UInt32>::max(), "Input is too big");
+
+		const UInt8* in = static_cast<const UInt8*>(input);
+		UInt8* out = static_cast<UInt8*>(output);
+		const UInt8* outEnd = out + outputSize;
+
+		std::size_t anchor = 0;
+		if (inputSize > MatchSearchLimit)
+		{
+			// Position of the last occurrence of each hashed sequence, small blocks (such as network packets) don't need a big table
+			std::size_t hashLog = MinHashLog;
+			while (hashLog < MaxHashLog && (std::size_t(1) << hashLog) < inputSize)
+				hashLog++;
+
+			std::unique_ptr<UInt32[]> table(new UInt32[std::size_t(1) << hashLog]());
+
+			const std::size_t matchStartLimit = inputSize - MatchSearchLimit;
+			const std::size_t matchEndLimit = inputSize - LastLiterals;
+
+			std::size_t pos = 0;
+			while (pos < matchStartLimit)
+			{
+				UInt32 sequence = Read32(&in[pos]);
+				UInt32& slot = table[Hash(sequence, hashLog)];
+
+				std::size_t ref = slot;
+				slot = static_cast<UInt32>(pos);
+
+				if (ref >= pos || pos - ref > MaxOffset || Read32(&in[ref]) != sequence)
+				{
+					pos++;
+					continue;
+				}
+
+				// Extend the match backward over the pending literals, then forward
+				while (pos > anchor && ref > 0 && in[pos - 1] == in[ref - 1])
+				{
+					pos--;
+					ref--;
+				}
+
+				std::size_t matchLength = MinMatch;
+				while (pos + matchLength < matchEndLimit && in[pos + matchLength] == in[ref + matchLength])
+					matchLength++;
+
+				if (!WriteSequence(out, outEnd, &in[anchor], pos - anchor, pos - ref, matchLength))
+					return 0;
+
+				pos += matchLength;
+				anchor = pos;
+
+				if (pos < matchStartLimit)
+					table[Hash(Read32(&in[pos - 2]), hashLog)] = static_cast<UInt32>(pos - 2);
+			}
+		}
+
+		if (!WriteSequence(out, outEnd, &in[anchor], inputSize - anchor, 0, 0))
+			return 0;
+
+		return out - static_cast<UInt8*>(output);
+	}
+
+	/*!
+	* \brief Decompresses a block of data
+	* \return Size of the decompressed data, or 0 if the data is corrupted or the output buffer is too small
+	*
+	* \param input Compressed data
+	* \param inputSize Size of the compressed data
+	* \param output Buffer receiving the decompressed data
+	* \param outputSize Size of the output buffer
+	*
+	* \remark The compressed data is validated, decompressing untrusted data never reads nor writes out of the buffers
+	*/
+	std::size_t LZCodec::Decompress(const void* input, std::size_t inputSize, void* output, std::size_t outputSize)
+	{
+		NazaraAssert(input || inputSize == 0, "Invalid input");
+		NazaraAssert(output || outputSize == 0, "Invalid output");
+
+		const UInt8* in = static_cast<const UInt8*>(input);
+		const UInt8* inEnd = in + inputSize;
+		UInt8* outStart = static_cast<UInt8*>(output);
+		UInt8* out = outStart;
+		UInt8* outEnd = out + outputSize;
+
+		while (in < inEnd)
+		{
+			UInt8 token = *in++;
+
+			std::size_t literalCount = token >> 4;
+			if (literalCount == 15 && !ReadLength(in, inEnd, &literalCount))
+				return 0;
+
+			if (static_cast<std::size_t>(inEnd - in) < literalCount || static_cast<std::size_t>(outEnd - out) < literalCount)
+				return 0;
+
+			std::memcpy(out, in, literalCount);
+			in += literalCount;
+			out += literalCount;
+
+			if (in == inEnd)
+				break; // Last sequence
+
+			if (inEnd - in < 2)
+				return 0;
+
+			std::size_t offset = in[0] | (in[1] << 8);
+			in += 2;
+
+			if (offset == 0 || offset > static_cast<std::size_t>(out - outStart))
+				return 0;
+
+			std::size_t matchLength = token & 0x0F;
+			if (matchLength == 15 && !ReadLength(in, inEnd, &matchLength))
+				return 0;
+
+			matchLength += MinMatch;
+			if (static_cast<std::size_t>(outEnd - out) < matchLength)
+				return 0;
+
+			const UInt8* match = out - offset;
+			if (offset >= matchLength)
+				std::memcpy(out, match, matchLength);
+			else
+			{
+				// Overlapping match, repeating the last bytes
+				for (std::size_t i = 0; i < matchLength; ++i)
+					out[i] = match[i];
+			}
+
+			out += matchLength;
+		}
+
+		return out - outStart;
+	}
+
+	/*!
+	* \brief Gets the size of the biggest block the compression can produce
+	* \return Size in bytes
+	*
+	* \param inputSize Size of the data to compress
+	*/
+	std::size_t LZCodec::GetMaxCompressedSize(std::size_t inputSize)
+	{
+		return inputSize + inputSize / 255 + 16;
+	}
+}
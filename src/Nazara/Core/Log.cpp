@@ -6,6 +6,13 @@
 #include <Nazara/Core/AbstractLogger.hpp>
 #include <Nazara/Core/FileLogger.hpp>
 #include <Nazara/Core/StdLogger.hpp>
+
+#if NAZARA_CORE_THREADSAFE && NAZARA_THREADSAFETY_LOG
+	#include <Nazara/Core/ThreadSafety.hpp>
+#else
+	#include <Nazara/Core/ThreadSafetyOff.hpp>
+#endif
+
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -60,6 +67,8 @@ namespace Nz
 
 	void Log::SetLogger(AbstractLogger* logger)
 	{
+		NazaraLock(s_mutex)
+
 		if (s_logger != &s_stdLogger)
 			delete s_logger;
 
@@ -78,6 +87,8 @@ namespace Nz
 
 	void Log::Write(const String& string)
 	{
+		NazaraLock(s_mutex)
+
 		if (s_enabled)
 			s_logger->Write(string);
 
@@ -98,6 +109,8 @@ namespace Nz
 
 	void Log::WriteError(ErrorType type, const String& error, unsigned int line, const char* file, const char* function)
 	{
+		NazaraLock(s_mutex)
+
 		if (s_enabled)
 			s_logger->WriteError(type, error, line, file, function);
 
@@ -131,4 +144,8 @@ namespace Nz
 
 	AbstractLogger* Log::s_logger = &s_stdLogger;
 	bool Log::s_enabled = true;
+
+	#if NAZARA_CORE_THREADSAFE && NAZARA_THREADSAFETY_LOG
+	Mutex Log::s_mutex;
+	#endif
 }
@@ -0,0 +1,393 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/MappedFile.hpp>
+#include <Nazara/Core/Archive.hpp>
+#include <Nazara/Core/Directory.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+#if defined(NAZARA_PLATFORM_WINDOWS)
+	#include <Nazara/Core/Win32/MappedFileImpl.hpp>
+#elif defined(NAZARA_PLATFORM_POSIX)
+	#include <Nazara/Core/Posix/MappedFileImpl.hpp>
+#else
+	#error OS not handled
+#endif
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::MappedFile
+	* \brief Core class that represents a read-only file mapped in memory
+	*
+	* The whole content of the file is accessible through GetData without any copy, the pages being loaded by the system on first access.
+	* The file can also be read as any other stream, reads are then simple copies from the mapping.
+	*
+	* Files which are part of a mounted Archive are opened from it, uncompressed entries being directly accessed inside the mapping of the archive.
+	*/
+
+	/*!
+	* \brief Constructs a MappedFile object by default
+	*/
+
+	MappedFile::MappedFile() :
+	Stream(StreamOption_None, OpenMode_NotOpen),
+	m_impl(nullptr),
+	m_data(nullptr),
+	m_cursorPos(0),
+	m_size(0)
+	{
+	}
+
+	/*!
+	* \brief Constructs a MappedFile object with a file path
+	*
+	* \param filePath Path to the file
+	*
+	* \remark The file is not opened by this constructor
+	*/
+
+	MappedFile::MappedFile(const String& filePath) :
+	MappedFile()
+	{
+		SetFile(filePath);
+	}
+
+	/*!
+	* \brief Constructs a MappedFile object by moving another one
+	*
+	* \param file MappedFile to move, it is closed by the move
+	*/
+
+	MappedFile::MappedFile(MappedFile&& file) noexcept :
+	Stream(std::move(file)),
+	m_impl(std::move(file.m_impl)),
+	m_filePath(std::move(file.m_filePath)),
+	m_buffer(std::move(file.m_buffer)),
+	m_data(file.m_data),
+	m_cursorPos(file.m_cursorPos),
+	m_size(file.m_size)
+	{
+		file.m_data = nullptr;
+		file.m_openMode = OpenMode_NotOpen;
+		file.m_size = 0;
+	}
+
+	/*!
+	* \brief Destructs the object and calls Close
+	*
+	* \see Close
+	*/
+
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+	/*!
+	* \brief Unmaps the file
+	*
+	* \remark Every pointer returned by GetData is invalidated by this call
+	*/
+
+	void MappedFile::Close()
+	{
+		if (m_impl)
+		{
+			m_impl->Close();
+			delete m_impl;
+			m_impl = nullptr;
+		}
+
+		m_buffer.reset();
+		m_cursorPos = 0;
+		m_data = nullptr;
+		m_openMode = OpenMode_NotOpen;
+		m_size = 0;
+	}
+
+	/*!
+	* \brief Checks whether the cursor reached the end of the file
+	* \return true if cursor is at the end of the file
+	*/
+
+	bool MappedFile::EndOfStream() const
+	{
+		return m_cursorPos >= GetSize();
+	}
+
+	/*!
+	* \brief Gets the position of the cursor in the file
+	* \return Position of the cursor
+	*/
+
+	UInt64 MappedFile::GetCursorPos() const
+	{
+		return m_cursorPos;
+	}
+
+	/*!
+	* \brief Gets a pointer to the content of the file
+	* \return Pointer to the first byte of the file, or nullptr if the file is not open or empty
+	*
+	* \remark The pointer stays valid until the file is closed
+	*/
+
+	const UInt8* MappedFile::GetData() const
+	{
+		return m_data;
+	}
+
+	/*!
+	* \brief Gets the directory of the file
+	* \return Directory of the file
+	*/
+
+	String MappedFile::GetDirectory() const
+	{
+		return m_filePath.SubStringTo(NAZARA_DIRECTORY_SEPARATOR, -1, true, true);
+	}
+
+	/*!
+	* \brief Gets the name of the file
+	* \return Name of the file
+	*/
+
+	String MappedFile::GetFileName() const
+	{
+		return m_filePath.SubStringFrom(NAZARA_DIRECTORY_SEPARATOR, -1, true);
+	}
+
+	/*!
+	* \brief Gets the path of the file
+	* \return Path of the file
+	*/
+
+	String MappedFile::GetPath() const
+	{
+		return m_filePath;
+	}
+
+	/*!
+	* \brief Gets the size of the file
+	* \return Size of the file, or 0 if the file is not open
+	*/
+
+	UInt64 MappedFile::GetSize() const
+	{
+		return m_size;
+	}
+
+	/*!
+	* \brief Checks whether the file is open
+	* \return true if open
+	*/
+
+	bool MappedFile::IsOpen() const
+	{
+		return m_openMode != OpenMode_NotOpen;
+	}
+
+	/*!
+	* \brief Maps the file in memory
+	* \return true if the file was successfully mapped
+	*
+	* \remark Produces a NazaraError if the file could not be mapped
+	*/
+
+	bool MappedFile::Open()
+	{
+		Close();
+
+		if (m_filePath.IsEmpty())
+			return false;
+
+		const Archive::Entry* entry;
+		if (const Archive* archive = Archive::FindMountedEntry(m_filePath, &entry))
+		{
+			if (entry->compression == ArchiveCompression_None)
+				m_data = archive->GetEntryData(*entry);
+			else
+			{
+				m_buffer.reset(new UInt8[static_cast<std::size_t>(entry->size)]);
+				if (!archive->ReadEntry(*entry, m_buffer.get()))
+				{
+					m_buffer.reset();
+					return false;
+				}
+
+				m_data = m_buffer.get();
+			}
+
+			m_size = entry->size;
+		}
+		else
+		{
+			std::unique_ptr<MappedFileImpl> impl(new MappedFileImpl);
+			if (!impl->Open(m_filePath))
+				return false;
+
+			m_impl = impl.release();
+			m_data = m_impl->GetData();
+			m_size = m_impl->GetSize();
+		}
+
+		m_openMode = OpenMode_ReadOnly;
+
+		return true;
+	}
+
+	/*!
+	* \brief Maps a file in memory
+	* \return true if the file was successfully mapped
+	*
+	* \param filePath Path to the file
+	*
+	* \remark Produces a NazaraError if the file could not be mapped
+	*/
+
+	bool MappedFile::Open(const String& filePath)
+	{
+		Close();
+
+		SetFile(filePath);
+		return Open();
+	}
+
+	/*!
+	* \brief Sets the position of the cursor
+	* \return true if the cursor is inside the file
+	*
+	* \param offset Offset according to the beginning of the file
+	*/
+
+	bool MappedFile::SetCursorPos(UInt64 offset)
+	{
+		NazaraAssert(IsOpen(), "File is not open");
+
+		m_cursorPos = std::min(offset, GetSize());
+		return m_cursorPos == offset;
+	}
+
+	/*!
+	* \brief Sets the file path
+	* \return true if the file was successfully mapped (if it was already open)
+	*
+	* \param filePath Path to the file
+	*
+	* \remark If the file was already mapped, the new file gets mapped in place of it
+	*/
+
+	bool MappedFile::SetFile(const String& filePath)
+	{
+		if (IsOpen())
+		{
+			if (filePath.IsEmpty())
+				return false;
+
+			MappedFile file(filePath);
+			if (!file.Open())
+				return false;
+
+			*this = std::move(file);
+			return true;
+		}
+
+		m_filePath = File::AbsolutePath(filePath);
+		return true;
+	}
+
+	/*!
+	* \brief Moves a MappedFile into this one
+	* \return A reference to this
+	*
+	* \param file MappedFile to move, it is closed by the move
+	*/
+
+	MappedFile& MappedFile::operator=(MappedFile&& file) noexcept
+	{
+		Close();
+
+		Stream::operator=(std::move(file));
+		m_buffer = std::move(file.m_buffer);
+		m_cursorPos = file.m_cursorPos;
+		m_data = file.m_data;
+		m_filePath = std::move(file.m_filePath);
+		m_impl = std::move(file.m_impl);
+		m_size = file.m_size;
+
+		file.m_data = nullptr;
+		file.m_openMode = OpenMode_NotOpen;
+		file.m_size = 0;
+
+		return *this;
+	}
+
+	/*!
+	* \brief Checks whether a file exists, either on the disk or inside a mounted archive
+	* \return true if the file can be opened by a MappedFile
+	*
+	* \param filePath Path of the file
+	*/
+
+	bool MappedFile::Exists(const String& filePath)
+	{
+		return Archive::FindMountedEntry(File::AbsolutePath(filePath)) || File::Exists(filePath);
+	}
+
+	/*!
+	* \brief Does nothing, a MappedFile can't be written to
+	*/
+
+	void MappedFile::FlushStream()
+	{
+		// Nothing to flush, the mapping is read-only
+	}
+
+	/*!
+	* \brief Copies data from the mapping
+	* \return Number of bytes read
+	*
+	* \param buffer Preallocated buffer to contain information read, or nullptr to skip bytes
+	* \param size Size of the read and thus of the buffer
+	*/
+
+	std::size_t MappedFile::ReadBlock(void* buffer, std::size_t size)
+	{
+		NazaraAssert(IsOpen(), "File is not open");
+
+		std::size_t readSize = static_cast<std::size_t>(std::min<UInt64>(size, GetSize() - m_cursorPos));
+		if (buffer && readSize > 0)
+			std::memcpy(buffer, m_data + m_cursorPos, readSize);
+
+		m_cursorPos += readSize;
+		return readSize;
+	}
+
+	/*!
+	* \brief Fails, a MappedFile is read-only
+	* \return 0
+	*
+	* \param buffer Unused
+	* \param size Unused
+	*
+	* \remark Produces a NazaraError
+	*/
+
+	std::size_t MappedFile::WriteBlock(const void* buffer, std::size_t size)
+	{
+		NazaraUnused(buffer);
+		NazaraUnused(size);
+
+		NazaraError("MappedFile is read-only");
+		return 0;
+	}
+}
@@ -0,0 +1,100 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Posix/MappedFileImpl.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/String.hpp>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <limits>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	MappedFileImpl::MappedFileImpl() :
+	m_data(nullptr),
+	m_size(0)
+	{
+	}
+
+	void MappedFileImpl::Close()
+	{
+		if (m_data)
+		{
+			munmap(m_data, static_cast<std::size_t>(m_size));
+			m_data = nullptr;
+		}
+
+		m_size = 0;
+	}
+
+	const UInt8* MappedFileImpl::GetData() const
+	{
+		return m_data;
+	}
+
+	UInt64 MappedFileImpl::GetSize() const
+	{
+		return m_size;
+	}
+
+	bool MappedFileImpl::Open(const String& filePath)
+	{
+		int fileDescriptor = open64(filePath.GetConstBuffer(), O_RDONLY);
+		if (fileDescriptor == -1)
+		{
+			NazaraError("Failed to open \"" + filePath + "\" : " + Error::GetLastSystemError());
+			return false;
+		}
+
+		struct stat64 fileInfo;
+		if (fstat64(fileDescriptor, &fileInfo) == -1)
+		{
+			NazaraError("Failed to get size of \"" + filePath + "\" : " + Error::GetLastSystemError());
+			close(fileDescriptor);
+			return false;
+		}
+
+		// Pipes and other special files report no meaningful size and cannot be mapped
+		if (!S_ISREG(fileInfo.st_mode))
+		{
+			NazaraError("Failed to map \"" + filePath + "\" : not a regular file");
+			close(fileDescriptor);
+			return false;
+		}
+
+		if (static_cast<UInt64>(fileInfo.st_size) > std::numeric_limits<std::size_t>::max())
+		{
+			NazaraError("Failed to map \"" + filePath + "\" : file is too big for the address space");
+			close(fileDescriptor);
+			return false;
+		}
+
+		m_size = static_cast<UInt64>(fileInfo.st_size);
+
+		// mmap refuses empty mappings, an empty file is simply exposed as a null span
+		if (m_size > 0)
+		{
+			void* data = mmap(nullptr, static_cast<std::size_t>(m_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+			if (data == MAP_FAILED)
+			{
+				NazaraError("Failed to map \"" + filePath + "\" : " + Error::GetLastSystemError());
+				close(fileDescriptor);
+				m_size = 0;
+				return false;
+			}
+
+			// Loaders mostly parse files from the beginning to the end
+			madvise(data, static_cast<std::size_t>(m_size), MADV_SEQUENTIAL);
+
+			m_data = static_cast<UInt8*>(data);
+		}
+
+		// The mapping keeps a reference on the file, we don't need the descriptor anymore
+		close(fileDescriptor);
+		return true;
+	}
+}
@@ -5,22 +5,21 @@
 #include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/HardwareInfo.hpp>
-
-#if defined(NAZARA_PLATFORM_WINDOWS)
-	#include <Nazara/Core/Win32/TaskSchedulerImpl.hpp>
-#elif defined(NAZARA_PLATFORM_POSIX)
-	#include <Nazara/Core/Posix/TaskSchedulerImpl.hpp>
-#else
-	#error Lack of implementation: Task Scheduler
-#endif
-
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/TaskSchedulerImpl.hpp>
+#include <vector>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
 {
 	namespace
 	{
-		std::vector<Functor*> s_pendingWorks;
+		std::vector<std::function<void()>> s_mainThreadTasks;
+		std::vector<TaskSchedulerImpl::Task*> s_pendingWorks;
+		Mutex s_mainThreadTasksMutex;
+		TaskScheduler::Counter s_detachedTasksCounter;
+		TaskScheduler::Counter s_pendingWorksCounter;
 		unsigned int s_workerCount = 0;
 	}
 
@@ -29,9 +28,30 @@ namespace Nz
 	* \class Nz::TaskScheduler
 	* \brief Core class that represents a pool of threads
 	*
+	* Each worker owns a lock-free queue in which it pushes the tasks it spawns, idle workers steal tasks from the others.
+	* Tasks are stored in pooled objects, small functions (captures included) do not require any allocation.
+	*
 	* \remark Initialized should be called first
 	*/
 
+	/*!
+	* \brief Adds a task to be executed by the main thread
+	*
+	* This is how tasks hand their results back to code which is not thread-safe, the task is executed on the next call to RunMainThreadTasks.
+	* This function can be called from any thread.
+	*
+	* \param function Task that the main thread will execute
+	*
+	* \see RunMainThreadTasks
+	*/
+
+	void TaskScheduler::AddMainThreadTask(std::function<void()> function)
+	{
+		LockGuard lock(s_mainThreadTasksMutex);
+
+		s_mainThreadTasks.emplace_back(std::move(function));
+	}
+
 	/*!
 	* \brief Gets the number of threads
 	* \return Number of threads, if none, the number of simulatenous threads on the processor is returned
@@ -52,27 +72,68 @@ namespace Nz
 		return TaskSchedulerImpl::Initialize(GetWorkerCount());
 	}
 
+	/*!
+	* \brief Checks whether the calling thread is one of the workers
+	* \return true if called from a task executed by a worker
+	*/
+
+	bool TaskScheduler::IsWorkerThread()
+	{
+		return TaskSchedulerImpl::IsWorkerThread();
+	}
+
 	/*!
 	* \brief Runs the pending works
 	*
-	* \remark Produce a NazaraError if the class is not initialized
+	* \remark Produce a NazaraError if the class cannot be initialized, pending works are then executed on the calling thread before returning
 	*/
 
 	void TaskScheduler::Run()
 	{
 		if (!Initialize())
 		{
-			NazaraError("Failed to initialize Task Scheduler");
+			NazaraError("Failed to initialize Task Scheduler, executing pending tasks on the calling thread");
+
+			for (Task* task : s_pendingWorks)
+			{
+				task->execute(task, true);
+				TaskSchedulerImpl::FreeTask(task);
+			}
+			s_pendingWorks.clear();
 			return;
 		}
 
 		if (!s_pendingWorks.empty())
 		{
+			for (Task* task : s_pendingWorks)
+				task->counter = &s_pendingWorksCounter;
+
+			s_pendingWorksCounter.m_pendingTasks += static_cast<unsigned int>(s_pendingWorks.size());
+
 			TaskSchedulerImpl::Run(&s_pendingWorks[0], s_pendingWorks.size());
 			s_pendingWorks.clear();
 		}
 	}
 
+	/*!
+	* \brief Executes the tasks added with AddMainThreadTask
+	*
+	* This should be called regularly by the main thread (Ndk::Application does it every frame).
+	* Tasks added while running are executed on the next call.
+	*/
+
+	void TaskScheduler::RunMainThreadTasks()
+	{
+		std::vector<std::function<void()>> tasks;
+		{
+			LockGuard lock(s_mainThreadTasksMutex);
+			tasks.swap(s_mainThreadTasks);
+		}
+
+		for (auto& task : tasks)
+			task();
+	}
+
 	/*!
 	* \brief Sets the number of workers
 	*
@@ -96,48 +157,124 @@ namespace Nz
 
 	/*!
 	* \brief Uninitializes the TaskScheduler class
+	*
+	* Every started task is executed before the workers are stopped, tasks which were never run are discarded
 	*/
 
 	void TaskScheduler::Uninitialize()
 	{
+		for (Task* task : s_pendingWorks)
+		{
+			task->execute(task, false);
+			TaskSchedulerImpl::FreeTask(task);
+		}
+		s_pendingWorks.clear();
+
 		if (TaskSchedulerImpl::IsInitialized())
+		{
+			TaskSchedulerImpl::Wait(s_detachedTasksCounter);
 			TaskSchedulerImpl::Uninitialize();
+		}
+
+		LockGuard lock(s_mainThreadTasksMutex);
+		s_mainThreadTasks.clear();
 	}
 
 	/*!
-	* \brief Waits for tasks to be done
+	* \brief Waits for every task tracked by a counter to be done
+	*
+	* The calling thread executes pending tasks while it waits, waiting from a task is therefore allowed.
+	*
+	* \param counter Counter to wait on
 	*
 	* \remark Produce a NazaraError if the class is not initialized
 	*/
 
-	void TaskScheduler::WaitForTasks()
+	void TaskScheduler::Wait(const Counter& counter)
 	{
+		if (counter.IsDone())
+			return; //< Also the case of tasks executed inline because the scheduler could not be initialized
+
 		if (!Initialize())
 		{
 			NazaraError("Failed to initialize Task Scheduler");
 			return;
 		}
 
-		TaskSchedulerImpl::WaitForTasks();
+		TaskSchedulerImpl::Wait(counter);
 	}
 
 	/*!
-	* \brief Adds a task on the pending list
+	* \brief Waits for tasks to be done
 	*
-	* \param taskFunctor Functor represeting a task to be done
+	* Only the tasks added with AddTask and started by Run are waited for, spawned tasks must be waited for with their counter.
 	*
 	* \remark Produce a NazaraError if the class is not initialized
-	* \remark A task containing a call on this class is undefined behaviour
 	*/
 
-	void TaskScheduler::AddTaskFunctor(Functor* taskFunctor)
+	void TaskScheduler::WaitForTasks()
+	{
+		Wait(s_pendingWorksCounter);
+	}
+
+	/*!
+	* \brief Adds a task on the pending list
+	*
+	* \param task Task to be done once Run is called
+	*/
+
+	void TaskScheduler::AddPendingTask(Task* task)
+	{
+		s_pendingWorks.push_back(task);
+	}
+
+	/*!
+	* \brief Gets a task object from the pool
+	* \return Task object, which has to be filled
+	*/
+
+	TaskScheduler::Task* TaskScheduler::AllocateTask()
+	{
+		return TaskSchedulerImpl::AllocateTask();
+	}
+
+	/*!
+	* \brief Starts a task which is not tracked by any user counter
+	*
+	* \param task Task to start
+	*
+	* \remark Produce a NazaraError if the class cannot be initialized, the task is then executed on the calling thread before returning
+	*/
+
+	void TaskScheduler::SubmitDetachedTask(Task* task)
+	{
+		SubmitTask(task, s_detachedTasksCounter);
+	}
+
+	/*!
+	* \brief Starts a task tracked by a counter
+	*
+	* \param task Task to start
+	* \param counter Counter tracking the task
+	*
+	* \remark Produce a NazaraError if the class cannot be initialized, the task is then executed on the calling thread before returning
+	*/
+
+	void TaskScheduler::SubmitTask(Task* task, Counter& counter)
 	{
 		if (!Initialize())
 		{
-			NazaraError("Failed to initialize Task Scheduler");
+			// Running the task right away keeps the work (and whoever waits on its results) from being lost
+			NazaraError("Failed to initialize Task Scheduler, executing task on the calling thread");
+
+			task->execute(task, true);
+			TaskSchedulerImpl::FreeTask(task);
 			return;
 		}
 
-		s_pendingWorks.push_back(taskFunctor);
+		task->counter = &counter;
+		counter.m_pendingTasks++;
+
+		TaskSchedulerImpl::Submit(task);
 	}
 }
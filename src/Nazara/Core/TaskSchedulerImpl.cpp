@@ -0,0 +1,510 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/TaskSchedulerImpl.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <algorithm>
+#include <thread>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		// How many times an idle thread looks for work before going to sleep
+		constexpr unsigned int IdleSpinCount = 64;
+
+		// How many free tasks a worker keeps for itself before giving them back to the shared pool
+		constexpr unsigned int MaxCachedTaskCount = 256;
+
+		// How many injected tasks a worker can move to its own queue at once (so other workers can steal them)
+		constexpr std::size_t MaxInjectedBatchSize = 32;
+	}
+
+	/*!
+	* \brief Gets a task from the pool, allocating a new one if none is available
+	* \return Pointer to an uninitialized task
+	*/
+	TaskSchedulerImpl::Task* TaskSchedulerImpl::AllocateTask()
+	{
+		Worker* worker = s_currentWorker;
+		if (worker && !worker->freeTasks)
+		{
+			// Refill our cache from the shared pool
+			LockGuard lock(s_taskPoolMutex);
+			while (s_freeTasks && worker->freeTaskCount < MaxCachedTaskCount / 2)
+			{
+				Task* task = s_freeTasks;
+				s_freeTasks = task->next;
+
+				task->next = worker->freeTasks;
+				worker->freeTasks = task;
+				worker->freeTaskCount++;
+			}
+		}
+
+		if (worker && worker->freeTasks)
+		{
+			Task* task = worker->freeTasks;
+			worker->freeTasks = task->next;
+			worker->freeTaskCount--;
+
+			return task;
+		}
+
+		if (!worker)
+		{
+			LockGuard lock(s_taskPoolMutex);
+			if (s_freeTasks)
+			{
+				Task* task = s_freeTasks;
+				s_freeTasks = task->next;
+
+				return task;
+			}
+		}
+
+		return new Task;
+	}
+
+	/*!
+	* \brief Gives back a task to the pool
+	*
+	* \param task Task to free, its function must have been destroyed
+	*/
+	void TaskSchedulerImpl::FreeTask(Task* task)
+	{
+		Worker* worker = s_currentWorker;
+		if (worker)
+		{
+			task->next = worker->freeTasks;
+			worker->freeTasks = task;
+
+			if (++worker->freeTaskCount < MaxCachedTaskCount)
+				return;
+
+			// Our cache is full, give half of it back to the shared pool
+			LockGuard lock(s_taskPoolMutex);
+			while (worker->freeTaskCount > MaxCachedTaskCount / 2)
+			{
+				Task* freeTask = worker->freeTasks;
+				worker->freeTasks = freeTask->next;
+				worker->freeTaskCount--;
+
+				freeTask->next = s_freeTasks;
+				s_freeTasks = freeTask;
+			}
+		}
+		else
+		{
+			LockGuard lock(s_taskPoolMutex);
+			task->next = s_freeTasks;
+			s_freeTasks = task;
+		}
+	}
+
+	bool TaskSchedulerImpl::Initialize(unsigned int workerCount)
+	{
+		if (IsInitialized())
+			return true; // Already initialized
+
+		#if NAZARA_CORE_SAFE
+		if (workerCount == 0)
+		{
+			NazaraError("Invalid worker count ! (0)");
+			return false;
+		}
+		#endif
+
+		s_shouldFinish = false;
+		s_workerCount = workerCount;
+		s_workers.reset(new Worker[workerCount]);
+
+		for (unsigned int i = 0; i < workerCount; ++i)
+		{
+			Worker& worker = s_workers[i];
+			worker.index = i;
+			worker.randomState = 2654435761U * (i + 1);
+		}
+
+		// Threads are only launched once every worker is ready, as they may try to steal from each other right away
+		for (unsigned int i = 0; i < workerCount; ++i)
+			s_workers[i].thread = Thread(WorkerProc, &s_workers[i]);
+
+		return true;
+	}
+
+	bool TaskSchedulerImpl::IsInitialized()
+	{
+		return s_workerCount > 0;
+	}
+
+	bool TaskSchedulerImpl::IsWorkerThread()
+	{
+		return s_currentWorker != nullptr;
+	}
+
+	/*!
+	* \brief Starts a batch of tasks
+	*
+	* \param tasks Pointer to the tasks to start
+	* \param count Number of tasks
+	*
+	* \remark Counters of the tasks must have already been incremented
+	*/
+	void TaskSchedulerImpl::Run(Task** tasks, std::size_t count)
+	{
+		PushTasks(tasks, count);
+		WakeThreads(true);
+	}
+
+	/*!
+	* \brief Starts a single task
+	*
+	* \param task Task to start
+	*
+	* \remark Counter of the task must have already been incremented
+	*/
+	void TaskSchedulerImpl::Submit(Task* task)
+	{
+		PushTasks(&task, 1);
+		WakeThreads(false);
+	}
+
+	void TaskSchedulerImpl::Uninitialize()
+	{
+		#ifdef NAZARA_CORE_SAFE
+		if (s_workerCount == 0)
+		{
+			NazaraError("Task scheduler is not initialized");
+			return;
+		}
+		#endif
+
+		// Workers will finish every queued task before leaving
+		s_shouldFinish = true;
+		WakeThreads(true);
+
+		for (unsigned int i = 0; i < s_workerCount; ++i)
+			s_workers[i].thread.Join();
+
+		// And release the task pool
+		auto FreeTaskList = [](Task* task)
+		{
+			while (task)
+			{
+				Task* next = task->next;
+				delete task;
+
+				task = next;
+			}
+		};
+
+		for (unsigned int i = 0; i < s_workerCount; ++i)
+			FreeTaskList(s_workers[i].freeTasks);
+
+		FreeTaskList(s_freeTasks);
+		s_freeTasks = nullptr;
+
+		s_workers.reset();
+		s_workerCount = 0;
+	}
+
+	/*!
+	* \brief Waits until every task tracked by a counter is done
+	*
+	* The calling thread executes pending tasks while it waits, it is therefore safe to wait from a task.
+	*
+	* \param counter Counter to wait on
+	*/
+	void TaskSchedulerImpl::Wait(const Counter& counter)
+	{
+		Worker* worker = s_currentWorker;
+
+		unsigned int failedAttempts = 0;
+		while (!counter.IsDone())
+		{
+			if (Task* task = FindTask(worker))
+			{
+				ExecuteTask(task);
+				failedAttempts = 0;
+			}
+			else if (++failedAttempts < IdleSpinCount)
+				std::this_thread::yield();
+			else
+			{
+				LockGuard lock(s_wakeMutex);
+				s_sleepingThreadCount++;
+
+				while (!counter.IsDone() && !HasPendingTasks())
+					s_wakeCondition.Wait(&s_wakeMutex);
+
+				s_sleepingThreadCount--;
+				failedAttempts = 0;
+			}
+		}
+	}
+
+	void TaskSchedulerImpl::ExecuteTask(Task* task)
+	{
+		Counter* counter = task->counter;
+
+		task->execute(task, true);
+		FreeTask(task);
+
+		if (counter->m_pendingTasks.fetch_sub(1) == 1)
+			WakeThreads(true); // Someone may be waiting on this counter
+	}
+
+	TaskSchedulerImpl::Task* TaskSchedulerImpl::FindTask(Worker* worker)
+	{
+		// Our own queue first (most recent tasks, which are most likely hot in cache)
+		if (worker)
+		{
+			if (Task* task = worker->queue.Pop())
+				return task;
+		}
+
+		// Tasks coming from other threads
+		if (Task* task = TakeInjectedTasks(worker))
+			return task;
+
+		// And finally try to steal the oldest tasks of other workers
+		return TrySteal(worker);
+	}
+
+	bool TaskSchedulerImpl::HasPendingTasks()
+	{
+		// Pairs with the fence of WakeThreads
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		if (s_injectedTaskCount.load(std::memory_order_relaxed) > 0)
+			return true;
+
+		for (unsigned int i = 0; i < s_workerCount; ++i)
+		{
+			if (!s_workers[i].queue.IsEmpty())
+				return true;
+		}
+
+		return false;
+	}
+
+	void TaskSchedulerImpl::PushTasks(Task** tasks, std::size_t count)
+	{
+		Worker* worker = s_currentWorker;
+		if (worker)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				// Our queue is full, better run the task now than wait for it to make some room
+				if (!worker->queue.Push(tasks[i]))
+					ExecuteTask(tasks[i]);
+			}
+		}
+		else
+		{
+			LockGuard lock(s_injectionMutex);
+			s_injectedTasks.insert(s_injectedTasks.end(), tasks, tasks + count);
+			s_injectedTaskCount.store(s_injectedTasks.size(), std::memory_order_relaxed);
+		}
+	}
+
+	TaskSchedulerImpl::Task* TaskSchedulerImpl::TakeInjectedTasks(Worker* worker)
+	{
+		if (s_injectedTaskCount.load(std::memory_order_relaxed) == 0)
+			return nullptr;
+
+		LockGuard lock(s_injectionMutex);
+		if (s_injectedTasks.empty())
+			return nullptr;
+
+		Task* task = s_injectedTasks.front();
+		s_injectedTasks.pop_front();
+
+		// Move a fair share of the remaining tasks to our queue, where idle workers can steal them without locking
+		if (worker)
+		{
+			std::size_t batchSize = std::min(s_injectedTasks.size() / s_workerCount, MaxInjectedBatchSize);
+			for (std::size_t i = 0; i < batchSize; ++i)
+			{
+				if (!worker->queue.Push(s_injectedTasks.front()))
+					break;
+
+				s_injectedTasks.pop_front();
+			}
+		}
+
+		s_injectedTaskCount.store(s_injectedTasks.size(), std::memory_order_relaxed);
+
+		return task;
+	}
+
+	TaskSchedulerImpl::Task* TaskSchedulerImpl::TrySteal(Worker* worker)
+	{
+		unsigned int firstVictim = 0;
+		if (worker)
+		{
+			// Xorshift, to avoid every thief targeting the same victim
+			UInt32 state = worker->randomState;
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			worker->randomState = state;
+
+			firstVictim = state % s_workerCount;
+		}
+
+		for (unsigned int i = 0; i < s_workerCount; ++i)
+		{
+			Worker& victim = s_workers[(firstVictim + i) % s_workerCount];
+			if (&victim == worker)
+				continue;
+
+			if (Task* task = victim.queue.Steal())
+				return task;
+		}
+
+		return nullptr;
+	}
+
+	void TaskSchedulerImpl::WakeThreads(bool all)
+	{
+		// Pairs with the fence of HasPendingTasks, either we see the sleeping thread or it sees our tasks
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		if (s_sleepingThreadCount.load(std::memory_order_relaxed) == 0)
+			return;
+
+		LockGuard lock(s_wakeMutex);
+		if (all)
+			s_wakeCondition.SignalAll();
+		else
+			s_wakeCondition.Signal();
+	}
+
+	void TaskSchedulerImpl::WorkerProc(Worker* worker)
+	{
+		s_currentWorker = worker;
+
+		unsigned int failedAttempts = 0;
+		for (;;)
+		{
+			if (Task* task = FindTask(worker))
+			{
+				ExecuteTask(task);
+				failedAttempts = 0;
+			}
+			else if (s_shouldFinish)
+				break;
+			else if (++failedAttempts < IdleSpinCount)
+				std::this_thread::yield();
+			else
+			{
+				LockGuard lock(s_wakeMutex);
+				s_sleepingThreadCount++;
+
+				while (!s_shouldFinish && !HasPendingTasks())
+					s_wakeCondition.Wait(&s_wakeMutex);
+
+				s_sleepingThreadCount--;
+				failedAttempts = 0;
+			}
+		}
+
+		s_currentWorker = nullptr;
+	}
+
+	/*!
+	* \class Nz::TaskSchedulerImpl::TaskQueue
+	* \brief Lock-free work-stealing deque (Chase-Lev)
+	*
+	* Only the owning worker pushes and pops (at the bottom, LIFO), other threads steal at the top (FIFO).
+	*/
+
+	TaskSchedulerImpl::TaskQueue::TaskQueue() :
+	m_top(0),
+	m_bottom(0),
+	m_tasks(new std::atomic<Task*>[Capacity])
+	{
+	}
+
+	bool TaskSchedulerImpl::TaskQueue::IsEmpty() const
+	{
+		return m_bottom.load(std::memory_order_relaxed) <= m_top.load(std::memory_order_relaxed);
+	}
+
+	TaskSchedulerImpl::Task* TaskSchedulerImpl::TaskQueue::Pop()
+	{
+		Int64 bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+		m_bottom.store(bottom, std::memory_order_relaxed);
+
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		Int64 top = m_top.load(std::memory_order_relaxed);
+		if (top > bottom)
+		{
+			// Empty queue
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		Task* task = m_tasks[bottom & (Capacity - 1)].load(std::memory_order_relaxed);
+		if (top == bottom)
+		{
+			// Last task, we are racing against thieves
+			if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				task = nullptr;
+
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+
+		return task;
+	}
+
+	bool TaskSchedulerImpl::TaskQueue::Push(Task* task)
+	{
+		Int64 bottom = m_bottom.load(std::memory_order_relaxed);
+		Int64 top = m_top.load(std::memory_order_acquire);
+		if (bottom - top >= Capacity)
+			return false;
+
+		m_tasks[bottom & (Capacity - 1)].store(task, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+		return true;
+	}
+
+	TaskSchedulerImpl::Task* TaskSchedulerImpl::TaskQueue::Steal()
+	{
+		Int64 top = m_top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		Int64 bottom = m_bottom.load(std::memory_order_acquire);
+
+		if (top >= bottom)
+			return nullptr;
+
+		Task* task = m_tasks[top & (Capacity - 1)].load(std::memory_order_relaxed);
+		if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			return nullptr; // Another thread got it first
+
+		return task;
+	}
+
+	ConditionVariable TaskSchedulerImpl::s_wakeCondition;
+	Mutex TaskSchedulerImpl::s_injectionMutex;
+	Mutex TaskSchedulerImpl::s_taskPoolMutex;
+	Mutex TaskSchedulerImpl::s_wakeMutex;
+	std::atomic<bool> TaskSchedulerImpl::s_shouldFinish;
+	std::atomic<std::size_t> TaskSchedulerImpl::s_injectedTaskCount(0);
+	std::atomic<unsigned int> TaskSchedulerImpl::s_sleepingThreadCount(0);
+	std::deque<TaskSchedulerImpl::Task*> TaskSchedulerImpl::s_injectedTasks;
+	std::unique_ptr<TaskSchedulerImpl::Worker[]> TaskSchedulerImpl::s_workers;
+	TaskSchedulerImpl::Task* TaskSchedulerImpl::s_freeTasks = nullptr;
+	unsigned int TaskSchedulerImpl::s_workerCount = 0;
+	thread_local TaskSchedulerImpl::Worker* TaskSchedulerImpl::s_currentWorker = nullptr;
+}
@@ -0,0 +1,103 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_TASKSCHEDULERIMPL_HPP
+#define NAZARA_TASKSCHEDULERIMPL_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ConditionVariable.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <atomic>
+#include <deque>
+#include <memory>
+
+namespace Nz
+{
+	class TaskSchedulerImpl
+	{
+		public:
+			using Counter = TaskScheduler::Counter;
+			using Task = TaskScheduler::Task;
+
+			TaskSchedulerImpl() = delete;
+			~TaskSchedulerImpl() = delete;
+
+			static Task* AllocateTask();
+			static void FreeTask(Task* task);
+			static bool Initialize(unsigned int workerCount);
+			static bool IsInitialized();
+			static bool IsWorkerThread();
+			static void Run(Task** tasks, std::size_t count);
+			static void Submit(Task* task);
+			static void Uninitialize();
+			static void Wait(const Counter& counter);
+
+		private:
+			class TaskQueue
+			{
+				public:
+					TaskQueue();
+					TaskQueue(const TaskQueue&) = delete;
+					TaskQueue(TaskQueue&&) = delete;
+					~TaskQueue() = default;
+
+					bool IsEmpty() const;
+
+					Task* Pop();
+					bool Push(Task* task);
+
+					Task* Steal();
+
+					TaskQueue& operator=(const TaskQueue&) = delete;
+					TaskQueue& operator=(TaskQueue&&) = delete;
+
+					static constexpr Int64 Capacity = 4096;
+
+				private:
+					// Thieves write the top while the owner writes the bottom, keep them on separate cache lines
+					std::atomic<Int64> m_top;
+					UInt8 m_padding[64 - sizeof(std::atomic<Int64>)];
+					std::atomic<Int64> m_bottom;
+					std::unique_ptr<std::atomic<Task*>[]> m_tasks;
+			};
+
+			struct Worker
+			{
+				TaskQueue queue;
+				Thread thread;
+				Task* freeTasks = nullptr;
+				UInt32 randomState;
+				unsigned int freeTaskCount = 0;
+				unsigned int index;
+			};
+
+			static void ExecuteTask(Task* task);
+			static Task* FindTask(Worker* worker);
+			static bool HasPendingTasks();
+			static void PushTasks(Task** tasks, std::size_t count);
+			static Task* TakeInjectedTasks(Worker* worker);
+			static Task* TrySteal(Worker* worker);
+			static void WakeThreads(bool all);
+			static void WorkerProc(Worker* worker);
+
+			static ConditionVariable s_wakeCondition;
+			static Mutex s_injectionMutex;
+			static Mutex s_taskPoolMutex;
+			static Mutex s_wakeMutex;
+			static std::atomic<bool> s_shouldFinish;
+			static std::atomic<std::size_t> s_injectedTaskCount;
+			static std::atomic<unsigned int> s_sleepingThreadCount;
+			static std::deque<Task*> s_injectedTasks;
+			static std::unique_ptr<Worker[]> s_workers;
+			static Task* s_freeTasks;
+			static unsigned int s_workerCount;
+			static thread_local Worker* s_currentWorker;
+	};
+}
+
+#endif // NAZARA_TASKSCHEDULERIMPL_HPP
@@ -0,0 +1,85 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Win32/MappedFileImpl.hpp>
+#include <Nazara/Core/CallOnExit.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/String.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	MappedFileImpl::MappedFileImpl() :
+	m_data(nullptr),
+	m_size(0)
+	{
+	}
+
+	void MappedFileImpl::Close()
+	{
+		if (m_data)
+		{
+			UnmapViewOfFile(m_data);
+			m_data = nullptr;
+		}
+
+		m_size = 0;
+	}
+
+	const UInt8* MappedFileImpl::GetData() const
+	{
+		return m_data;
+	}
+
+	UInt64 MappedFileImpl::GetSize() const
+	{
+		return m_size;
+	}
+
+	bool MappedFileImpl::Open(const String& filePath)
+	{
+		HANDLE fileHandle = CreateFileW(filePath.GetWideString().data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			NazaraError("Failed to open \"" + filePath + "\" : " + Error::GetLastSystemError());
+			return false;
+		}
+
+		// The view keeps a reference on the mapping and the file, we don't need the handles anymore
+		CallOnExit closeFile([fileHandle]() { CloseHandle(fileHandle); });
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(fileHandle, &fileSize))
+		{
+			NazaraError("Failed to get size of \"" + filePath + "\" : " + Error::GetLastSystemError());
+			return false;
+		}
+
+		m_size = static_cast<UInt64>(fileSize.QuadPart);
+
+		// CreateFileMapping refuses empty files, an empty file is simply exposed as a null span
+		if (m_size == 0)
+			return true;
+
+		HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mappingHandle)
+		{
+			NazaraError("Failed to create mapping of \"" + filePath + "\" : " + Error::GetLastSystemError());
+			m_size = 0;
+			return false;
+		}
+
+		CallOnExit closeMapping([mappingHandle]() { CloseHandle(mappingHandle); });
+
+		m_data = static_cast<const UInt8*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+		if (!m_data)
+		{
+			NazaraError("Failed to map \"" + filePath + "\" : " + Error::GetLastSystemError());
+			m_size = 0;
+			return false;
+		}
+
+		return true;
+	}
+}
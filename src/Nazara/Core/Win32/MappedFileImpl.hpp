@@ -0,0 +1,41 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_MAPPEDFILEIMPL_HPP
+#define NAZARA_MAPPEDFILEIMPL_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <windows.h>
+
+namespace Nz
+{
+	class String;
+
+	class MappedFileImpl
+	{
+		public:
+			MappedFileImpl();
+			MappedFileImpl(const MappedFileImpl&) = delete;
+			MappedFileImpl(MappedFileImpl&&) = delete; ///TODO
+			~MappedFileImpl() = default;
+
+			void Close();
+
+			const UInt8* GetData() const;
+			UInt64 GetSize() const;
+
+			bool Open(const String& filePath);
+
+			MappedFileImpl& operator=(const MappedFileImpl&) = delete;
+			MappedFileImpl& operator=(MappedFileImpl&&) = delete; ///TODO
+
+		private:
+			const UInt8* m_data;
+			UInt64 m_size;
+	};
+}
+
+#endif // NAZARA_MAPPEDFILEIMPL_HPP
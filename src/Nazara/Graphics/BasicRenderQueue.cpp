@@ -630,6 +630,7 @@ namespace Nz
 			depthSortedModels.Insert({
 				renderOrder,
 				meshData,
+				meshAABB,
 				material,
 				transformMatrix,
 				scissorRect,
@@ -641,6 +642,7 @@ namespace Nz
 			models.Insert({
 				renderOrder,
 				meshData,
+				meshAABB,
 				material,
 				transformMatrix,
 				scissorRect,
@@ -690,6 +692,62 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Adds the content of this queue to another one
+	*
+	* This allows a queue to be filled independently (for example on another thread) and merged into the queue of a render technique before drawing.
+	* Elements are added in their sorted order, with the same parameters they were added with.
+	*
+	* \param renderQueue Queue to add the elements to, must be different from this one
+	*
+	* \remark Only sorted elements are part of the queue, so it must be sorted before being added (see Sort)
+	* \remark Produces a NazaraAssert if renderQueue is invalid
+	*/
+	void BasicRenderQueue::AddToRenderQueue(AbstractRenderQueue* renderQueue) const
+	{
+		NazaraAssert(renderQueue, "Invalid render queue");
+		NazaraAssert(renderQueue != this, "Cannot add a render queue to itself");
+
+		for (const DirectionalLight& light : directionalLights)
+			renderQueue->AddDirectionalLight(light);
+
+		for (const PointLight& light : pointLights)
+			renderQueue->AddPointLight(light);
+
+		for (const SpotLight& light : spotLights)
+			renderQueue->AddSpotLight(light);
+
+		auto AddBillboardData = [renderQueue](int layerIndex, const Material* material, std::size_t billboardCount, const Recti& scissorRect, const BillboardData* data)
+		{
+			renderQueue->AddBillboards(layerIndex, material, billboardCount, scissorRect,
+			                           SparsePtr<const Vector3f>(&data->center, sizeof(BillboardData)),
+			                           SparsePtr<const Vector2f>(&data->size, sizeof(BillboardData)),
+			                           SparsePtr<const Vector2f>(&data->sinCos, sizeof(BillboardData)),
+			                           SparsePtr<const Color>(&data->color, sizeof(BillboardData)));
+		};
+
+		for (const BillboardChain& billboardChain : billboards)
+			AddBillboardData(billboardChain.layerIndex, billboardChain.material, billboardChain.billboardCount, billboardChain.scissorRect, &m_billboards[billboardChain.billboardIndex]);
+
+		for (const Billboard& billboard : depthSortedBillboards)
+			AddBillboardData(billboard.layerIndex, billboard.material, 1, billboard.scissorRect, &billboard.data);
+
+		for (const CustomDrawable& customDrawable : customDrawables)
+			renderQueue->AddDrawable(customDrawable.layerIndex, customDrawable.drawable);
+
+		for (const Model& model : models)
+			renderQueue->AddMesh(model.layerIndex, model.material, model.meshData, model.meshAABB, model.matrix, model.scissorRect);
+
+		for (const Model& model : depthSortedModels)
+			renderQueue->AddMesh(model.layerIndex, model.material, model.meshData, model.meshAABB, model.matrix, model.scissorRect);
+
+		for (const SpriteChain& spriteChain : basicSprites)
+			renderQueue->AddSprites(spriteChain.layerIndex, spriteChain.material, spriteChain.vertices, spriteChain.spriteCount, spriteChain.scissorRect, spriteChain.overlay);
+
+		for (const SpriteChain& spriteChain : depthSortedSprites)
+			renderQueue->AddSprites(spriteChain.layerIndex, spriteChain.material, spriteChain.vertices, spriteChain.spriteCount, spriteChain.scissorRect, spriteChain.overlay);
+	}
+
 	/*!
 	* \brief Clears the queue
 	*
@@ -707,13 +765,6 @@ namespace Nz
 		depthSortedSprites.Clear();
 		models.Clear();
 
-		m_pipelineCache.clear();
-		m_materialCache.clear();
-		m_overlayCache.clear();
-		m_shaderCache.clear();
-		m_textureCache.clear();
-		m_vertexBufferCache.clear();
-
 		m_billboards.clear();
 		m_renderLayers.clear();
 	}
@@ -726,46 +777,30 @@ namespace Nz
 
 	void BasicRenderQueue::Sort(const AbstractViewer* viewer)
 	{
-		m_layerCache.clear();
-		for (int layer : m_renderLayers)
-			m_layerCache.emplace(layer, m_layerCache.size());
-
-		auto GetOrInsert = [](auto& container, auto&& value)
+		// Sort indices are stored on the objects themselves and kept across frames, so building the keys requires no lookup
+		// Fields too small for an index wrap around, which can only cost some state changes
+		auto GetOverlaySortIndex = [](const Texture* overlay) -> UInt64
 		{
-			auto it = container.find(value);
-			if (it == container.end())
-				it = container.emplace(value, container.size()).first;
-
-			return it->second;
+			return (overlay) ? overlay->GetSortIndex() + 1 : 0;
 		};
 
 		basicSprites.Sort([&](const SpriteChain& vertices)
 		{
 			// RQ index:
 			// - Layer (16bits)
-			// - Pipeline (8bits)
-			// - Material (8bits)
-			// - Shader? (8bits)
-			// - Textures (8bits)
-			// - Overlay (8bits)
-			// - Scissor (4bits)
-			// - ??? (4bits)
-
-			UInt64 layerIndex = m_layerCache[vertices.layerIndex];
-			UInt64 pipelineIndex = GetOrInsert(m_pipelineCache, vertices.material->GetPipeline());
-			UInt64 materialIndex = GetOrInsert(m_materialCache, vertices.material);
-			UInt64 shaderIndex = GetOrInsert(m_shaderCache, vertices.material->GetShader());
-			UInt64 textureIndex = GetOrInsert(m_textureCache, vertices.material->GetDiffuseMap());
-			UInt64 overlayIndex = GetOrInsert(m_overlayCache, vertices.overlay);
-			UInt64 scissorIndex = 0; //< TODO
-
-			UInt64 index = (layerIndex    & 0xFFFF) << 48 |
-			               (pipelineIndex & 0xFF)   << 40 |
-			               (materialIndex & 0xFF)   << 32 |
-			               (shaderIndex   & 0xFF)   << 24 |
-			               (textureIndex  & 0xFF)   << 16 |
-			               (overlayIndex  & 0xFF)   << 8 |
-			               (scissorIndex  & 0x0F)   << 4;
+			// - Pipeline (10bits)
+			// - Material (20bits)
+			// - Overlay (18bits)
+
+			UInt64 layerIndex = GetLayerSortIndex(vertices.layerIndex);
+			UInt64 pipelineIndex = vertices.material->GetPipeline()->GetSortIndex();
+			UInt64 materialIndex = vertices.material->GetSortIndex();
+			UInt64 overlayIndex = GetOverlaySortIndex(vertices.overlay);
+
+			UInt64 index = (layerIndex    & 0xFFFF)  << 48 |
+			               (pipelineIndex & 0x3FF)   << 38 |
+			               (materialIndex & 0xFFFFF) << 18 |
+			               (overlayIndex  & 0x3FFFF) <<  0;
 
 			return index;
 		});
@@ -774,28 +809,17 @@ namespace Nz
 		{
 			// RQ index:
 			// - Layer (16bits)
-			// - Pipeline (8bits)
-			// - Material (8bits)
-			// - Shader? (8bits)
-			// - Textures (8bits)
-			// - Scissor (4bits)
-			// - ??? (12bits)
-
-			UInt64 layerIndex = m_layerCache[billboard.layerIndex];
-			UInt64 pipelineIndex = GetOrInsert(m_pipelineCache, billboard.material->GetPipeline());
-			UInt64 materialIndex = GetOrInsert(m_materialCache, billboard.material);
-			UInt64 shaderIndex = GetOrInsert(m_shaderCache, billboard.material->GetShader());
-			UInt64 textureIndex = GetOrInsert(m_textureCache, billboard.material->GetDiffuseMap());
-			UInt64 unknownIndex = 0; //< ???
-			UInt64 scissorIndex = 0; //< TODO
-
-			UInt64 index = (layerIndex    & 0xFFFF) << 48 |
-			               (pipelineIndex & 0xFF)   << 40 |
-			               (materialIndex & 0xFF)   << 32 |
-			               (shaderIndex   & 0xFF)   << 24 |
-			               (textureIndex  & 0xFF)   << 16 |
-			               (scissorIndex  & 0x0F)   << 12 |
-			               (unknownIndex  & 0xFF)   <<  0;
+			// - Pipeline (10bits)
+			// - Material (20bits)
+			// - ??? (18bits)
+
+			UInt64 layerIndex = GetLayerSortIndex(billboard.layerIndex);
+			UInt64 pipelineIndex = billboard.material->GetPipeline()->GetSortIndex();
+			UInt64 materialIndex = billboard.material->GetSortIndex();
+
+			UInt64 index = (layerIndex    & 0xFFFF)  << 48 |
+			               (pipelineIndex & 0x3FF)   << 38 |
+			               (materialIndex & 0xFFFFF) << 18;
 
 			return index;
 		});
@@ -805,7 +829,7 @@ namespace Nz
 			// RQ index:
 			// - Layer (16bits)
 
-			UInt64 layerIndex = m_layerCache[drawable.layerIndex];
+			UInt64 layerIndex = GetLayerSortIndex(drawable.layerIndex);
 
 			UInt64 index = (layerIndex & 0xFFFF) << 48;
 
@@ -817,30 +841,21 @@ namespace Nz
 		{
 			// RQ index:
 			// - Layer (16bits)
-			// - Pipeline (8bits)
-			// - Material (8bits)
-			// - Shader? (8bits)
-			// - Textures (8bits)
-			// - Buffers (8bits)
-			// - Scissor (4bits)
-			// - ??? (4bits)
-
-			UInt64 layerIndex = m_layerCache[renderData.layerIndex];
-			UInt64 pipelineIndex = GetOrInsert(m_pipelineCache, renderData.material->GetPipeline());
-			UInt64 materialIndex = GetOrInsert(m_materialCache, renderData.material);
-			UInt64 shaderIndex = GetOrInsert(m_shaderCache, renderData.material->GetShader());
-			UInt64 textureIndex = GetOrInsert(m_textureCache, renderData.material->GetDiffuseMap());
-			UInt64 bufferIndex = GetOrInsert(m_vertexBufferCache, renderData.meshData.vertexBuffer);
-			UInt64 scissorIndex = 0; //< TODO
-			UInt64 depthIndex = 0; //< TODO
-
-			UInt64 index = (layerIndex    & 0xFFFF) << 48 |
-			               (pipelineIndex & 0xFF)   << 40 |
-			               (materialIndex & 0xFF)   << 32 |
-			               (shaderIndex   & 0xFF)   << 24 |
-			               (textureIndex  & 0xFF)   << 16 |
-			               (bufferIndex   & 0xFF)   <<  8 |
-			               (scissorIndex  & 0x0F)   <<  4;
+			// - Pipeline (10bits)
+			// - Material (20bits)
+			// - Vertex buffer (18bits)
+
+			// Shader and textures are not part of the index, they depend on the pipeline and the material
+
+			UInt64 layerIndex = GetLayerSortIndex(renderData.layerIndex);
+			UInt64 pipelineIndex = renderData.material->GetPipeline()->GetSortIndex();
+			UInt64 materialIndex = renderData.material->GetSortIndex();
+			UInt64 bufferIndex = renderData.meshData.vertexBuffer->GetSortIndex();
+
+			UInt64 index = (layerIndex    & 0xFFFF)  << 48 |
+			               (pipelineIndex & 0x3FF)   << 38 |
+			               (materialIndex & 0xFFFFF) << 18 |
+			               (bufferIndex   & 0x3FFFF) <<  0;
 
 			return index;
 		});
@@ -866,7 +881,7 @@ namespace Nz
 			// a negative distance may happen with billboard behind the camera which we don't care about since they'll not be rendered)
 			float depth = nearPlane.Distance(billboard.data.center);
 
-			UInt64 layerIndex = m_layerCache[billboard.layerIndex];
+			UInt64 layerIndex = GetLayerSortIndex(billboard.layerIndex);
 			UInt64 depthIndex = ~reinterpret_cast<UInt32&>(depth);
 
 			UInt64 index = (layerIndex & 0xFFFF)     << 48 |
@@ -886,7 +901,7 @@ namespace Nz
 
 				float depth = nearPlane.Distance(model.obbSphere.GetPosition());
 
-				UInt64 layerIndex = m_layerCache[model.layerIndex];
+				UInt64 layerIndex = GetLayerSortIndex(model.layerIndex);
 				UInt64 depthIndex = ~reinterpret_cast<UInt32&>(depth);
 
 				UInt64 index = (layerIndex & 0xFFFF)     << 48 |
@@ -904,7 +919,7 @@ namespace Nz
 
 				float depth = nearPlane.Distance(spriteChain.vertices[0].position);
 
-				UInt64 layerIndex = m_layerCache[spriteChain.layerIndex];
+				UInt64 layerIndex = GetLayerSortIndex(spriteChain.layerIndex);
 				UInt64 depthIndex = ~reinterpret_cast<UInt32&>(depth);
 
 				UInt64 index = (layerIndex & 0xFFFF)     << 48 |
@@ -926,10 +941,10 @@ namespace Nz
 
 				float depth = viewerPos.SquaredDistance(model.obbSphere.GetPosition());
 
-				UInt64 layerIndex = m_layerCache[model.layerIndex];
+				UInt64 layerIndex = GetLayerSortIndex(model.layerIndex);
 				UInt64 depthIndex = ~reinterpret_cast<UInt32&>(depth);
 
-				UInt64 index = (layerIndex & 0x0F)       << 48 |
+				UInt64 index = (layerIndex & 0xFFFF)     << 48 |
 				               (depthIndex & 0xFFFFFFFF) << 16;
 
 				return index;
@@ -944,7 +959,7 @@ namespace Nz
 
 				float depth = viewerPos.SquaredDistance(sprites.vertices[0].position);
 
-				UInt64 layerIndex = m_layerCache[sprites.layerIndex];
+				UInt64 layerIndex = GetLayerSortIndex(sprites.layerIndex);
 				UInt64 depthIndex = ~reinterpret_cast<UInt32&>(depth);
 
 				UInt64 index = (layerIndex & 0xFFFF)     << 48 |
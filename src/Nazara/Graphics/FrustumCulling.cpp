@@ -0,0 +1,239 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/FrustumCulling.hpp>
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <algorithm>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+	#define NAZARA_GRAPHICS_FRUSTUMCULLING_SSE
+	#include <xmmintrin.h>
+#endif
+
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		#ifdef NAZARA_GRAPHICS_FRUSTUMCULLING_SSE
+		bool IsSSESupported()
+		{
+			static bool sseSupported = HardwareInfo::Initialize() && HardwareInfo::HasCapability(ProcessorCap_SSE);
+			return sseSupported;
+		}
+
+		void WriteBatchSides(int outsideMask, int intersectingMask, std::size_t laneCount, IntersectionSide* sides)
+		{
+			for (std::size_t lane = 0; lane < laneCount; ++lane)
+			{
+				if (outsideMask & (1 << lane))
+					sides[lane] = IntersectionSide_Outside;
+				else if (intersectingMask & (1 << lane))
+					sides[lane] = IntersectionSide_Intersecting;
+				else
+					sides[lane] = IntersectionSide_Inside;
+			}
+		}
+
+		void IntersectBoxesSSE(const Frustumf& frustum, const float* boxBounds, std::size_t boxCount, IntersectionSide* sides)
+		{
+			constexpr std::size_t BatchSize = FrustumCulling::BatchSize;
+
+			const __m128 zero = _mm_setzero_ps();
+
+			for (std::size_t first = 0; first < boxCount; first += BatchSize)
+			{
+				const float* batch = &boxBounds[first / BatchSize * FrustumCulling::BoxBatchStride];
+
+				__m128 minX = _mm_loadu_ps(&batch[0 * BatchSize]);
+				__m128 minY = _mm_loadu_ps(&batch[1 * BatchSize]);
+				__m128 minZ = _mm_loadu_ps(&batch[2 * BatchSize]);
+				__m128 maxX = _mm_loadu_ps(&batch[3 * BatchSize]);
+				__m128 maxY = _mm_loadu_ps(&batch[4 * BatchSize]);
+				__m128 maxZ = _mm_loadu_ps(&batch[5 * BatchSize]);
+
+				__m128 outside = zero;
+				__m128 intersecting = zero;
+				for (unsigned int i = 0; i <= FrustumPlane_Max; ++i)
+				{
+					const Planef& plane = frustum.GetPlane(static_cast<FrustumPlane>(i));
+
+					// Same vertices as Box::GetPositiveVertex and Box::GetNegativeVertex, the plane being the same for every box
+					__m128 positiveX = (plane.normal.x > 0.f) ? maxX : minX;
+					__m128 positiveY = (plane.normal.y > 0.f) ? maxY : minY;
+					__m128 positiveZ = (plane.normal.z > 0.f) ? maxZ : minZ;
+					__m128 negativeX = (plane.normal.x < 0.f) ? maxX : minX;
+					__m128 negativeY = (plane.normal.y < 0.f) ? maxY : minY;
+					__m128 negativeZ = (plane.normal.z < 0.f) ? maxZ : minZ;
+
+					__m128 normalX = _mm_set1_ps(plane.normal.x);
+					__m128 normalY = _mm_set1_ps(plane.normal.y);
+					__m128 normalZ = _mm_set1_ps(plane.normal.z);
+					__m128 distance = _mm_set1_ps(plane.distance);
+
+					__m128 positiveDistance = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(normalX, positiveX), _mm_mul_ps(normalY, positiveY)), _mm_mul_ps(normalZ, positiveZ)), distance);
+					__m128 negativeDistance = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(normalX, negativeX), _mm_mul_ps(normalY, negativeY)), _mm_mul_ps(normalZ, negativeZ)), distance);
+
+					outside = _mm_or_ps(outside, _mm_cmplt_ps(positiveDistance, zero));
+					intersecting = _mm_or_ps(intersecting, _mm_cmplt_ps(negativeDistance, zero));
+
+					if (_mm_movemask_ps(outside) == 0xF)
+						break;
+				}
+
+				WriteBatchSides(_mm_movemask_ps(outside), _mm_movemask_ps(intersecting), std::min(BatchSize, boxCount - first), &sides[first]);
+			}
+		}
+
+		void IntersectSpheresSSE(const Frustumf& frustum, const float* sphereBounds, std::size_t sphereCount, IntersectionSide* sides)
+		{
+			constexpr std::size_t BatchSize = FrustumCulling::BatchSize;
+
+			const __m128 zero = _mm_setzero_ps();
+
+			for (std::size_t first = 0; first < sphereCount; first += BatchSize)
+			{
+				const float* batch = &sphereBounds[first / BatchSize * FrustumCulling::SphereBatchStride];
+
+				__m128 x = _mm_loadu_ps(&batch[0 * BatchSize]);
+				__m128 y = _mm_loadu_ps(&batch[1 * BatchSize]);
+				__m128 z = _mm_loadu_ps(&batch[2 * BatchSize]);
+				__m128 radius = _mm_loadu_ps(&batch[3 * BatchSize]);
+				__m128 negativeRadius = _mm_sub_ps(zero, radius);
+
+				__m128 outside = zero;
+				__m128 intersecting = zero;
+				for (unsigned int i = 0; i <= FrustumPlane_Max; ++i)
+				{
+					const Planef& plane = frustum.GetPlane(static_cast<FrustumPlane>(i));
+
+					__m128 normalX = _mm_set1_ps(plane.normal.x);
+					__m128 normalY = _mm_set1_ps(plane.normal.y);
+					__m128 normalZ = _mm_set1_ps(plane.normal.z);
+
+					__m128 distance = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(normalX, x), _mm_mul_ps(normalY, y)), _mm_mul_ps(normalZ, z)), _mm_set1_ps(plane.distance));
+
+					outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, negativeRadius));
+					intersecting = _mm_or_ps(intersecting, _mm_cmplt_ps(distance, radius));
+
+					if (_mm_movemask_ps(outside) == 0xF)
+						break;
+				}
+
+				WriteBatchSides(_mm_movemask_ps(outside), _mm_movemask_ps(intersecting), std::min(BatchSize, sphereCount - first), &sides[first]);
+			}
+		}
+		#endif
+	}
+
+	/*!
+	* \ingroup graphics
+	* \class Nz::FrustumCulling
+	* \brief Graphics class testing batches of boxes and spheres against a frustum
+	*
+	* Bounds are stored as structures of arrays, by batches of BatchSize elements:
+	* a box batch is made of the BatchSize minimum X, then minimum Y, minimum Z, maximum X, maximum Y and maximum Z,
+	* a sphere batch of the BatchSize center X, then center Y, center Z and radius.
+	* This allows the batch functions to test BatchSize elements at once using SIMD instructions when the processor supports them.
+	*
+	* Results are the same as the ones of Frustum::Intersect
+	*/
+
+	/*!
+	* \brief Tests a box against a frustum
+	* \return Side of the frustum the box is on
+	*
+	* \param frustum Frustum to test the box against
+	* \param boxBounds Box bounds arrays
+	* \param index Index of the box
+	*/
+	IntersectionSide FrustumCulling::IntersectBox(const Frustumf& frustum, const float* boxBounds, std::size_t index)
+	{
+		const float* batch = &boxBounds[(index / BatchSize) * BoxBatchStride + index % BatchSize];
+
+		IntersectionSide side = IntersectionSide_Inside;
+		for (unsigned int i = 0; i <= FrustumPlane_Max; ++i)
+		{
+			const Planef& plane = frustum.GetPlane(static_cast<FrustumPlane>(i));
+
+			Vector3f positiveVertex((plane.normal.x > 0.f) ? batch[3 * BatchSize] : batch[0 * BatchSize],
+			                        (plane.normal.y > 0.f) ? batch[4 * BatchSize] : batch[1 * BatchSize],
+			                        (plane.normal.z > 0.f) ? batch[5 * BatchSize] : batch[2 * BatchSize]);
+
+			if (plane.Distance(positiveVertex) < 0.f)
+				return IntersectionSide_Outside;
+
+			Vector3f negativeVertex((plane.normal.x < 0.f) ? batch[3 * BatchSize] : batch[0 * BatchSize],
+			                        (plane.normal.y < 0.f) ? batch[4 * BatchSize] : batch[1 * BatchSize],
+			                        (plane.normal.z < 0.f) ? batch[5 * BatchSize] : batch[2 * BatchSize]);
+
+			if (plane.Distance(negativeVertex) < 0.f)
+				side = IntersectionSide_Intersecting;
+		}
+
+		return side;
+	}
+
+	/*!
+	* \brief Tests boxes against a frustum
+	*
+	* \param frustum Frustum to test the boxes against
+	* \param boxBounds Box bounds arrays, holding at least GetBoxBoundsSize(boxCount) floats
+	* \param boxCount Number of boxes to test
+	* \param sides Array of boxCount elements receiving the side of the frustum each box is on
+	*/
+	void FrustumCulling::IntersectBoxes(const Frustumf& frustum, const float* boxBounds, std::size_t boxCount, IntersectionSide* sides)
+	{
+		#ifdef NAZARA_GRAPHICS_FRUSTUMCULLING_SSE
+		if (IsSSESupported())
+		{
+			IntersectBoxesSSE(frustum, boxBounds, boxCount, sides);
+			return;
+		}
+		#endif
+
+		for (std::size_t i = 0; i < boxCount; ++i)
+			sides[i] = IntersectBox(frustum, boxBounds, i);
+	}
+
+	/*!
+	* \brief Tests a sphere against a frustum
+	* \return Side of the frustum the sphere is on
+	*
+	* \param frustum Frustum to test the sphere against
+	* \param sphereBounds Sphere bounds arrays
+	* \param index Index of the sphere
+	*/
+	IntersectionSide FrustumCulling::IntersectSphere(const Frustumf& frustum, const float* sphereBounds, std::size_t index)
+	{
+		return frustum.Intersect(GetSphere(sphereBounds, index));
+	}
+
+	/*!
+	* \brief Tests spheres against a frustum
+	*
+	* \param frustum Frustum to test the spheres against
+	* \param sphereBounds Sphere bounds arrays, holding at least GetSphereBoundsSize(sphereCount) floats
+	* \param sphereCount Number of spheres to test
+	* \param sides Array of sphereCount elements receiving the side of the frustum each sphere is on
+	*/
+	void FrustumCulling::IntersectSpheres(const Frustumf& frustum, const float* sphereBounds, std::size_t sphereCount, IntersectionSide* sides)
+	{
+		#ifdef NAZARA_GRAPHICS_FRUSTUMCULLING_SSE
+		if (IsSSESupported())
+		{
+			IntersectSpheresSSE(frustum, sphereBounds, sphereCount, sides);
+			return;
+		}
+		#endif
+
+		for (std::size_t i = 0; i < sphereCount; ++i)
+			sides[i] = IntersectSphere(frustum, sphereBounds, i);
+	}
+
+	constexpr std::size_t FrustumCulling::BatchSize;
+	constexpr std::size_t FrustumCulling::BoxBatchStride;
+	constexpr std::size_t FrustumCulling::SphereBatchStride;
+}
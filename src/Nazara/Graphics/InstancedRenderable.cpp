@@ -26,6 +26,24 @@ namespace Nz
 		OnInstancedRenderableRelease(this);
 	}
 
+	/*!
+	* \brief Adds the parts of the instanced intersecting the frustum to the render queue
+	*
+	* \param frustum Frustum the instanced is partially visible from
+	* \param renderQueue Queue to be added
+	* \param instanceData Data for the instance
+	* \param scissorRect Scissor rect to use
+	*
+	* \remark The default implementation adds the whole instanced, renderables made of many independent parts should override this
+	*/
+
+	void InstancedRenderable::AddToRenderQueueByCulling(const Frustumf& frustum, AbstractRenderQueue* renderQueue, const InstanceData& instanceData, const Recti& scissorRect) const
+	{
+		NazaraUnused(frustum);
+
+		AddToRenderQueue(renderQueue, instanceData, scissorRect);
+	}
+
 	/*!
 	* \brief Culls the instanced if not in the frustum
 	* \return true If instanced is in the frustum
@@ -39,6 +57,17 @@ namespace Nz
 		return frustum.Contains(instanceData.volume);
 	}
 
+	/*!
+	* \brief Ensures every lazily built data used by AddToRenderQueue is up to date
+	*
+	* Once called, AddToRenderQueue and AddToRenderQueueByCulling must not modify any shared state, which allows them to be called from multiple threads until the renderable is modified.
+	* The default implementation does nothing.
+	*/
+
+	void InstancedRenderable::EnsureRenderQueueDataUpdated() const
+	{
+	}
+
 	/*!
 	* \brief Gets the bounding volume
 	* \return Bounding volume of the instanced
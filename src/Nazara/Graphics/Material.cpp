@@ -494,6 +494,7 @@ namespace Nz
 		MaterialLibrary::Uninitialize();
 	}
 
+	IndexPool Material::s_sortIndexPool; //< Defined first so it's destroyed after the default material
 	std::array<int, TextureMap_Max + 1> Material::s_textureUnits;
 	MaterialLibrary::LibraryMap Material::s_library;
 	MaterialLoader::LoaderList Material::s_loaders;
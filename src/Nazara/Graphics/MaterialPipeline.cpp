@@ -229,6 +229,7 @@ namespace Nz
 		MaterialPipelineLibrary::Uninitialize();
 	}
 
+	IndexPool MaterialPipeline::s_sortIndexPool; //< Defined first so it's destroyed after the pipelines
 	MaterialPipelineLibrary::LibraryMap MaterialPipeline::s_library;
 	MaterialPipeline::PipelineCache MaterialPipeline::s_pipelineCache;
 }
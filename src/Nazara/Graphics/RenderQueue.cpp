@@ -4,15 +4,76 @@
 
 #include <Nazara/Graphics/RenderQueue.hpp>
 #include <Nazara/Core/TaskScheduler.hpp>
+#include <array>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		constexpr std::size_t RadixBits = 8;
+		constexpr std::size_t RadixSize = 1 << RadixBits;
+		constexpr std::size_t RadixPassCount = sizeof(RenderQueueInternal::Index) * 8 / RadixBits;
+
+		// Under this count, an insertion sort is faster than going through the histograms
+		constexpr std::size_t InsertionSortThreshold = 64;
+	}
+
+	/*!
+	* \brief Sorts the render queue by ascending index
+	*
+	* This is a stable least significant digit radix sort, passes over a digit shared by all indices are skipped.
+	*/
 	void RenderQueueInternal::Sort()
 	{
-		std::sort(m_orderedRenderQueue.begin(), m_orderedRenderQueue.end(), [](const RenderDataPair& lhs, const RenderDataPair& rhs)
+		std::size_t count = m_orderedRenderQueue.size();
+		if (count < InsertionSortThreshold)
+		{
+			for (std::size_t i = 1; i < count; ++i)
+			{
+				RenderDataPair pair = m_orderedRenderQueue[i];
+
+				std::size_t j = i;
+				for (; j > 0 && m_orderedRenderQueue[j - 1].first > pair.first; --j)
+					m_orderedRenderQueue[j] = m_orderedRenderQueue[j - 1];
+
+				m_orderedRenderQueue[j] = pair;
+			}
+
+			return;
+		}
+
+		// Histograms of every digit, computed at once
+		std::array<std::array<std::size_t, RadixSize>, RadixPassCount> histograms = {};
+		for (const RenderDataPair& pair : m_orderedRenderQueue)
+		{
+			for (std::size_t pass = 0; pass < RadixPassCount; ++pass)
+				histograms[pass][(pair.first >> (pass * RadixBits)) & (RadixSize - 1)]++;
+		}
+
+		m_sortBuffer.resize(count);
+
+		for (std::size_t pass = 0; pass < RadixPassCount; ++pass)
 		{
-			return lhs.first < rhs.first;
-		});
+			std::size_t shift = pass * RadixBits;
+			std::array<std::size_t, RadixSize>& histogram = histograms[pass];
+
+			// Every index has the same digit, this pass would not move anything
+			if (histogram[(m_orderedRenderQueue.front().first >> shift) & (RadixSize - 1)] == count)
+				continue;
+
+			std::size_t offset = 0;
+			for (std::size_t& digitCount : histogram)
+			{
+				std::size_t digitOffset = offset;
+				offset += digitCount;
+				digitCount = digitOffset;
+			}
+
+			for (const RenderDataPair& pair : m_orderedRenderQueue)
+				m_sortBuffer[histogram[(pair.first >> shift) & (RadixSize - 1)]++] = pair;
+
+			std::swap(m_orderedRenderQueue, m_sortBuffer);
+		}
 	}
 }
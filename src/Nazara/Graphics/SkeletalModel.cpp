@@ -152,6 +152,24 @@ namespace Nz
 		m_animationEnabled = animation;
 	}
 
+	/*!
+	* \brief Skins the submeshes and computes the skeleton AABB ahead of AddToRenderQueue
+	*
+	* SkinningManager creates the skinned vertex buffers and queues them for skinning, which can only happen from the updating thread.
+	*/
+
+	void SkeletalModel::EnsureRenderQueueDataUpdated() const
+	{
+		if (!m_mesh)
+			return;
+
+		unsigned int submeshCount = m_mesh->GetSubMeshCount();
+		for (unsigned int i = 0; i < submeshCount; ++i)
+			SkinningManager::GetBuffer(static_cast<const SkeletalMesh*>(m_mesh->GetSubMesh(i)), &m_skeleton);
+
+		m_skeleton.GetAABB();
+	}
+
 	/*!
 	* \brief Gets the animation of the model
 	* \return Pointer to the animation
@@ -4,6 +4,7 @@
 
 #include <Nazara/Graphics/SkinningManager.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/Parallel.hpp>
 #include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Utility/Algorithm.hpp>
 #include <Nazara/Utility/Joint.hpp>
@@ -92,14 +93,10 @@ namespace Nz
 			for (unsigned int i = 0; i < jointCount; ++i)
 				skinningData.joints[i].EnsureSkinningMatrixUpdate();
 
-			unsigned int workerCount = TaskScheduler::GetWorkerCount();
-
-			std::ldiv_t div = std::ldiv(mesh->GetVertexCount(), workerCount);
-			for (unsigned int i = 0; i < workerCount; ++i)
-				TaskScheduler::AddTask(SkinPositionNormalTangent, skinningData, i*div.quot, (i == workerCount-1) ? div.quot + div.rem : div.quot);
-
-			TaskScheduler::Run();
-			TaskScheduler::WaitForTasks();
+			ParallelFor(0U, mesh->GetVertexCount(), 0U, [&skinningData](unsigned int firstVertex, unsigned int lastVertex)
+			{
+				SkinPositionNormalTangent(skinningData, firstVertex, lastVertex - firstVertex);
+			});
 		}
 	}
 
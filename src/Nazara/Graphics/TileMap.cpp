@@ -6,15 +6,51 @@
 #include <Nazara/Graphics/AbstractRenderQueue.hpp>
 #include <Nazara/Math/Rect.hpp>
 #include <Nazara/Utility/VertexStruct.hpp>
+#include <algorithm>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		// Instance data layout: the transform matrix the vertices were generated with, the data of every chunk, then the vertices of every chunk
+		struct ChunkData
+		{
+			Boxf aabb;
+			UInt64 version;
+		};
+
+		constexpr std::size_t ChunkSpriteCount = TileMap::ChunkSize * TileMap::ChunkSize;
+
+		ChunkData* GetChunkData(UInt8* data)
+		{
+			return reinterpret_cast<ChunkData*>(data + sizeof(Matrix4f));
+		}
+
+		const ChunkData* GetChunkData(const UInt8* data)
+		{
+			return reinterpret_cast<const ChunkData*>(data + sizeof(Matrix4f));
+		}
+
+		VertexStruct_XYZ_Color_UV* GetChunkVertices(UInt8* data, std::size_t chunkCount)
+		{
+			return reinterpret_cast<VertexStruct_XYZ_Color_UV*>(data + sizeof(Matrix4f) + chunkCount * sizeof(ChunkData));
+		}
+
+		const VertexStruct_XYZ_Color_UV* GetChunkVertices(const UInt8* data, std::size_t chunkCount)
+		{
+			return reinterpret_cast<const VertexStruct_XYZ_Color_UV*>(data + sizeof(Matrix4f) + chunkCount * sizeof(ChunkData));
+		}
+	}
+
 	/*!
 	* \ingroup graphics
 	* \class Nz::TileMap
 	* \brief Graphics class that represent several tiles of the same size assembled into a grid
 	*  This class is far more efficient than using a sprite for every tile
+	*
+	* Tiles are grouped by chunks of ChunkSize x ChunkSize tiles, each with its own bounds:
+	* only the chunks intersecting the view are rendered and only the modified chunks have their vertices regenerated.
 	*/
 
 	/*!
@@ -25,19 +61,19 @@ namespace Nz
 	*/
 	void TileMap::AddToRenderQueue(AbstractRenderQueue* renderQueue, const InstanceData& instanceData, const Recti& scissorRect) const
 	{
-		const VertexStruct_XYZ_Color_UV* vertices = reinterpret_cast<const VertexStruct_XYZ_Color_UV*>(instanceData.data.data());
-
-		std::size_t spriteCount = 0;
-		for (std::size_t layerIndex = 0; layerIndex < m_layers.size(); ++layerIndex)
-		{
-			const auto& layer = m_layers[layerIndex];
-			if (layer.tiles.empty())
-				continue;
-
-			renderQueue->AddSprites(instanceData.renderOrder, GetMaterial(layerIndex), &vertices[4 * spriteCount], layer.tiles.size(), scissorRect);
+		AddChunksToRenderQueue(nullptr, renderQueue, instanceData, scissorRect);
+	}
 
-			spriteCount += layer.tiles.size();
-		}
+	/*!
+	* \brief Adds the chunks of the TileMap intersecting the frustum to the rendering queue
+	*
+	* \param frustum Frustum the TileMap is partially visible from
+	* \param renderQueue Queue to be added
+	* \param instanceData Data for the instance
+	*/
+	void TileMap::AddToRenderQueueByCulling(const Frustumf& frustum, AbstractRenderQueue* renderQueue, const InstanceData& instanceData, const Recti& scissorRect) const
+	{
+		AddChunksToRenderQueue(&frustum, renderQueue, instanceData, scissorRect);
 	}
 
 	/*!
@@ -48,6 +84,32 @@ namespace Nz
 		return std::make_unique<TileMap>(*this);
 	}
 
+	void TileMap::AddChunksToRenderQueue(const Frustumf* frustum, AbstractRenderQueue* renderQueue, const InstanceData& instanceData, const Recti& scissorRect) const
+	{
+		const ChunkData* chunkData = GetChunkData(instanceData.data.data());
+		const VertexStruct_XYZ_Color_UV* vertices = GetChunkVertices(instanceData.data.data(), m_chunks.size());
+
+		for (std::size_t chunkIndex = 0; chunkIndex < m_chunks.size(); ++chunkIndex)
+		{
+			if (frustum && !frustum->Contains(chunkData[chunkIndex].aabb))
+				continue;
+
+			const Chunk& chunk = m_chunks[chunkIndex];
+
+			std::size_t spriteCount = 0;
+			for (std::size_t layerIndex = 0; layerIndex < chunk.layers.size(); ++layerIndex)
+			{
+				const Layer& layer = chunk.layers[layerIndex];
+				if (layer.tiles.empty())
+					continue;
+
+				renderQueue->AddSprites(instanceData.renderOrder, GetMaterial(layerIndex), &vertices[4 * (chunkIndex * ChunkSpriteCount + spriteCount)], layer.tiles.size(), scissorRect);
+
+				spriteCount += layer.tiles.size();
+			}
+		}
+	}
+
 	void TileMap::MakeBoundingVolume() const
 	{
 		Nz::Vector2f size = GetSize();
@@ -56,51 +118,85 @@ namespace Nz
 
 	void TileMap::UpdateData(InstanceData* instanceData) const
 	{
-		std::size_t spriteCount = 0;
-		for (const Layer& layer : m_layers)
-			spriteCount += layer.tiles.size();
+		// Chunks keep their vertices in a fixed slot of the instance data, allowing to regenerate only the ones which were modified since the last update
+		std::size_t dataSize = sizeof(Matrix4f) + m_chunks.size() * (sizeof(ChunkData) + 4 * ChunkSpriteCount * sizeof(VertexStruct_XYZ_Color_UV));
 
-		instanceData->data.resize(4 * spriteCount * sizeof(VertexStruct_XYZ_Color_UV));
-		VertexStruct_XYZ_Color_UV* vertices = reinterpret_cast<VertexStruct_XYZ_Color_UV*>(instanceData->data.data());
+		bool regenerateAll = false;
+		if (instanceData->data.size() != dataSize)
+		{
+			instanceData->data.assign(dataSize, 0);
+			regenerateAll = true;
+		}
 
-		spriteCount = 0;
-		for (const Layer& layer : m_layers)
+		Matrix4f& transformMatrix = *reinterpret_cast<Matrix4f*>(instanceData->data.data());
+		if (regenerateAll || transformMatrix != instanceData->transformMatrix)
 		{
-			SparsePtr<Color> colorPtr(&vertices[4 * spriteCount].color, sizeof(VertexStruct_XYZ_Color_UV));
-			SparsePtr<Vector3f> posPtr(&vertices[4 * spriteCount].position, sizeof(VertexStruct_XYZ_Color_UV));
-			SparsePtr<Vector2f> texCoordPtr(&vertices[4 * spriteCount].uv, sizeof(VertexStruct_XYZ_Color_UV));
+			transformMatrix = instanceData->transformMatrix;
+			regenerateAll = true;
+		}
 
-			for (std::size_t tileIndex : layer.tiles)
-			{
-				const Tile& tile = m_tiles[tileIndex];
-				NazaraAssert(tile.enabled, "Tile specified for rendering is not enabled");
+		ChunkData* chunkData = GetChunkData(instanceData->data.data());
+		VertexStruct_XYZ_Color_UV* vertices = GetChunkVertices(instanceData->data.data(), m_chunks.size());
+
+		auto GetTileLeftCorner = [&](unsigned int x, unsigned int y)
+		{
+			if (m_isometricModeEnabled)
+				return Vector3f(x * m_tileSize.x + m_tileSize.x/2.f * (y % 2), y/2.f * -m_tileSize.y, 0.f);
+			else
+				return Vector3f(x * m_tileSize.x, y * -m_tileSize.y, 0.f);
+		};
+
+		for (std::size_t chunkIndex = 0; chunkIndex < m_chunks.size(); ++chunkIndex)
+		{
+			const Chunk& chunk = m_chunks[chunkIndex];
+			if (!regenerateAll && chunkData[chunkIndex].version == chunk.version)
+				continue;
 
-				std::size_t x = tileIndex % m_mapSize.x;
-				std::size_t y = tileIndex / m_mapSize.x;
+			// Bounds of the whole chunk, whether its tiles are enabled or not
+			unsigned int firstX = static_cast<unsigned int>(chunkIndex % m_chunkCount.x) * ChunkSize;
+			unsigned int firstY = static_cast<unsigned int>(chunkIndex / m_chunkCount.x) * ChunkSize;
+			unsigned int lastX = std::min(firstX + ChunkSize, m_mapSize.x) - 1;
+			unsigned int lastY = std::min(firstY + ChunkSize, m_mapSize.y) - 1;
 
-				Vector3f tileLeftCorner;
-				if (m_isometricModeEnabled)
-					tileLeftCorner.Set(x * m_tileSize.x + m_tileSize.x/2.f * (y % 2), y/2.f * -m_tileSize.y, 0.f);
-				else
-					tileLeftCorner.Set(x * m_tileSize.x, y * -m_tileSize.y, 0.f);
+			Boxf chunkBox(GetTileLeftCorner(firstX, firstY), GetTileLeftCorner(lastX, lastY) + m_tileSize.x * Vector3f::Right() + m_tileSize.y * Vector3f::Down());
+			if (m_isometricModeEnabled && firstY != lastY)
+				chunkBox.ExtendTo(GetTileLeftCorner(lastX, lastY - 1) + m_tileSize.x * Vector3f::Right());
 
-				*colorPtr++ = tile.color;
-				*posPtr++ = instanceData->transformMatrix.Transform(tileLeftCorner);
-				*texCoordPtr++ = tile.textureCoords.GetCorner(RectCorner_LeftTop);
+			chunkData[chunkIndex].aabb = chunkBox.Transform(instanceData->transformMatrix);
+			chunkData[chunkIndex].version = chunk.version;
 
-				*colorPtr++ = tile.color;
-				*posPtr++ = instanceData->transformMatrix.Transform(tileLeftCorner + m_tileSize.x * Vector3f::Right());
-				*texCoordPtr++ = tile.textureCoords.GetCorner(RectCorner_RightTop);
+			VertexStruct_XYZ_Color_UV* chunkVertices = &vertices[4 * chunkIndex * ChunkSpriteCount];
 
-				*colorPtr++ = tile.color;
-				*posPtr++ = instanceData->transformMatrix.Transform(tileLeftCorner + m_tileSize.y * Vector3f::Down());
-				*texCoordPtr++ = tile.textureCoords.GetCorner(RectCorner_LeftBottom);
+			SparsePtr<Color> colorPtr(&chunkVertices->color, sizeof(VertexStruct_XYZ_Color_UV));
+			SparsePtr<Vector3f> posPtr(&chunkVertices->position, sizeof(VertexStruct_XYZ_Color_UV));
+			SparsePtr<Vector2f> texCoordPtr(&chunkVertices->uv, sizeof(VertexStruct_XYZ_Color_UV));
 
-				*colorPtr++ = tile.color;
-				*posPtr++ = instanceData->transformMatrix.Transform(tileLeftCorner + m_tileSize.x * Vector3f::Right() + m_tileSize.y * Vector3f::Down());
-				*texCoordPtr++ = tile.textureCoords.GetCorner(RectCorner_RightBottom);
+			for (const Layer& layer : chunk.layers)
+			{
+				for (std::size_t tileIndex : layer.tiles)
+				{
+					const Tile& tile = m_tiles[tileIndex];
+					NazaraAssert(tile.enabled, "Tile specified for rendering is not enabled");
+
+					Vector3f tileLeftCorner = GetTileLeftCorner(static_cast<unsigned int>(tileIndex % m_mapSize.x), static_cast<unsigned int>(tileIndex / m_mapSize.x));
+
+					*colorPtr++ = tile.color;
+					*posPtr++ = instanceData->transformMatrix.Transform(tileLeftCorner);
+					*texCoordPtr++ = tile.textureCoords.GetCorner(RectCorner_LeftTop);
+
+					*colorPtr++ = tile.color;
+					*posPtr++ = instanceData->transformMatrix.Transform(tileLeftCorner + m_tileSize.x * Vector3f::Right());
+					*texCoordPtr++ = tile.textureCoords.GetCorner(RectCorner_RightTop);
+
+					*colorPtr++ = tile.color;
+					*posPtr++ = instanceData->transformMatrix.Transform(tileLeftCorner + m_tileSize.y * Vector3f::Down());
+					*texCoordPtr++ = tile.textureCoords.GetCorner(RectCorner_LeftBottom);
+
+					*colorPtr++ = tile.color;
+					*posPtr++ = instanceData->transformMatrix.Transform(tileLeftCorner + m_tileSize.x * Vector3f::Right() + m_tileSize.y * Vector3f::Down());
+					*texCoordPtr++ = tile.textureCoords.GetCorner(RectCorner_RightBottom);
+				}
 			}
-			spriteCount += layer.tiles.size();
 		}
 	}
 
@@ -131,5 +227,7 @@ namespace Nz
 		TileMapLibrary::Uninitialize();
 	}
 
+	constexpr unsigned int TileMap::ChunkSize;
+
 	TileMapLibrary::LibraryMap TileMap::s_library;
 }
@@ -31,6 +31,7 @@ namespace Nz
 	*/
 
 	AbstractSocket::AbstractSocket(SocketType type) :
+	m_protocol(NetProtocol_Unknown),
 	m_lastError(SocketError_NoError),
 	m_handle(SocketImpl::InvalidHandle),
 	m_state(SocketState_NotConnected),
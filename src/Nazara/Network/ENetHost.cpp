@@ -39,6 +39,28 @@ namespace Nz
 			sizeof(ENetProtocolThrottleConfigure),
 			sizeof(ENetProtocolSendFragment)
 		};
+
+		// Size of a datagram slot of the batches, large enough for a header followed by a maximum size (possibly compressed) packet
+		constexpr std::size_t s_datagramSize = sizeof(ENetProtocolHeader) + sizeof(UInt32) + ENetConstants::ENetProtocol_MaximumMTU;
+
+		// Errors coming from the destination or the path of a single datagram, the socket itself can still be used
+		bool IsDatagramError(SocketError error)
+		{
+			switch (error)
+			{
+				case SocketError_AddressNotAvailable:
+				case SocketError_ConnectionRefused:
+				case SocketError_DatagramSize:
+				case SocketError_Interrupted:
+				case SocketError_NetworkError:
+				case SocketError_ResourceError:
+				case SocketError_UnreachableHost:
+					return true;
+
+				default:
+					return false;
+			}
+		}
 	}
 
 
@@ -193,6 +215,32 @@ namespace Nz
 		for (std::size_t i = 0; i < peerCount; ++i)
 			m_peers.emplace_back(this, UInt16(i));
 
+		// Datagrams are received and sent by batches, each one having its own slot
+		constexpr std::size_t batchSize = ENetConstants::ENetHost_DatagramBatchSize;
+
+		m_datagramData.resize(2 * batchSize * s_datagramSize);
+		m_datagramBuffers.resize(2 * batchSize);
+		for (std::size_t i = 0; i < m_datagramBuffers.size(); ++i)
+		{
+			m_datagramBuffers[i].data = &m_datagramData[i * s_datagramSize];
+			m_datagramBuffers[i].dataLength = s_datagramSize;
+		}
+
+		m_incomingDatagrams.resize(batchSize);
+		m_outgoingDatagrams.resize(batchSize);
+		for (std::size_t i = 0; i < batchSize; ++i)
+		{
+			m_incomingDatagrams[i].buffers = &m_datagramBuffers[i];
+			m_incomingDatagrams[i].bufferCount = 1;
+
+			m_outgoingDatagrams[i].buffers = &m_datagramBuffers[batchSize + i];
+			m_outgoingDatagrams[i].bufferCount = 1;
+		}
+
+		m_incomingDatagramCount = 0;
+		m_incomingDatagramOffset = 0;
+		m_outgoingDatagramCount = 0;
+
 		return true;
 	}
 
@@ -311,9 +359,18 @@ namespace Nz
 
 	ENetPacketRef ENetHost::AllocatePacket(ENetPacketFlags flags)
 	{
-		ENetPacketRef enetPacket = m_packetPool.New<ENetPacket>();
+		ENetPacket* packet = m_packetPool.New<ENetPacket>();
+		if (packet)
+			packet->owner = &m_packetPool;
+		else
+		{
+			// The pool reached its maximum size, don't lose the packet for that
+			packet = new ENetPacket;
+			packet->owner = nullptr;
+		}
+
+		ENetPacketRef enetPacket = packet;
 		enetPacket->flags = flags;
-		enetPacket->owner = &m_packetPool;
 
 		return enetPacket;
 	}
@@ -328,6 +385,13 @@ namespace Nz
 		m_socket.SetReceiveBufferSize(ENetConstants::ENetHost_ReceiveBufferSize);
 		m_socket.SetSendBufferSize(ENetConstants::ENetHost_SendBufferSize);
 
+		// Sharded hosts bind several sockets to the same port
+		if (m_isReusingPort && !m_socket.EnableReusePort(true))
+		{
+			NazaraError("Failed to enable port reuse: " + String(ErrorToString(m_socket.GetLastError())));
+			return false;
+		}
+
 		if (address.IsValid() && !address.IsLoopback())
 		{
 			if (m_socket.Bind(address) != SocketState_Bound)
@@ -700,6 +764,7 @@ namespace Nz
 		{
 			bool shouldReceive = true;
 			std::size_t receivedLength;
+			UInt8* receivedData = m_packetData[0].data();
 
 			if (m_isSimulationEnabled)
 			{
@@ -721,11 +786,24 @@ namespace Nz
 
 			if (shouldReceive)
 			{
-				if (!m_socket.Receive(m_packetData[0].data(), m_packetData[0].size(), &m_receivedAddress, &receivedLength))
-					return -1; //< Error
+				// Datagrams are received by batches, the ones left by a previous call (which returned an event) are handled first
+				if (m_incomingDatagramOffset == m_incomingDatagramCount)
+				{
+					m_incomingDatagramCount = 0;
+					m_incomingDatagramOffset = 0;
 
-				if (receivedLength == 0)
-					return 0;
+					if (!m_socket.ReceiveDatagrams(m_incomingDatagrams.data(), m_incomingDatagrams.size(), &m_incomingDatagramCount))
+						return -1; //< Error
+
+					if (m_incomingDatagramCount == 0)
+						return 0;
+				}
+
+				const UdpDatagram& datagram = m_incomingDatagrams[m_incomingDatagramOffset++];
+
+				m_receivedAddress = datagram.address;
+				receivedData = static_cast<UInt8*>(datagram.buffers[0].data);
+				receivedLength = datagram.dataLength;
 
 				if (m_isSimulationEnabled)
 				{
@@ -738,7 +816,7 @@ namespace Nz
 						PendingIncomingPacket pendingPacket;
 						pendingPacket.deliveryTime = m_serviceTime + delay;
 						pendingPacket.from = m_receivedAddress;
-						pendingPacket.data.Reset(0, m_packetData[0].data(), receivedLength);
+						pendingPacket.data.Reset(0, receivedData, receivedLength);
 
 						auto it = std::upper_bound(m_pendingIncomingPackets.begin(), m_pendingIncomingPackets.end(), pendingPacket, [] (const PendingIncomingPacket& first, const PendingIncomingPacket& second)
 						{
@@ -751,7 +829,7 @@ namespace Nz
 				}
 			}
 
-			m_receivedData = m_packetData[0].data();
+			m_receivedData = receivedData;
 			m_receivedDataLength = receivedLength;
 
 			m_totalReceivedData += receivedLength;
@@ -804,6 +882,31 @@ namespace Nz
 		}
 	}
 
+	bool ENetHost::QueueOutgoingDatagram(const IpAddress& to, const NetBuffer* buffers, std::size_t bufferCount)
+	{
+		if (m_outgoingDatagramCount == m_outgoingDatagrams.size() && !SendOutgoingDatagrams())
+			return false;
+
+		UdpDatagram& datagram = m_outgoingDatagrams[m_outgoingDatagramCount++];
+		datagram.address = to;
+
+		// Buffers may reference commands and packets which are going to be reused or released, copy them into the datagram slot
+		UInt8* datagramData = static_cast<UInt8*>(datagram.buffers[0].data);
+		std::size_t datagramSize = 0;
+		for (std::size_t i = 0; i < bufferCount; ++i)
+		{
+			const NetBuffer& buffer = buffers[i];
+			NazaraAssert(datagramSize + buffer.dataLength <= s_datagramSize, "Datagram is too big");
+
+			std::memcpy(&datagramData[datagramSize], buffer.data, buffer.dataLength);
+			datagramSize += buffer.dataLength;
+		}
+
+		datagram.buffers[0].dataLength = datagramSize;
+
+		return true;
+	}
+
 	void ENetHost::SendAcknowledgements(ENetPeer* peer)
 	{
 		auto it = peer->m_acknowledgements.begin();
@@ -918,11 +1021,8 @@ namespace Nz
 			if (peer->m_sentReliableCommands.empty())
 				peer->m_nextTimeout = m_serviceTime + outgoingCommand->roundTripTimeout;
 
-			peer->m_sentReliableCommands.emplace_back(std::move(*outgoingCommand));
-
-			peer->m_outgoingReliableCommands.erase(outgoingCommand);
-			outgoingCommand = peer->m_sentReliableCommands.end();
-			--outgoingCommand;
+			// Moving the node keeps outgoingCommand valid, now referencing a sent command
+			peer->m_sentReliableCommands.splice(peer->m_sentReliableCommands.end(), peer->m_outgoingReliableCommands, outgoingCommand);
 
 			outgoingCommand->sentTime = m_serviceTime;
 
@@ -987,7 +1087,7 @@ namespace Nz
 				if (checkForTimeouts && !currentPeer->m_sentReliableCommands.empty() && ENetTimeGreaterEqual(m_serviceTime, currentPeer->m_nextTimeout) && currentPeer->CheckTimeouts(event))
 				{
 					if (event && event->type != ENetEventType::None)
-						return 1;
+						return (SendOutgoingDatagrams()) ? 1 : -1;
 					else
 						continue;
 				}
@@ -1048,9 +1148,13 @@ namespace Nz
 				std::size_t compressedSize = 0;
 				if (m_compressor)
 				{
-					compressedSize = m_compressor->Compress(currentPeer, &m_buffers[1], m_bufferCount - 1, m_packetSize - sizeof(ENetProtocolHeader), m_packetData[1].data(), m_packetData[1].size());
-					if (compressedSize > 0)
+					// Compressed data is only sent when it's smaller than the original one
+					std::size_t originalSize = m_packetSize - sizeof(ENetProtocolHeader);
+					compressedSize = m_compressor->Compress(currentPeer, &m_buffers[1], m_bufferCount - 1, originalSize, m_packetData[1].data(), originalSize);
+					if (compressedSize > 0 && compressedSize < originalSize)
 						m_headerFlags |= ENetProtocolHeaderFlag_Compressed;
+					else
+						compressedSize = 0;
 				}
 
 				if (currentPeer->m_outgoingPeerID < ENetConstants::ENetProtocol_MaximumPeerId)
@@ -1103,15 +1207,9 @@ namespace Nz
 					}
 				}
 
-				if (sendNow)
-				{
-					std::size_t sentLength = 0;
-
-					if (!m_socket.SendMultiple(currentPeer->GetAddress(), m_buffers.data(), m_bufferCount, &sentLength))
-						return -1;
-
-					m_totalSentData += sentLength;
-				}
+				// Datagrams are sent by batches, after every peer has been processed
+				if (sendNow && !QueueOutgoingDatagram(currentPeer->GetAddress(), m_buffers.data(), m_bufferCount))
+					return -1;
 
 				currentPeer->RemoveSentUnreliableCommands();
 				m_totalSentPackets++;
@@ -1133,9 +1231,43 @@ namespace Nz
 			m_pendingOutgoingPackets.erase(m_pendingOutgoingPackets.begin(), it);
 		}
 
+		if (!SendOutgoingDatagrams())
+			return -1;
+
 		return 0;
 	}
 
+	bool ENetHost::SendOutgoingDatagrams()
+	{
+		if (m_outgoingDatagramCount == 0)
+			return true;
+
+		std::size_t datagramCount = m_outgoingDatagramCount;
+		m_outgoingDatagramCount = 0;
+
+		std::size_t offset = 0;
+		while (offset < datagramCount)
+		{
+			std::size_t sentCount = 0;
+			bool succeeded = m_socket.SendDatagrams(&m_outgoingDatagrams[offset], datagramCount - offset, &sentCount);
+
+			for (std::size_t i = 0; i < sentCount; ++i)
+				m_totalSentData += m_outgoingDatagrams[offset + i].buffers[0].dataLength;
+
+			// Datagrams which could not be sent (because the socket would have blocked) are dropped, as any UDP datagram could be
+			if (succeeded)
+				break;
+
+			// The same goes for a datagram failing because of its destination, the following ones belong to other peers and are still sent
+			if (!IsDatagramError(m_socket.GetLastError()))
+				return false;
+
+			offset += sentCount + 1;
+		}
+
+		return true;
+	}
+
 	void ENetHost::SendUnreliableOutgoingCommands(ENetPeer* peer)
 	{
 		auto currentCommand = peer->m_outgoingUnreliableCommands.begin();
@@ -1204,10 +1336,10 @@ namespace Nz
 				m_packetSize += packetBuffer.dataLength;
 
 				// In order to keep the packet buffer alive until we send it, place it into a temporary queue
-				peer->m_sentUnreliableCommands.emplace_back(std::move(*outgoingCommand));
+				peer->m_sentUnreliableCommands.splice(peer->m_sentUnreliableCommands.end(), peer->m_outgoingUnreliableCommands, outgoingCommand);
 			}
-
-			peer->m_outgoingUnreliableCommands.erase(outgoingCommand);
+			else
+				peer->m_outgoingUnreliableCommands.erase(outgoingCommand);
 
 			++m_bufferCount;
 			++m_commandCount;
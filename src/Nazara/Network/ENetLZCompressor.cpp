@@ -0,0 +1,51 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetLZCompressor.hpp>
+#include <Nazara/Core/LZCodec.hpp>
+#include <algorithm>
+#include <cstring>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	ENetLZCompressor::ENetLZCompressor(std::size_t minimumInputSize) :
+	m_minimumInputSize(minimumInputSize)
+	{
+	}
+
+	std::size_t ENetLZCompressor::Compress(const ENetPeer* /*peer*/, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		// Small packets (acknowledgements, pings, ...) seldom hold repeated sequences
+		if (totalInputSize < m_minimumInputSize)
+			return 0;
+
+		// LZCodec works on contiguous data, gather the buffers first
+		m_inputBuffer.resize(totalInputSize);
+
+		std::size_t offset = 0;
+		for (std::size_t i = 0; i < bufferCount && offset < totalInputSize; ++i)
+		{
+			std::size_t size = std::min(buffers[i].dataLength, totalInputSize - offset);
+			std::memcpy(&m_inputBuffer[offset], buffers[i].data, size);
+
+			offset += size;
+		}
+
+		if (offset == 0)
+			return 0;
+
+		// Compressed data is only worth sending if it's smaller than the input
+		std::size_t compressedSize = LZCodec::Compress(m_inputBuffer.data(), offset, output, std::min(maxOutputSize, offset - 1));
+		if (compressedSize >= offset)
+			return 0;
+
+		return compressedSize;
+	}
+
+	std::size_t ENetLZCompressor::Decompress(const ENetPeer* /*peer*/, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		return LZCodec::Decompress(input, inputSize, output, maxOutputSize);
+	}
+}
@@ -20,6 +20,22 @@
 
 namespace Nz
 {
+	ENetPeer::ENetPeer(ENetHost* host, UInt16 peerId) :
+	m_host(host),
+	m_dispatchedCommands(host->m_commandPool),
+	m_outgoingReliableCommands(host->m_commandPool),
+	m_outgoingUnreliableCommands(host->m_commandPool),
+	m_sentReliableCommands(host->m_commandPool),
+	m_sentUnreliableCommands(host->m_commandPool),
+	m_state(ENetPeerState::Disconnected),
+	m_incomingSessionID(0xFF),
+	m_outgoingSessionID(0xFF),
+	m_incomingPeerID(peerId),
+	m_isSimulationEnabled(false)
+	{
+		Reset();
+	}
+
 	void ENetPeer::Disconnect(UInt32 data)
 	{
 		if (m_state == ENetPeerState::Disconnecting ||
@@ -322,8 +338,9 @@ namespace Nz
 			command.roundTripTimeout = m_roundTripTime + 4 * m_roundTripTimeVariance;
 			command.roundTripTimeoutLimit = m_timeoutLimit * command.roundTripTimeout;
 
-			m_outgoingReliableCommands.insert(insertPosition, std::move(command));
-			it = m_sentReliableCommands.erase(it);
+			auto nextCommand = std::next(it);
+			m_outgoingReliableCommands.splice(insertPosition, m_sentReliableCommands, it);
+			it = nextCommand;
 
 			if (it == m_sentReliableCommands.begin() && !m_sentReliableCommands.empty())
 			{
@@ -373,9 +390,9 @@ namespace Nz
 
 	void ENetPeer::DispatchIncomingUnreliableCommands(Channel& channel)
 	{
-		std::list<IncomingCommmand>::iterator currentCommand;
-		std::list<IncomingCommmand>::iterator droppedCommand;
-		std::list<IncomingCommmand>::iterator startCommand;
+		CommandList<IncomingCommmand>::iterator currentCommand;
+		CommandList<IncomingCommmand>::iterator droppedCommand;
+		CommandList<IncomingCommmand>::iterator startCommand;
 
 		for (droppedCommand = startCommand = currentCommand = channel.incomingUnreliableCommands.begin();
 		     currentCommand != channel.incomingUnreliableCommands.end();
@@ -879,7 +896,7 @@ namespace Nz
 		RemoveSentReliableCommand(1, 0xFF);
 
 		if (channelCount < m_channels.size())
-			m_channels.resize(channelCount);
+			m_channels.erase(m_channels.begin() + channelCount, m_channels.end());
 
 		m_outgoingPeerID = NetToHost(command->verifyConnect.outgoingPeerID);
 		m_incomingSessionID = command->verifyConnect.incomingSessionID;
@@ -900,7 +917,7 @@ namespace Nz
 
 	void ENetPeer::InitIncoming(std::size_t channelCount, const IpAddress& address, ENetProtocolConnect& incomingCommand)
 	{
-		m_channels.resize(channelCount);
+		m_channels.resize(channelCount, Channel(m_host->m_commandPool));
 		m_address = address;
 
 		m_connectID = incomingCommand.connectID;
@@ -941,7 +958,7 @@ namespace Nz
 
 	void ENetPeer::InitOutgoing(std::size_t channelCount, const IpAddress& address, UInt32 connectId, UInt32 windowSize)
 	{
-		m_channels.resize(channelCount);
+		m_channels.resize(channelCount, Channel(m_host->m_commandPool));
 
 		m_address = address;
 		m_connectID = connectId;
@@ -973,7 +990,7 @@ namespace Nz
 
 	ENetProtocolCommand ENetPeer::RemoveSentReliableCommand(UInt16 reliableSequenceNumber, UInt8 channelId)
 	{
-		std::list<OutgoingCommand>* commandList = nullptr;
+		CommandList<OutgoingCommand>* commandList = nullptr;
 
 		bool found = false;
 		auto currentCommand = m_sentReliableCommands.begin();
@@ -1130,8 +1147,8 @@ namespace Nz
 				return discardCommand();
 		}
 
-		std::list<IncomingCommmand>* commandList = nullptr;
-		std::list<IncomingCommmand>::reverse_iterator currentCommand;
+		CommandList<IncomingCommmand>* commandList = nullptr;
+		CommandList<IncomingCommmand>::reverse_iterator currentCommand;
 
 		switch (command.header.command & ENetProtocolCommand_Mask)
 		{
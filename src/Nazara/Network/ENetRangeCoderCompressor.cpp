@@ -0,0 +1,616 @@
+/*
+	Copyright(c) 2002 - 2016 Lee Salzman
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetRangeCoderCompressor.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		// Adaptation constants tuned aggressively for small packet sizes rather than large file compression
+		constexpr UInt32 RangeCoderTop = 1 << 24;
+		constexpr UInt32 RangeCoderBottom = 1 << 16;
+
+		constexpr UInt8 ContextSymbolDelta = 3;
+		constexpr UInt16 ContextSymbolMinimum = 1;
+		constexpr UInt16 ContextEscapeMinimum = 1;
+
+		constexpr std::size_t SubcontextOrder = 2;
+		constexpr UInt8 SubcontextSymbolDelta = 2;
+		constexpr UInt16 SubcontextEscapeDelta = 5;
+
+		// Only enough symbols for reasonable MTUs, would need to be larger for large file compression
+		constexpr std::size_t SymbolCount = 4096;
+
+		class RangeEncoder
+		{
+			public:
+				RangeEncoder(UInt8* output, std::size_t maxOutputSize) :
+				m_output(output),
+				m_outputEnd(output + maxOutputSize),
+				m_outputStart(output),
+				m_low(0),
+				m_range(~UInt32(0))
+				{
+				}
+
+				bool Encode(UInt32 under, UInt32 count, UInt32 total)
+				{
+					m_range /= total;
+					m_low += under * m_range;
+					m_range *= count;
+
+					for (;;)
+					{
+						if ((m_low ^ (m_low + m_range)) >= RangeCoderTop)
+						{
+							if (m_range >= RangeCoderBottom)
+								break;
+
+							m_range = (~m_low + 1) & (RangeCoderBottom - 1);
+						}
+
+						if (!Output(static_cast<UInt8>(m_low >> 24)))
+							return false;
+
+						m_range <<= 8;
+						m_low <<= 8;
+					}
+
+					return true;
+				}
+
+				bool Flush()
+				{
+					while (m_low)
+					{
+						if (!Output(static_cast<UInt8>(m_low >> 24)))
+							return false;
+
+						m_low <<= 8;
+					}
+
+					return true;
+				}
+
+				std::size_t GetOutputSize() const
+				{
+					return m_output - m_outputStart;
+				}
+
+			private:
+				bool Output(UInt8 value)
+				{
+					if (m_output >= m_outputEnd)
+						return false;
+
+					*m_output++ = value;
+					return true;
+				}
+
+				UInt8* m_output;
+				UInt8* m_outputEnd;
+				UInt8* m_outputStart;
+				UInt32 m_low;
+				UInt32 m_range;
+		};
+
+		class RangeDecoder
+		{
+			public:
+				RangeDecoder(const UInt8* input, std::size_t inputSize) :
+				m_input(input),
+				m_inputEnd(input + inputSize),
+				m_code(0),
+				m_low(0),
+				m_range(~UInt32(0))
+				{
+					for (unsigned int i = 0; i < 4; ++i)
+					{
+						if (m_input < m_inputEnd)
+							m_code |= UInt32(*m_input++) << (24 - i * 8);
+					}
+				}
+
+				void Decode(UInt32 under, UInt32 count)
+				{
+					m_low += under * m_range;
+					m_range *= count;
+
+					for (;;)
+					{
+						if ((m_low ^ (m_low + m_range)) >= RangeCoderTop)
+						{
+							if (m_range >= RangeCoderBottom)
+								break;
+
+							m_range = (~m_low + 1) & (RangeCoderBottom - 1);
+						}
+
+						m_code <<= 8;
+						if (m_input < m_inputEnd)
+							m_code |= *m_input++;
+
+						m_range <<= 8;
+						m_low <<= 8;
+					}
+				}
+
+				UInt16 Read(UInt32 total)
+				{
+					m_range /= total;
+
+					return static_cast<UInt16>((m_code - m_low) / m_range);
+				}
+
+			private:
+				const UInt8* m_input;
+				const UInt8* m_inputEnd;
+				UInt32 m_code;
+				UInt32 m_low;
+				UInt32 m_range;
+		};
+	}
+
+	ENetRangeCoderCompressor::ENetRangeCoderCompressor() :
+	m_nextSymbol(0),
+	m_symbols(SymbolCount)
+	{
+	}
+
+	std::size_t ENetRangeCoderCompressor::Compress(const ENetPeer* /*peer*/, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		if (bufferCount == 0 || totalInputSize == 0)
+			return 0;
+
+		RangeEncoder encoder(output, maxOutputSize);
+
+		const NetBuffer* buffersEnd = buffers + bufferCount;
+		const UInt8* inData = static_cast<const UInt8*>(buffers->data);
+		const UInt8* inEnd = inData + buffers->dataLength;
+		++buffers;
+
+		m_nextSymbol = 0;
+		Symbol* root = CreateContext(ContextEscapeMinimum, ContextSymbolMinimum);
+
+		UInt16 predicted = 0;
+		std::size_t order = 0;
+		for (;;)
+		{
+			if (inData >= inEnd)
+			{
+				if (buffers == buffersEnd)
+					break;
+
+				inData = static_cast<const UInt8*>(buffers->data);
+				inEnd = inData + buffers->dataLength;
+				++buffers;
+				continue;
+			}
+
+			UInt8 value = *inData++;
+			UInt16 count;
+			UInt16 under;
+			UInt16* parent = &predicted;
+
+			// Try the subcontexts from the highest order, escaping to the lower one while the value is unknown
+			Symbol* subcontext;
+			for (subcontext = &m_symbols[predicted]; subcontext != root; subcontext = &m_symbols[subcontext->parent])
+			{
+				Symbol* symbol = EncodeSymbol(subcontext, value, SubcontextSymbolDelta, 0, &under, &count);
+				*parent = static_cast<UInt16>(symbol - m_symbols.data());
+				parent = &symbol->parent;
+
+				UInt16 total = subcontext->total;
+				if (count > 0)
+				{
+					if (!encoder.Encode(subcontext->escapes + under, count, total))
+						return 0;
+				}
+				else
+				{
+					if (subcontext->escapes > 0 && subcontext->escapes < total)
+					{
+						if (!encoder.Encode(0, subcontext->escapes, total))
+							return 0;
+					}
+
+					subcontext->escapes += SubcontextEscapeDelta;
+					subcontext->total += SubcontextEscapeDelta;
+				}
+
+				subcontext->total += SubcontextSymbolDelta;
+				if (count > 0xFF - 2 * SubcontextSymbolDelta || subcontext->total > RangeCoderBottom - 0x100)
+					RescaleContext(subcontext, 0);
+
+				if (count > 0)
+					break;
+			}
+
+			if (subcontext == root)
+			{
+				Symbol* symbol = EncodeSymbol(root, value, ContextSymbolDelta, ContextSymbolMinimum, &under, &count);
+				*parent = static_cast<UInt16>(symbol - m_symbols.data());
+
+				if (!encoder.Encode(root->escapes + under, count, root->total))
+					return 0;
+
+				root->total += ContextSymbolDelta;
+				if (count > 0xFF - 2 * ContextSymbolDelta + ContextSymbolMinimum || root->total > RangeCoderBottom - 0x100)
+					RescaleContext(root, ContextSymbolMinimum);
+			}
+
+			if (order >= SubcontextOrder)
+				predicted = m_symbols[predicted].parent;
+			else
+				order++;
+
+			if (m_nextSymbol >= SymbolCount - SubcontextOrder)
+			{
+				// Out of symbols, start over with a new model
+				m_nextSymbol = 0;
+				root = CreateContext(ContextEscapeMinimum, ContextSymbolMinimum);
+				predicted = 0;
+				order = 0;
+			}
+		}
+
+		if (!encoder.Flush())
+			return 0;
+
+		return encoder.GetOutputSize();
+	}
+
+	std::size_t ENetRangeCoderCompressor::Decompress(const ENetPeer* /*peer*/, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		if (inputSize == 0)
+			return 0;
+
+		RangeDecoder decoder(input, inputSize);
+
+		UInt8* outData = output;
+		UInt8* outEnd = output + maxOutputSize;
+
+		m_nextSymbol = 0;
+		Symbol* root = CreateContext(ContextEscapeMinimum, ContextSymbolMinimum);
+
+		UInt16 predicted = 0;
+		std::size_t order = 0;
+		for (;;)
+		{
+			UInt8 value = 0;
+			UInt16 count;
+			UInt16 under;
+			UInt16* parent = &predicted;
+			Symbol* symbol = nullptr;
+
+			Symbol* subcontext;
+			for (subcontext = &m_symbols[predicted]; subcontext != root; subcontext = &m_symbols[subcontext->parent])
+			{
+				if (subcontext->escapes == 0)
+					continue;
+
+				UInt16 total = subcontext->total;
+				if (subcontext->escapes >= total)
+					continue;
+
+				UInt16 code = decoder.Read(total);
+				if (code < subcontext->escapes)
+				{
+					decoder.Decode(0, subcontext->escapes);
+					continue;
+				}
+
+				code -= subcontext->escapes;
+
+				symbol = DecodeSymbol(subcontext, code, SubcontextSymbolDelta, &value, &under, &count);
+				if (!symbol)
+					return 0; // Corrupted data
+
+				decoder.Decode(subcontext->escapes + under, count);
+
+				subcontext->total += SubcontextSymbolDelta;
+				if (count > 0xFF - 2 * SubcontextSymbolDelta || subcontext->total > RangeCoderBottom - 0x100)
+					RescaleContext(subcontext, 0);
+
+				break;
+			}
+
+			if (subcontext == root)
+			{
+				UInt16 code = decoder.Read(root->total);
+				if (code < root->escapes)
+				{
+					// An escape from the root context ends the stream
+					decoder.Decode(0, root->escapes);
+					break;
+				}
+
+				code -= root->escapes;
+
+				symbol = DecodeRootSymbol(root, code, ContextSymbolDelta, ContextSymbolMinimum, &value, &under, &count);
+				decoder.Decode(root->escapes + under, count);
+
+				root->total += ContextSymbolDelta;
+				if (count > 0xFF - 2 * ContextSymbolDelta + ContextSymbolMinimum || root->total > RangeCoderBottom - 0x100)
+					RescaleContext(root, ContextSymbolMinimum);
+			}
+
+			UInt16 bottom = static_cast<UInt16>(symbol - m_symbols.data());
+
+			// Update the subcontexts we escaped from the same way the encoder did
+			for (Symbol* patch = &m_symbols[predicted]; patch != subcontext; patch = &m_symbols[patch->parent])
+			{
+				Symbol* patchSymbol = EncodeSymbol(patch, value, SubcontextSymbolDelta, 0, &under, &count);
+				*parent = static_cast<UInt16>(patchSymbol - m_symbols.data());
+				parent = &patchSymbol->parent;
+
+				if (count == 0)
+				{
+					patch->escapes += SubcontextEscapeDelta;
+					patch->total += SubcontextEscapeDelta;
+				}
+
+				patch->total += SubcontextSymbolDelta;
+				if (count > 0xFF - 2 * SubcontextSymbolDelta || patch->total > RangeCoderBottom - 0x100)
+					RescaleContext(patch, 0);
+			}
+			*parent = bottom;
+
+			if (outData >= outEnd)
+				return 0;
+
+			*outData++ = value;
+
+			if (order >= SubcontextOrder)
+				predicted = m_symbols[predicted].parent;
+			else
+				order++;
+
+			if (m_nextSymbol >= SymbolCount - SubcontextOrder)
+			{
+				m_nextSymbol = 0;
+				root = CreateContext(ContextEscapeMinimum, ContextSymbolMinimum);
+				predicted = 0;
+				order = 0;
+			}
+		}
+
+		return outData - output;
+	}
+
+	auto ENetRangeCoderCompressor::CreateContext(UInt16 escapes, UInt16 minimum) -> Symbol*
+	{
+		Symbol* context = CreateSymbol(0, 0);
+		context->escapes = escapes;
+		context->total = escapes + 256 * minimum;
+		context->symbols = 0;
+
+		return context;
+	}
+
+	auto ENetRangeCoderCompressor::CreateSymbol(UInt8 value, UInt8 count) -> Symbol*
+	{
+		Symbol* symbol = &m_symbols[m_nextSymbol++];
+		symbol->value = value;
+		symbol->count = count;
+		symbol->under = count;
+		symbol->left = 0;
+		symbol->right = 0;
+		symbol->symbols = 0;
+		symbol->escapes = 0;
+		symbol->total = 0;
+		symbol->parent = 0;
+
+		return symbol;
+	}
+
+	auto ENetRangeCoderCompressor::DecodeRootSymbol(Symbol* context, UInt16 code, UInt8 update, UInt16 minimum, UInt8* value, UInt16* under, UInt16* count) -> Symbol*
+	{
+		// Every value has at least a frequency of minimum in the root context, unknown values get created on the fly
+		*under = 0;
+		*count = minimum;
+
+		if (!context->symbols)
+		{
+			*value = static_cast<UInt8>(code / minimum);
+			*under = code - code % minimum;
+
+			Symbol* symbol = CreateSymbol(*value, update);
+			context->symbols = static_cast<UInt16>(symbol - context);
+
+			return symbol;
+		}
+
+		Symbol* node = context + context->symbols;
+		for (;;)
+		{
+			UInt16 after = *under + node->under + (node->value + 1) * minimum;
+			UInt16 before = node->count + minimum;
+
+			if (code >= after)
+			{
+				*under += node->under;
+				if (node->right)
+				{
+					node += node->right;
+					continue;
+				}
+
+				*value = static_cast<UInt8>(node->value + 1 + (code - after) / minimum);
+				*under = code - (code - after) % minimum;
+
+				Symbol* symbol = CreateSymbol(*value, update);
+				node->right = static_cast<UInt16>(symbol - node);
+
+				return symbol;
+			}
+			else if (code < after - before)
+			{
+				node->under += update;
+				if (node->left)
+				{
+					node += node->left;
+					continue;
+				}
+
+				*value = static_cast<UInt8>(node->value - 1 - (after - before - code - 1) / minimum);
+				*under = code - (after - before - code - 1) % minimum;
+
+				Symbol* symbol = CreateSymbol(*value, update);
+				node->left = static_cast<UInt16>(symbol - node);
+
+				return symbol;
+			}
+			else
+			{
+				*value = node->value;
+				*count += node->count;
+				*under = after - before;
+				node->under += update;
+				node->count += update;
+
+				return node;
+			}
+		}
+	}
+
+	auto ENetRangeCoderCompressor::DecodeSymbol(Symbol* context, UInt16 code, UInt8 update, UInt8* value, UInt16* under, UInt16* count) -> Symbol*
+	{
+		// Subcontexts only know the values they've already seen
+		*under = 0;
+		*count = 0;
+
+		if (!context->symbols)
+			return nullptr;
+
+		Symbol* node = context + context->symbols;
+		for (;;)
+		{
+			UInt16 after = *under + node->under;
+			UInt16 before = node->count;
+
+			if (code >= after)
+			{
+				*under += node->under;
+				if (!node->right)
+					return nullptr;
+
+				node += node->right;
+			}
+			else if (code < after - before)
+			{
+				node->under += update;
+				if (!node->left)
+					return nullptr;
+
+				node += node->left;
+			}
+			else
+			{
+				*value = node->value;
+				*count += node->count;
+				*under = after - before;
+				node->under += update;
+				node->count += update;
+
+				return node;
+			}
+		}
+	}
+
+	auto ENetRangeCoderCompressor::EncodeSymbol(Symbol* context, UInt8 value, UInt8 update, UInt16 minimum, UInt16* under, UInt16* count) -> Symbol*
+	{
+		*under = value * minimum;
+		*count = minimum;
+
+		if (!context->symbols)
+		{
+			Symbol* symbol = CreateSymbol(value, update);
+			context->symbols = static_cast<UInt16>(symbol - context);
+
+			return symbol;
+		}
+
+		Symbol* node = context + context->symbols;
+		for (;;)
+		{
+			if (value < node->value)
+			{
+				node->under += update;
+				if (node->left)
+				{
+					node += node->left;
+					continue;
+				}
+
+				Symbol* symbol = CreateSymbol(value, update);
+				node->left = static_cast<UInt16>(symbol - node);
+
+				return symbol;
+			}
+			else if (value > node->value)
+			{
+				*under += node->under;
+				if (node->right)
+				{
+					node += node->right;
+					continue;
+				}
+
+				Symbol* symbol = CreateSymbol(value, update);
+				node->right = static_cast<UInt16>(symbol - node);
+
+				return symbol;
+			}
+			else
+			{
+				*count += node->count;
+				*under += node->under - node->count;
+				node->under += update;
+				node->count += update;
+
+				return node;
+			}
+		}
+	}
+
+	void ENetRangeCoderCompressor::RescaleContext(Symbol* context, UInt16 minimum)
+	{
+		context->total = (context->symbols) ? RescaleSymbol(context + context->symbols) : 0;
+		context->escapes -= context->escapes >> 1;
+		context->total += context->escapes + 256 * minimum;
+	}
+
+	UInt16 ENetRangeCoderCompressor::RescaleSymbol(Symbol* symbol)
+	{
+		UInt16 total = 0;
+		for (;;)
+		{
+			symbol->count -= symbol->count >> 1;
+			symbol->under = symbol->count;
+			if (symbol->left)
+				symbol->under += RescaleSymbol(symbol + symbol->left);
+
+			total += symbol->under;
+			if (!symbol->right)
+				break;
+
+			symbol += symbol->right;
+		}
+
+		return total;
+	}
+}
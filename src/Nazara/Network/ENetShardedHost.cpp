@@ -0,0 +1,331 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <limits>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup network
+	* \class Nz::ENetShardedHost
+	* \brief Network class that spreads the peers of an ENet server over several threads
+	*
+	* Each shard runs its own ENetHost in its own thread, with its own socket bound to the same port thanks to UdpSocket::EnableReusePort.
+	* The system dispatches incoming datagrams by source address, a peer always talks to the same shard.
+	*
+	* Shards hand their events to the application through a lock-free queue (see PollEvent),
+	* while Send, Disconnect and Broadcast queue commands the shards execute before servicing their host.
+	* Peers are identified by an ENetShardedPeer, which stays safe to use once they've disconnected.
+	*
+	* \remark Only one thread (the application one) may call the methods of this class
+	* \remark This requires SO_REUSEPORT support from the system (such as Linux)
+	*/
+
+	ENetShardedHost::ENetShardedHost() :
+	m_isRunning(false)
+	{
+	}
+
+	/*!
+	* \brief Sends a packet to every connected peer of every shard
+	*
+	* \param channelId Channel to send the packet on
+	* \param flags Flags of the packet
+	* \param packet Packet to send, copied for each shard
+	*/
+	void ENetShardedHost::Broadcast(UInt8 channelId, ENetPacketFlags flags, NetPacket&& packet)
+	{
+		for (std::size_t i = 0; i < m_shards.size(); ++i)
+		{
+			Command command;
+			command.type = CommandType::Broadcast;
+			command.channelId = channelId;
+			command.flags = flags;
+
+			if (i + 1 < m_shards.size())
+				command.packet.Reset(packet.GetNetCode(), packet.GetConstData() + NetPacket::HeaderSize, packet.GetDataSize());
+			else
+				command.packet = std::move(packet);
+
+			PushCommand(*m_shards[i], std::move(command));
+		}
+	}
+
+	/*!
+	* \brief Creates the shards and starts their threads
+	* \return true If every shard was successfully created
+	*
+	* \param listenAddress Address to listen on, if its port is zero the shards share the port the system picked for the first one
+	* \param shardCount Number of shards (and threads)
+	* \param peerCountPerShard Maximum number of peers per shard
+	* \param channelCount Maximum number of channels per peer
+	*/
+	bool ENetShardedHost::Create(const IpAddress& listenAddress, std::size_t shardCount, std::size_t peerCountPerShard, std::size_t channelCount)
+	{
+		return CreateShards(listenAddress, false, shardCount, peerCountPerShard, channelCount);
+	}
+
+	/*!
+	* \brief Stops the shard threads and destroys their hosts
+	*
+	* \remark Peers are not notified, disconnect them first for a graceful shutdown
+	*/
+	void ENetShardedHost::Destroy()
+	{
+		m_isRunning = false;
+		for (std::unique_ptr<Shard>& shard : m_shards)
+		{
+			if (shard->thread.IsJoinable())
+				shard->thread.Join();
+		}
+
+		m_shards.clear();
+		m_events.reset();
+		m_boundAddress = IpAddress::Invalid;
+	}
+
+	/*!
+	* \brief Requests the disconnection of a peer
+	*
+	* A Disconnect event will be received once the peer acknowledged it (or timed out)
+	*
+	* \param peer Peer to disconnect, nothing is done if it's no longer connected
+	* \param data Data sent to the peer with the disconnection
+	*
+	* \remark Produces a NazaraAssert if the peer shard index or id is invalid
+	*/
+	void ENetShardedHost::Disconnect(const ENetShardedPeer& peer, UInt32 data)
+	{
+		NazaraAssert(peer.shardIndex < m_shards.size(), "Invalid shard index");
+		NazaraAssert(peer.peerId < m_shards[peer.shardIndex]->peers.size(), "Invalid peer id");
+
+		Command command;
+		command.type = CommandType::Disconnect;
+		command.data = data;
+		command.peer = peer;
+
+		PushCommand(*m_shards[peer.shardIndex], std::move(command));
+	}
+
+	/*!
+	* \brief Gets the oldest event of the shards
+	* \return true If an event was retrieved
+	*
+	* \param event Pointer receiving the event
+	*
+	* \remark Events of a peer always come in order, but events of different shards may interleave
+	*/
+	bool ENetShardedHost::PollEvent(ENetShardedEvent* event)
+	{
+		NazaraAssert(event, "Invalid event");
+
+		if (!m_events)
+			return false;
+
+		return m_events->Pop(event);
+	}
+
+	/*!
+	* \brief Sends a packet to a peer
+	*
+	* \param peer Peer to send the packet to, nothing is done if it's no longer connected
+	* \param channelId Channel to send the packet on
+	* \param flags Flags of the packet
+	* \param packet Packet to send
+	*
+	* \remark Produces a NazaraAssert if the peer shard index or id is invalid
+	*/
+	void ENetShardedHost::Send(const ENetShardedPeer& peer, UInt8 channelId, ENetPacketFlags flags, NetPacket&& packet)
+	{
+		NazaraAssert(peer.shardIndex < m_shards.size(), "Invalid shard index");
+		NazaraAssert(peer.peerId < m_shards[peer.shardIndex]->peers.size(), "Invalid peer id");
+
+		Command command;
+		command.type = CommandType::Send;
+		command.channelId = channelId;
+		command.flags = flags;
+		command.packet = std::move(packet);
+		command.peer = peer;
+
+		PushCommand(*m_shards[peer.shardIndex], std::move(command));
+	}
+
+	bool ENetShardedHost::CreateShards(const IpAddress& listenAddress, bool dualStack, std::size_t shardCount, std::size_t peerCountPerShard, std::size_t channelCount)
+	{
+		NazaraAssert(listenAddress.IsValid() && !listenAddress.IsLoopback(), "Invalid listening address");
+		NazaraAssert(shardCount > 0 && shardCount <= std::numeric_limits<UInt16>::max(), "Invalid shard count");
+
+		Destroy();
+
+		m_events = std::make_unique<ConcurrentQueue<ENetShardedEvent>>(shardCount * ENetConstants::ENetShardedHost_EventQueueSize);
+
+		IpAddress address = listenAddress;
+		for (std::size_t i = 0; i < shardCount; ++i)
+		{
+			std::unique_ptr<Shard> shard = std::make_unique<Shard>();
+			shard->host.m_isReusingPort = true;
+			shard->host.m_isUsingDualStack = dualStack;
+			shard->index = static_cast<UInt16>(i);
+			shard->peers.resize(peerCountPerShard);
+
+			if (!shard->host.Create(address, peerCountPerShard, channelCount))
+			{
+				NazaraError("Failed to create shard #" + String::Number(i));
+
+				m_shards.clear();
+				m_events.reset();
+				return false;
+			}
+
+			// Other shards have to bind the very port the first one got
+			if (i == 0)
+				address = shard->host.m_socket.GetBoundAddress();
+
+			m_shards.emplace_back(std::move(shard));
+		}
+
+		m_boundAddress = address;
+
+		m_isRunning = true;
+		for (std::unique_ptr<Shard>& shard : m_shards)
+		{
+			Shard* shardPtr = shard.get();
+			shard->thread = Thread([this, shardPtr]()
+			{
+				RunShard(*shardPtr);
+			});
+		}
+
+		return true;
+	}
+
+	void ENetShardedHost::ExecuteCommands(Shard& shard)
+	{
+		Command command;
+		while (shard.commands.Pop(&command))
+		{
+			if (command.type == CommandType::Broadcast)
+			{
+				shard.host.Broadcast(command.channelId, command.flags, std::move(command.packet));
+				continue;
+			}
+
+			if (command.peer.peerId >= shard.peers.size())
+				continue;
+
+			// The peer may have disconnected (and its slot been reused) since the command was queued
+			PeerSlot& slot = shard.peers[command.peer.peerId];
+			if (!slot.isConnected || slot.connectId != command.peer.connectId)
+				continue;
+
+			ENetPeer& peer = shard.host.m_peers[command.peer.peerId];
+			switch (command.type)
+			{
+				case CommandType::Broadcast:
+					break;
+
+				case CommandType::Disconnect:
+					peer.Disconnect(command.data);
+					break;
+
+				case CommandType::Send:
+					peer.Send(command.channelId, command.flags, std::move(command.packet));
+					break;
+			}
+		}
+	}
+
+	void ENetShardedHost::FlushEvents(Shard& shard)
+	{
+		std::size_t eventIndex = 0;
+		for (; eventIndex < shard.pendingEvents.size(); ++eventIndex)
+		{
+			if (!m_events->Push(std::move(shard.pendingEvents[eventIndex])))
+				break;
+		}
+
+		shard.pendingEvents.erase(shard.pendingEvents.begin(), shard.pendingEvents.begin() + eventIndex);
+	}
+
+	void ENetShardedHost::PushCommand(Shard& shard, Command&& command)
+	{
+		// Shards empty their queue at every iteration, this only waits when the application outpaces them
+		while (!shard.commands.Push(std::move(command)))
+			Thread::Sleep(0);
+	}
+
+	void ENetShardedHost::QueueEvent(Shard& shard, ENetEvent& event)
+	{
+		UInt16 peerId = event.peer->GetPeerId();
+		PeerSlot& slot = shard.peers[peerId];
+
+		// Peers are reset before their disconnection event is returned, their connection is tracked by the slots
+		switch (event.type)
+		{
+			case ENetEventType::IncomingConnect:
+			case ENetEventType::OutgoingConnect:
+				slot.address = event.peer->GetAddress();
+				slot.connectId = event.peer->m_connectID;
+				slot.isConnected = true;
+				break;
+
+			case ENetEventType::Disconnect:
+				slot.isConnected = false;
+				break;
+
+			case ENetEventType::None:
+			case ENetEventType::Receive:
+				break;
+		}
+
+		ENetShardedEvent shardedEvent;
+		shardedEvent.type = event.type;
+		shardedEvent.address = slot.address;
+		shardedEvent.channelId = event.channelId;
+		shardedEvent.data = event.data;
+		shardedEvent.peer.connectId = slot.connectId;
+		shardedEvent.peer.peerId = peerId;
+		shardedEvent.peer.shardIndex = shard.index;
+
+		// ENet packets belong to the shard pool, only their content leaves the thread
+		if (event.packet)
+		{
+			shardedEvent.packet = std::move(event.packet->data);
+			event.packet.Reset();
+		}
+
+		// Keep the order of events when the queue was full
+		if (!shard.pendingEvents.empty() || !m_events->Push(std::move(shardedEvent)))
+			shard.pendingEvents.emplace_back(std::move(shardedEvent));
+	}
+
+	void ENetShardedHost::RunShard(Shard& shard)
+	{
+		ENetEvent event;
+		while (m_isRunning.load(std::memory_order_acquire))
+		{
+			ExecuteCommands(shard);
+
+			if (shard.host.Service(&event, ENetConstants::ENetShardedHost_ServiceTimeout) > 0)
+			{
+				do
+				{
+					QueueEvent(shard, event);
+				}
+				while (shard.host.CheckEvents(&event));
+			}
+
+			FlushEvents(shard);
+		}
+	}
+
+	ENetShardedHost::Shard::Shard() :
+	commands(ENetConstants::ENetShardedHost_CommandQueueSize)
+	{
+	}
+}
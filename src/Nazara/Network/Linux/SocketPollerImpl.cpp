@@ -28,6 +28,15 @@ namespace Nz
 		m_sockets.clear();
 	}
 
+	void SocketPollerImpl::GetReadySockets(std::vector<SocketHandle>* readyToRead, std::vector<SocketHandle>* readyToWrite) const
+	{
+		if (readyToRead)
+			readyToRead->assign(m_readyToReadSockets.begin(), m_readyToReadSockets.end());
+
+		if (readyToWrite)
+			readyToWrite->assign(m_readyToWriteSockets.begin(), m_readyToWriteSockets.end());
+	}
+
 	bool SocketPollerImpl::IsReadyToRead(SocketHandle socket) const
 	{
 		return m_readyToReadSockets.count(socket) != 0;
@@ -81,6 +90,30 @@ namespace Nz
 			NazaraWarning("An error occured while removing socket from epoll structure (errno " + String::Number(errno) + ": " + Error::GetLastSystemError() + ')');
 	}
 
+	bool SocketPollerImpl::UpdateSocket(SocketHandle socket, SocketPollEventFlags eventFlags)
+	{
+		NazaraAssert(IsRegistered(socket), "Socket is not registered");
+
+		epoll_event entry;
+		std::memset(&entry, 0, sizeof(epoll_event));
+
+		entry.data.fd = socket;
+
+		if (eventFlags & SocketPollEvent_Read)
+			entry.events |= EPOLLIN;
+
+		if (eventFlags & SocketPollEvent_Write)
+			entry.events |= EPOLLOUT;
+
+		if (epoll_ctl(m_handle, EPOLL_CTL_MOD, socket, &entry) != 0)
+		{
+			NazaraError("Failed to update socket in epoll structure (errno " + String::Number(errno) + ": " + Error::GetLastSystemError() + ')');
+			return false;
+		}
+
+		return true;
+	}
+
 	unsigned int SocketPollerImpl::Wait(int msTimeout, SocketError* error)
 	{
 		int activeSockets;
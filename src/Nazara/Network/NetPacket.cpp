@@ -3,16 +3,154 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Network/NetPacket.hpp>
-#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/ConcurrentQueue.hpp>
 #include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Math/Algorithm.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <limits>
 #include <Nazara/Network/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		struct BufferCache
+		{
+			std::atomic_flag lock = ATOMIC_FLAG_INIT;
+			std::atomic<UInt64> reuses;
+			std::array<std::size_t, NetPacket::BufferSizeClassCount> bufferCounts;
+			std::array<std::array<ByteArray*, NetPacket::BufferCacheSize>, NetPacket::BufferSizeClassCount> buffers;
+		};
+
+		struct BufferPool
+		{
+			std::atomic<UInt64> allocatedBuffers;
+			std::atomic<UInt64> freedBuffers;
+			std::atomic<UInt64> sharedReuses;
+			std::array<BufferCache, NetPacket::BufferCacheCount> caches;
+			std::array<std::unique_ptr<ConcurrentQueue<ByteArray*>>, NetPacket::BufferSizeClassCount> sharedBuffers;
+		};
+
+		std::unique_ptr<BufferPool> s_bufferPool;
+		std::atomic<unsigned int> s_nextBufferCacheIndex(0);
+		thread_local unsigned int s_bufferCacheIndex = std::numeric_limits<unsigned int>::max();
+
+		std::size_t GetSizeClassCapacity(std::size_t sizeClass)
+		{
+			return NetPacket::MinBufferSize << sizeClass;
+		}
+
+		std::size_t GetSizeClass(std::size_t capacity)
+		{
+			// Smallest class whose buffers can hold capacity bytes
+			if (capacity <= NetPacket::MinBufferSize)
+				return 0;
+			else if (capacity > GetSizeClassCapacity(NetPacket::BufferSizeClassCount - 1))
+				return NetPacket::BufferSizeClassCount;
+
+			return IntegralLog2(static_cast<UInt32>(capacity - 1)) + 1 - IntegralLog2Pot(NetPacket::MinBufferSize);
+		}
+
+		BufferCache& GetBufferCache()
+		{
+			if (s_bufferCacheIndex == std::numeric_limits<unsigned int>::max())
+				s_bufferCacheIndex = s_nextBufferCacheIndex++;
+
+			return s_bufferPool->caches[s_bufferCacheIndex % NetPacket::BufferCacheCount];
+		}
+
+		std::unique_ptr<ByteArray> AcquireBuffer(std::size_t minCapacity)
+		{
+			std::size_t sizeClass = GetSizeClass(minCapacity);
+			if (s_bufferPool && sizeClass < NetPacket::BufferSizeClassCount)
+			{
+				BufferCache& cache = GetBufferCache();
+				if (!cache.lock.test_and_set(std::memory_order_acquire))
+				{
+					ByteArray* buffer = nullptr;
+
+					std::size_t& bufferCount = cache.bufferCounts[sizeClass];
+					if (bufferCount > 0)
+					{
+						buffer = cache.buffers[sizeClass][--bufferCount];
+						cache.reuses.store(cache.reuses.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+					}
+
+					cache.lock.clear(std::memory_order_release);
+
+					if (buffer)
+						return std::unique_ptr<ByteArray>(buffer);
+				}
+
+				// The cache is empty or used by another thread, fallback to the shared pool
+				ByteArray* buffer;
+				if (s_bufferPool->sharedBuffers[sizeClass]->Pop(&buffer))
+				{
+					s_bufferPool->sharedReuses.fetch_add(1, std::memory_order_relaxed);
+					return std::unique_ptr<ByteArray>(buffer);
+				}
+
+				s_bufferPool->allocatedBuffers.fetch_add(1, std::memory_order_relaxed);
+
+				// Allocate the whole class capacity, so the buffer comes back to the same class
+				std::unique_ptr<ByteArray> newBuffer = std::make_unique<ByteArray>();
+				newBuffer->Reserve(GetSizeClassCapacity(sizeClass));
+
+				return newBuffer;
+			}
+
+			if (s_bufferPool)
+				s_bufferPool->allocatedBuffers.fetch_add(1, std::memory_order_relaxed);
+
+			return std::make_unique<ByteArray>();
+		}
+
+		void ReleaseBuffer(std::unique_ptr<ByteArray> buffer)
+		{
+			if (!s_bufferPool)
+				return;
+
+			// Buffers may have grown since their allocation, keep them in the biggest class they can serve
+			std::size_t capacity = buffer->GetCapacity();
+			if (capacity < NetPacket::MinBufferSize || capacity >= GetSizeClassCapacity(NetPacket::BufferSizeClassCount))
+			{
+				s_bufferPool->freedBuffers.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			std::size_t sizeClass = IntegralLog2(static_cast<UInt32>(capacity)) - IntegralLog2Pot(NetPacket::MinBufferSize);
+
+			BufferCache& cache = GetBufferCache();
+			if (!cache.lock.test_and_set(std::memory_order_acquire))
+			{
+				std::size_t& bufferCount = cache.bufferCounts[sizeClass];
+				bool cached = (bufferCount < NetPacket::BufferCacheSize);
+				if (cached)
+					cache.buffers[sizeClass][bufferCount++] = buffer.release();
+
+				cache.lock.clear(std::memory_order_release);
+
+				if (cached)
+					return;
+			}
+
+			ByteArray* bufferPtr = buffer.get();
+			if (s_bufferPool->sharedBuffers[sizeClass]->Push(std::move(bufferPtr)))
+				buffer.release();
+			else
+				s_bufferPool->freedBuffers.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
 	/*!
 	* \ingroup network
 	* \class Nz::NetPacket
 	* \brief Network class that represents a packet
+	*
+	* Packet buffers are recycled by size classes (powers of two from MinBufferSize), through small per-thread caches
+	* (shared between a few threads if there are more than BufferCacheCount of them) backed by a lock-free shared pool.
 	*/
 
 	/*!
@@ -93,6 +231,29 @@ namespace Nz
 		return Serialize(context, packetSize) && Serialize(context, netCode);
 	}
 
+	/*!
+	* \brief Gets the statistics of packet buffer recycling
+	* \return Counters accumulated since the initialization of the Network module
+	*
+	* \remark Counters are updated by multiple threads, they may be slightly out of date
+	*/
+
+	NetPacket::BufferStats NetPacket::GetBufferStats()
+	{
+		BufferStats stats = {};
+		if (!s_bufferPool)
+			return stats;
+
+		stats.allocatedBuffers = s_bufferPool->allocatedBuffers.load(std::memory_order_relaxed);
+		stats.freedBuffers = s_bufferPool->freedBuffers.load(std::memory_order_relaxed);
+		stats.sharedReuses = s_bufferPool->sharedReuses.load(std::memory_order_relaxed);
+
+		for (const BufferCache& cache : s_bufferPool->caches)
+			stats.cachedReuses += cache.reuses.load(std::memory_order_relaxed);
+
+		return stats;
+	}
+
 	/*!
 	* \brief Operation to do when stream is empty
 	*/
@@ -111,10 +272,7 @@ namespace Nz
 		if (!m_buffer)
 			return;
 
-		std::size_t size = m_buffer->GetSize();
-
-		Nz::LockGuard lock(*s_availableBuffersMutex);
-		s_availableBuffers.emplace_back(std::make_pair(size, std::move(m_buffer)));
+		ReleaseBuffer(std::move(m_buffer));
 	}
 
 	/*!
@@ -131,21 +289,9 @@ namespace Nz
 	{
 		NazaraAssert(minCapacity >= cursorPos, "Cannot init stream with a smaller capacity than wanted cursor pos");
 
-		{
-			Nz::LockGuard lock(*s_availableBuffersMutex);
-
-			FreeStream(); //< In case it wasn't released yet
-
-			if (!s_availableBuffers.empty())
-			{
-				m_buffer = std::move(s_availableBuffers.back().second);
-				s_availableBuffers.pop_back();
-			}
-		}
-
-		if (!m_buffer)
-			m_buffer = std::make_unique<ByteArray>();
+		FreeStream(); //< In case it wasn't released yet
 
+		m_buffer = AcquireBuffer(minCapacity);
 		m_buffer->Resize(minCapacity);
 
 		m_memoryStream.SetBuffer(m_buffer.get(), openMode);
@@ -160,20 +306,55 @@ namespace Nz
 
 	bool NetPacket::Initialize()
 	{
-		s_availableBuffersMutex = std::make_unique<Mutex>();
+		s_bufferPool = std::make_unique<BufferPool>();
+		s_bufferPool->allocatedBuffers = 0;
+		s_bufferPool->freedBuffers = 0;
+		s_bufferPool->sharedReuses = 0;
+
+		for (BufferCache& cache : s_bufferPool->caches)
+		{
+			cache.bufferCounts.fill(0);
+			cache.reuses = 0;
+		}
+
+		// Keep about one megabyte of small buffers in the shared pool, and a few of the biggest ones
+		for (std::size_t i = 0; i < BufferSizeClassCount; ++i)
+			s_bufferPool->sharedBuffers[i] = std::make_unique<ConcurrentQueue<ByteArray*>>(std::max<std::size_t>((1 << 20) / GetSizeClassCapacity(i), 32));
+
 		return true;
 	}
 
 	/*!
 	* \brief Uninitializes the NetPacket class
+	*
+	* \remark Packets still alive at this point will free their buffer instead of recycling it
 	*/
 
 	void NetPacket::Uninitialize()
 	{
-		s_availableBuffers.clear();
-		s_availableBuffersMutex.reset();
+		std::unique_ptr<BufferPool> bufferPool = std::move(s_bufferPool);
+		if (!bufferPool)
+			return;
+
+		for (BufferCache& cache : bufferPool->caches)
+		{
+			for (std::size_t i = 0; i < BufferSizeClassCount; ++i)
+			{
+				for (std::size_t j = 0; j < cache.bufferCounts[i]; ++j)
+					delete cache.buffers[i][j];
+			}
+		}
+
+		for (auto& sharedBuffers : bufferPool->sharedBuffers)
+		{
+			ByteArray* buffer;
+			while (sharedBuffers->Pop(&buffer))
+				delete buffer;
+		}
 	}
 
-	std::unique_ptr<Mutex> NetPacket::s_availableBuffersMutex;
-	std::vector<std::pair<std::size_t, std::unique_ptr<ByteArray>>> NetPacket::s_availableBuffers;
+	constexpr std::size_t NetPacket::BufferCacheCount;
+	constexpr std::size_t NetPacket::BufferCacheSize;
+	constexpr std::size_t NetPacket::BufferSizeClassCount;
+	constexpr std::size_t NetPacket::MinBufferSize;
 }
@@ -6,6 +6,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/StackArray.hpp>
 #include <Nazara/Network/NetBuffer.hpp>
+#include <Nazara/Network/UdpDatagram.hpp>
 #include <Nazara/Network/Posix/IpAddressImpl.hpp>
 #include <netinet/tcp.h>
 #include <sys/ioctl.h>
@@ -13,13 +14,35 @@
 #include <sys/uio.h>
 #include <poll.h>
 #include <unistd.h>
+#include <algorithm>
 #include <cstring>
+#include <limits>
 #include <Nazara/Network/Debug.hpp>
 
 namespace Nz
 {
 	constexpr int SOCKET_ERROR = -1;
 
+	namespace
+	{
+		#ifdef NAZARA_PLATFORM_LINUX
+		// recvmmsg and sendmmsg handle a whole batch of datagrams in one system call
+		using DatagramHeader = mmsghdr;
+
+		msghdr& GetMessageHeader(mmsghdr& header)
+		{
+			return header.msg_hdr;
+		}
+		#else
+		using DatagramHeader = msghdr;
+
+		msghdr& GetMessageHeader(msghdr& header)
+		{
+			return header;
+		}
+		#endif
+	}
+
 	SocketHandle SocketImpl::Accept(SocketHandle handle, IpAddress* address, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
@@ -412,15 +435,15 @@ namespace Nz
 	SocketState SocketImpl::PollConnection(SocketHandle handle, const IpAddress& address, UInt64 msTimeout, SocketError* error)
 	{
 		// http://developerweb.net/viewtopic.php?id=3196
-		fd_set localSet;
-		FD_ZERO(&localSet);
-		FD_SET(handle, &localSet);
+		// poll is used instead of select, which can't handle descriptors over FD_SETSIZE
+		pollfd descriptor;
+		descriptor.fd = handle;
+		descriptor.events = POLLOUT;
+		descriptor.revents = 0;
 
-		timeval tv;
-		tv.tv_sec = static_cast<long>(msTimeout / 1000ULL);
-		tv.tv_usec = static_cast<long>((msTimeout % 1000ULL) * 1000ULL);
+		int timeout = (msTimeout != std::numeric_limits<UInt64>::max()) ? static_cast<int>(std::min<UInt64>(msTimeout, std::numeric_limits<int>::max())) : -1;
 
-		int ret = ::select(0, nullptr, &localSet, &localSet, (msTimeout != std::numeric_limits<UInt64>::max()) ? &tv : nullptr);
+		int ret = ::poll(&descriptor, 1, timeout);
 		if (ret > 0)
 		{
 			int code = GetLastErrorCode(handle, error);
@@ -508,6 +531,96 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::ReceiveDatagrams(SocketHandle handle, UdpDatagram* datagrams, std::size_t datagramCount, std::size_t* received, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		std::size_t bufferCount = 0;
+		for (std::size_t i = 0; i < datagramCount; ++i)
+			bufferCount += datagrams[i].bufferCount;
+
+		StackArray<iovec> sysBuffers = NazaraStackArray(iovec, bufferCount);
+		StackArray<IpAddressImpl::SockAddrBuffer> nameBuffers = NazaraStackArray(IpAddressImpl::SockAddrBuffer, datagramCount);
+		StackArray<DatagramHeader> datagramHeaders = NazaraStackArray(DatagramHeader, datagramCount);
+
+		iovec* sysBuffer = sysBuffers.data();
+		for (std::size_t i = 0; i < datagramCount; ++i)
+		{
+			const UdpDatagram& datagram = datagrams[i];
+			for (std::size_t j = 0; j < datagram.bufferCount; ++j)
+			{
+				sysBuffer[j].iov_base = datagram.buffers[j].data;
+				sysBuffer[j].iov_len = datagram.buffers[j].dataLength;
+			}
+
+			msghdr& msgHdr = GetMessageHeader(datagramHeaders[i]);
+			msgHdr.msg_iov = sysBuffer;
+			msgHdr.msg_iovlen = static_cast<int>(datagram.bufferCount);
+			msgHdr.msg_name = nameBuffers[i].data();
+			msgHdr.msg_namelen = static_cast<socklen_t>(nameBuffers[i].size());
+
+			sysBuffer += datagram.bufferCount;
+		}
+
+		std::size_t datagramRead = 0;
+
+		#ifdef NAZARA_PLATFORM_LINUX
+		// Only wait for the first datagram, the others are received if they are already there
+		int result = recvmmsg(handle, datagramHeaders.data(), static_cast<unsigned int>(datagramCount), MSG_WAITFORONE, nullptr);
+		if (result == -1)
+		{
+			int errorCode = GetLastErrorCode();
+			if (errorCode != EAGAIN && errorCode != EWOULDBLOCK)
+			{
+				if (error)
+					*error = TranslateErrnoToSocketError(errorCode);
+
+				return false; //< Error
+			}
+
+			// If we have no data and are not blocking, return true with no datagram read
+			result = 0;
+		}
+
+		for (; datagramRead < static_cast<std::size_t>(result); ++datagramRead)
+		{
+			UdpDatagram& datagram = datagrams[datagramRead];
+			datagram.address = IpAddressImpl::FromSockAddr(reinterpret_cast<const sockaddr*>(nameBuffers[datagramRead].data()));
+			datagram.dataLength = datagramHeaders[datagramRead].msg_len;
+		}
+		#else
+		for (; datagramRead < datagramCount; ++datagramRead)
+		{
+			// Only wait for the first datagram, the others are received if they are already there
+			int byteRead = recvmsg(handle, &datagramHeaders[datagramRead], (datagramRead > 0) ? MSG_DONTWAIT : 0);
+			if (byteRead == -1)
+			{
+				int errorCode = GetLastErrorCode();
+				if (errorCode == EAGAIN || errorCode == EWOULDBLOCK)
+					break;
+
+				if (error)
+					*error = TranslateErrnoToSocketError(errorCode);
+
+				return false; //< Error
+			}
+
+			UdpDatagram& datagram = datagrams[datagramRead];
+			datagram.address = IpAddressImpl::FromSockAddr(reinterpret_cast<const sockaddr*>(nameBuffers[datagramRead].data()));
+			datagram.dataLength = byteRead;
+		}
+		#endif
+
+		if (received)
+			*received = datagramRead;
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+	}
+
 	bool SocketImpl::ReceiveFrom(SocketHandle handle, void* buffer, int length, IpAddress* from, int* read, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
@@ -692,6 +805,75 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SendDatagrams(SocketHandle handle, const UdpDatagram* datagrams, std::size_t datagramCount, std::size_t* sent, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		std::size_t bufferCount = 0;
+		for (std::size_t i = 0; i < datagramCount; ++i)
+			bufferCount += datagrams[i].bufferCount;
+
+		StackArray<iovec> sysBuffers = NazaraStackArray(iovec, bufferCount);
+		StackArray<IpAddressImpl::SockAddrBuffer> nameBuffers = NazaraStackArray(IpAddressImpl::SockAddrBuffer, datagramCount);
+		StackArray<DatagramHeader> datagramHeaders = NazaraStackArray(DatagramHeader, datagramCount);
+
+		iovec* sysBuffer = sysBuffers.data();
+		for (std::size_t i = 0; i < datagramCount; ++i)
+		{
+			const UdpDatagram& datagram = datagrams[i];
+			for (std::size_t j = 0; j < datagram.bufferCount; ++j)
+			{
+				sysBuffer[j].iov_base = datagram.buffers[j].data;
+				sysBuffer[j].iov_len = datagram.buffers[j].dataLength;
+			}
+
+			msghdr& msgHdr = GetMessageHeader(datagramHeaders[i]);
+			msgHdr.msg_iov = sysBuffer;
+			msgHdr.msg_iovlen = static_cast<int>(datagram.bufferCount);
+			msgHdr.msg_name = nameBuffers[i].data();
+			msgHdr.msg_namelen = IpAddressImpl::ToSockAddr(datagram.address, nameBuffers[i].data());
+
+			sysBuffer += datagram.bufferCount;
+		}
+
+		std::size_t datagramSent = 0;
+		while (datagramSent < datagramCount)
+		{
+			#ifdef NAZARA_PLATFORM_LINUX
+			// sendmmsg may send less datagrams than asked (the kernel limits them to UIO_MAXIOV per call)
+			int result = sendmmsg(handle, &datagramHeaders[datagramSent], static_cast<unsigned int>(datagramCount - datagramSent), MSG_NOSIGNAL);
+			#else
+			int result = (sendmsg(handle, &datagramHeaders[datagramSent], MSG_NOSIGNAL) == SOCKET_ERROR) ? SOCKET_ERROR : 1;
+			#endif
+
+			if (result == SOCKET_ERROR)
+			{
+				int errorCode = GetLastErrorCode();
+				if (errorCode == EAGAIN || errorCode == EWOULDBLOCK)
+					break;
+
+				if (sent)
+					*sent = datagramSent;
+
+				if (error)
+					*error = TranslateErrnoToSocketError(errorCode);
+
+				return false; //< Error
+			}
+
+			datagramSent += result;
+		}
+
+		if (sent)
+			*sent = datagramSent;
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+	}
+
 	bool SocketImpl::SendMultiple(SocketHandle handle, const NetBuffer* buffers, std::size_t bufferCount, const IpAddress& to, int* sent, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
@@ -918,6 +1100,34 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SetReusePort(SocketHandle handle, bool reusePort, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+
+#ifdef SO_REUSEPORT
+		int option = reusePort ? 1 : 0;
+		if (setsockopt(handle, SOL_SOCKET, SO_REUSEPORT, &option, sizeof(option)) == SOCKET_ERROR)
+		{
+			if (error)
+				*error = TranslateErrnoToSocketError(GetLastErrorCode());
+
+			return false; //< Error
+		}
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+#else
+		NazaraUnused(reusePort);
+
+		if (error)
+			*error = SocketError_NotSupported;
+
+		return false;
+#endif
+	}
+
 	bool SocketImpl::SetSendBufferSize(SocketHandle handle, std::size_t size, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
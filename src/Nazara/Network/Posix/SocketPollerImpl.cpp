@@ -16,6 +16,15 @@ namespace Nz
 		m_sockets.clear();
 	}
 
+	void SocketPollerImpl::GetReadySockets(std::vector<SocketHandle>* readyToRead, std::vector<SocketHandle>* readyToWrite) const
+	{
+		if (readyToRead)
+			readyToRead->assign(m_readyToReadSockets.begin(), m_readyToReadSockets.end());
+
+		if (readyToWrite)
+			readyToWrite->assign(m_readyToWriteSockets.begin(), m_readyToWriteSockets.end());
+	}
+
 	bool SocketPollerImpl::IsReadyToRead(SocketHandle socket) const
 	{
 		return m_readyToReadSockets.count(socket) != 0;
@@ -76,6 +85,22 @@ namespace Nz
 		m_readyToWriteSockets.erase(socket);
 	}
 
+	bool SocketPollerImpl::UpdateSocket(SocketHandle socket, SocketPollEventFlags eventFlags)
+	{
+		NazaraAssert(IsRegistered(socket), "Socket is not registered");
+
+		PollSocket& entry = m_sockets[m_allSockets[socket]];
+		entry.events = 0;
+
+		if (eventFlags & SocketPollEvent_Read)
+			entry.events |= POLLRDNORM;
+
+		if (eventFlags & SocketPollEvent_Write)
+			entry.events |= POLLWRNORM;
+
+		return true;
+	}
+
 	unsigned int SocketPollerImpl::Wait(int msTimeout, SocketError* error)
 	{
 		unsigned int activeSockets;
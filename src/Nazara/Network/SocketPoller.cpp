@@ -55,6 +55,26 @@ namespace Nz
 		m_impl->Clear();
 	}
 
+	/*!
+	* \brief Retrieves the sockets reported ready by the last Wait operation
+	*
+	* This function allows you to handle the sockets ready to read or to write without checking every registered socket,
+	* which matters when a lot of sockets are registered in the SocketPoller.
+	*
+	* \param readyToRead If valid, this vector will be filled with the native handles of the sockets ready to read
+	* \param readyToWrite If valid, this vector will be filled with the native handles of the sockets ready to write
+	*
+	* \remark Handles are reported in no particular order
+	*
+	* \see IsReadyToRead
+	* \see IsReadyToWrite
+	* \see Wait
+	*/
+	void SocketPoller::GetReadySockets(std::vector<SocketHandle>* readyToRead, std::vector<SocketHandle>* readyToWrite) const
+	{
+		m_impl->GetReadySockets(readyToRead, readyToWrite);
+	}
+
 	/*!
 	* \brief Checks if a specific socket is ready to read data
 	*
@@ -165,6 +185,25 @@ namespace Nz
 		return m_impl->UnregisterSocket(socket.GetNativeHandle());
 	}
 
+	/*!
+	* \brief Updates the events watched for a registered socket
+	*
+	* This allows for example to watch the write state of a socket only while it has data waiting to be sent.
+	*
+	* \param socket Reference to the socket to update
+	* \param eventFlags Socket events to watch
+	*
+	* \return True if the socket has been updated, false otherwise
+	*
+	* \see RegisterSocket
+	*/
+	bool SocketPoller::UpdateSocket(AbstractSocket& socket, SocketPollEventFlags eventFlags)
+	{
+		NazaraAssert(IsRegistered(socket), "This socket is not registered in this SocketPoller");
+
+		return m_impl->UpdateSocket(socket.GetNativeHandle(), eventFlags);
+	}
+
 	/*!
 	* \brief Wait until any registered socket switches to a ready state.
 	*
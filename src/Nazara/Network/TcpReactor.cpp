@@ -0,0 +1,562 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/TcpReactor.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <cstring>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		void CopyFromRing(const UInt8* ring, std::size_t ringSize, std::size_t begin, void* destination, std::size_t size)
+		{
+			std::size_t firstPart = std::min(size, ringSize - begin);
+			std::memcpy(destination, &ring[begin], firstPart);
+			std::memcpy(static_cast<UInt8*>(destination) + firstPart, ring, size - firstPart);
+		}
+	}
+
+	/*!
+	* \ingroup network
+	* \class Nz::TcpReactor
+	* \brief Network class handling a lot of TCP connections from a single thread
+	*
+	* The reactor waits on every connection at once using a SocketPoller, accepts incoming clients when listening
+	* and calls OnPacketReceived for each complete NetPacket, the same packets TcpClient::SendPacket sends.
+	*
+	* Readable sockets are drained into a ring buffer of each connection, out of which packets are extracted,
+	* packets bigger than this buffer being received in place.
+	* Sent packets are queued and flushed at once with TcpClient::SendMultiple at the end of each Update (or when Flush is called),
+	* a connection whose socket buffer is full being watched for write readiness until its queue is empty.
+	*
+	* Connection identifiers are reused once their connection has been closed.
+	*
+	* \remark This class is not thread-safe
+	*/
+
+	/*!
+	* \brief Constructs a TcpReactor object
+	*
+	* \param receiveBufferSize Size of the ring buffer of each connection, packets bigger than this are received without it
+	* \param maxPacketSize Maximum size of a received packet (header included), a connection sending a bigger packet is closed
+	*
+	* \remark Produces a NazaraAssert if receiveBufferSize or maxPacketSize are smaller than NetPacket::HeaderSize
+	*/
+
+	TcpReactor::TcpReactor(std::size_t receiveBufferSize, std::size_t maxPacketSize) :
+	m_maxPacketSize(maxPacketSize),
+	m_receiveBufferSize(receiveBufferSize),
+	m_isUpdating(false)
+	{
+		NazaraAssert(receiveBufferSize >= NetPacket::HeaderSize, "Receive buffer must be able to hold a packet header");
+		NazaraAssert(maxPacketSize >= NetPacket::HeaderSize, "Max packet size must be able to hold a packet header");
+	}
+
+	/*!
+	* \brief Destructs the reactor, closing every connection
+	*/
+
+	TcpReactor::~TcpReactor()
+	{
+		Close();
+	}
+
+	/*!
+	* \brief Adds a connected client to the reactor
+	* \return Identifier of the connection, or InvalidConnection if the client could not be added
+	*
+	* \param client Connected client, which will be made non-blocking
+	*
+	* \remark Produces a NazaraAssert if the client is not connected
+	*/
+
+	std::size_t TcpReactor::AddClient(TcpClient&& client)
+	{
+		NazaraAssert(client.GetState() == SocketState_Connected, "Client must be connected");
+
+		return AddConnection(std::move(client));
+	}
+
+	/*!
+	* \brief Closes every connection and stops listening
+	*
+	* \remark OnDisconnected is not called for these connections
+	*/
+
+	void TcpReactor::Close()
+	{
+		for (std::size_t connectionId = 0; connectionId < m_connections.size(); ++connectionId)
+			Disconnect(connectionId);
+
+		if (m_poller.IsRegistered(m_server))
+			m_poller.UnregisterSocket(m_server);
+
+		m_server.Close();
+		m_flushQueue.clear();
+	}
+
+	/*!
+	* \brief Closes a connection
+	*
+	* Packets not sent yet are discarded and OnDisconnected is not called for this connection
+	*
+	* \param connectionId Identifier of the connection
+	*
+	* \remark Produces a NazaraAssert if the connection identifier is invalid
+	*/
+
+	void TcpReactor::Disconnect(std::size_t connectionId)
+	{
+		NazaraAssert(connectionId < m_connections.size(), "Invalid connection identifier");
+
+		Connection& connection = *m_connections[connectionId];
+		if (!connection.isConnected)
+			return;
+
+		m_connectionByHandle.erase(connection.client.GetNativeHandle());
+		m_poller.UnregisterSocket(connection.client);
+		connection.client.Close();
+
+		connection.isConnected = false;
+		connection.isReceivingLargePacket = false;
+		connection.largePacket.Reset();
+		connection.outgoingPackets.clear();
+
+		// Callbacks may still be running for this connection, don't reuse it before the end of the update
+		if (m_isUpdating)
+			m_releasedConnections.push_back(connectionId);
+		else
+			m_freeConnections.push_back(connectionId);
+	}
+
+	/*!
+	* \brief Sends every queued packet as far as socket buffers allow it
+	*
+	* This is done by Update, calling this is only useful to send packets before the next update
+	*/
+
+	void TcpReactor::Flush()
+	{
+		// Connections may be queued while flushing (by OnDisconnected callbacks), don't use iterators
+		for (std::size_t i = 0; i < m_flushQueue.size(); ++i)
+		{
+			std::size_t connectionId = m_flushQueue[i];
+
+			Connection& connection = *m_connections[connectionId];
+			if (!connection.isFlushQueued)
+				continue;
+
+			connection.isFlushQueued = false;
+
+			// Connections waiting for write readiness are flushed when their socket becomes writable
+			if (connection.isConnected && !connection.isWaitingForWrite)
+				FlushConnection(connectionId);
+		}
+		m_flushQueue.clear();
+	}
+
+	/*!
+	* \brief Listens for incoming connections
+	* \return State of the listening socket, SocketState_Bound if successful
+	*
+	* Accepted connections are reported by OnConnected
+	*
+	* \param address Address to listen to
+	* \param queueSize Size of the pending connections queue
+	*
+	* \remark Produces a NazaraAssert if address is invalid or if the reactor is already listening
+	*/
+
+	SocketState TcpReactor::Listen(const IpAddress& address, unsigned int queueSize)
+	{
+		NazaraAssert(address.IsValid(), "Invalid address");
+		NazaraAssert(!m_poller.IsRegistered(m_server), "Reactor is already listening");
+
+		m_server.EnableBlocking(false);
+
+		SocketState state = m_server.Listen(address, queueSize);
+		if (state != SocketState_Bound)
+			return state;
+
+		if (!m_poller.RegisterSocket(m_server, SocketPollEvent_Read))
+		{
+			NazaraError("Failed to register listening socket");
+			m_server.Close();
+			return SocketState_NotConnected;
+		}
+
+		return state;
+	}
+
+	/*!
+	* \brief Queues a copy of a packet to be sent to a connection
+	* \return true If the packet has been queued
+	*
+	* \param connectionId Identifier of the connection
+	* \param packet Packet to send
+	*
+	* \remark Produces a NazaraAssert if the connection identifier is invalid
+	*/
+
+	bool TcpReactor::Send(std::size_t connectionId, const NetPacket& packet)
+	{
+		NazaraAssert(connectionId < m_connections.size(), "Invalid connection identifier");
+
+		if (!m_connections[connectionId]->isConnected)
+			return false;
+
+		return Send(connectionId, NetPacket(packet.GetNetCode(), packet.GetConstData() + NetPacket::HeaderSize, packet.GetDataSize()));
+	}
+
+	/*!
+	* \brief Queues a packet to be sent to a connection
+	* \return true If the packet has been queued
+	*
+	* \param connectionId Identifier of the connection
+	* \param packet Packet to send, which is kept by the reactor until sent
+	*
+	* \remark Produces a NazaraAssert if the connection identifier is invalid
+	* \remark Produces a NazaraError if the packet header could not be encoded
+	*/
+
+	bool TcpReactor::Send(std::size_t connectionId, NetPacket&& packet)
+	{
+		NazaraAssert(connectionId < m_connections.size(), "Invalid connection identifier");
+
+		Connection& connection = *m_connections[connectionId];
+		if (!connection.isConnected)
+			return false;
+
+		// Encode the header once, the packet being sent as it is from now on
+		std::size_t size;
+		if (!packet.OnSend(&size))
+		{
+			NazaraError("Failed to prepare packet");
+			return false;
+		}
+
+		connection.outgoingPackets.emplace_back(std::move(packet));
+		QueueFlush(connectionId);
+
+		return true;
+	}
+
+	/*!
+	* \brief Waits for network events and handles them
+	* \return true If successful, false if waiting failed
+	*
+	* Queued packets are flushed, then incoming connections are accepted and received packets reported,
+	* and packets queued by the callbacks are flushed before returning.
+	*
+	* \param msTimeout Maximum time to wait in milliseconds, 0 will returns immediately and -1 will block indefinitely
+	* \param error If valid, this will be used to report the error status of the wait operation
+	*
+	* \remark Returns immediately if the reactor has no connection and is not listening
+	*/
+
+	bool TcpReactor::Update(int msTimeout, SocketError* error)
+	{
+		NazaraAssert(!m_isUpdating, "Update cannot be called from a callback");
+
+		Flush();
+
+		if (!m_connectionByHandle.empty() || m_poller.IsRegistered(m_server))
+		{
+			SocketError waitError;
+			m_poller.Wait(msTimeout, &waitError);
+
+			if (waitError != SocketError_NoError)
+			{
+				if (error)
+					*error = waitError;
+
+				return false;
+			}
+
+			m_poller.GetReadySockets(&m_readyToRead, &m_readyToWrite);
+
+			m_isUpdating = true;
+
+			for (SocketHandle handle : m_readyToWrite)
+			{
+				auto it = m_connectionByHandle.find(handle);
+				if (it != m_connectionByHandle.end() && m_connections[it->second]->isWaitingForWrite)
+					FlushConnection(it->second);
+			}
+
+			for (SocketHandle handle : m_readyToRead)
+			{
+				if (handle == m_server.GetNativeHandle())
+				{
+					AcceptClients();
+					continue;
+				}
+
+				// The connection may have been closed by a callback
+				auto it = m_connectionByHandle.find(handle);
+				if (it != m_connectionByHandle.end())
+					ReceivePackets(it->second);
+			}
+
+			Flush();
+
+			m_isUpdating = false;
+
+			m_freeConnections.insert(m_freeConnections.end(), m_releasedConnections.begin(), m_releasedConnections.end());
+			m_releasedConnections.clear();
+		}
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+	}
+
+	void TcpReactor::AcceptClients()
+	{
+		for (;;)
+		{
+			TcpClient client;
+			client.EnableBlocking(false);
+
+			if (!m_server.AcceptClient(&client))
+				break;
+
+			std::size_t connectionId = AddConnection(std::move(client));
+			if (connectionId != InvalidConnection)
+				OnConnected(this, connectionId);
+		}
+	}
+
+	std::size_t TcpReactor::AddConnection(TcpClient&& client)
+	{
+		client.EnableBlocking(false);
+
+		std::size_t connectionId;
+		if (!m_freeConnections.empty())
+		{
+			connectionId = m_freeConnections.back();
+			m_freeConnections.pop_back();
+		}
+		else
+		{
+			connectionId = m_connections.size();
+			m_connections.emplace_back(std::make_unique<Connection>());
+		}
+
+		Connection& connection = *m_connections[connectionId];
+		connection.client = std::move(client);
+
+		if (!m_poller.RegisterSocket(connection.client, SocketPollEvent_Read))
+		{
+			NazaraError("Failed to register client socket");
+			connection.client.Close();
+			m_freeConnections.push_back(connectionId);
+			return InvalidConnection;
+		}
+
+		if (!connection.receiveBuffer)
+			connection.receiveBuffer.reset(new UInt8[m_receiveBufferSize]);
+
+		connection.largePacketReceived = 0;
+		connection.outgoingOffset = 0;
+		connection.receiveBegin = 0;
+		connection.receiveSize = 0;
+		connection.isConnected = true;
+		connection.isFlushQueued = false;
+		connection.isReceivingLargePacket = false;
+		connection.isWaitingForWrite = false;
+
+		m_connectionByHandle[connection.client.GetNativeHandle()] = connectionId;
+
+		return connectionId;
+	}
+
+	void TcpReactor::CloseConnection(std::size_t connectionId, SocketError error)
+	{
+		OnDisconnected(this, connectionId, error);
+
+		Disconnect(connectionId);
+	}
+
+	bool TcpReactor::FlushConnection(std::size_t connectionId)
+	{
+		Connection& connection = *m_connections[connectionId];
+
+		while (!connection.outgoingPackets.empty())
+		{
+			std::size_t packetCount = std::min(connection.outgoingPackets.size(), MaxSendBufferCount);
+			m_sendBuffers.resize(packetCount);
+
+			std::size_t totalSize = 0;
+			for (std::size_t i = 0; i < packetCount; ++i)
+			{
+				const NetPacket& packet = connection.outgoingPackets[i];
+				std::size_t offset = (i == 0) ? connection.outgoingOffset : 0;
+
+				NetBuffer& buffer = m_sendBuffers[i];
+				buffer.data = packet.GetData() + offset;
+				buffer.dataLength = NetPacket::HeaderSize + packet.GetDataSize() - offset;
+
+				totalSize += buffer.dataLength;
+			}
+
+			std::size_t sent;
+			if (!connection.client.SendMultiple(m_sendBuffers.data(), packetCount, &sent))
+			{
+				CloseConnection(connectionId, connection.client.GetLastError());
+				return false;
+			}
+
+			// Drop fully sent packets and remember how much of the next one was sent
+			std::size_t sentPackets = 0;
+			std::size_t remaining = sent;
+			while (sentPackets < packetCount && remaining >= m_sendBuffers[sentPackets].dataLength)
+				remaining -= m_sendBuffers[sentPackets++].dataLength;
+
+			connection.outgoingOffset = (sentPackets == 0) ? connection.outgoingOffset + remaining : remaining;
+			connection.outgoingPackets.erase(connection.outgoingPackets.begin(), connection.outgoingPackets.begin() + sentPackets);
+
+			if (sent < totalSize)
+			{
+				// Socket buffer is full, wait for it to become writable again
+				if (!connection.isWaitingForWrite && m_poller.UpdateSocket(connection.client, SocketPollEvent_Read | SocketPollEvent_Write))
+					connection.isWaitingForWrite = true;
+
+				return true;
+			}
+		}
+
+		if (connection.isWaitingForWrite && m_poller.UpdateSocket(connection.client, SocketPollEvent_Read))
+			connection.isWaitingForWrite = false;
+
+		return true;
+	}
+
+	void TcpReactor::QueueFlush(std::size_t connectionId)
+	{
+		Connection& connection = *m_connections[connectionId];
+		if (!connection.isFlushQueued)
+		{
+			connection.isFlushQueued = true;
+			m_flushQueue.push_back(connectionId);
+		}
+	}
+
+	bool TcpReactor::ReceiveLargePacket(std::size_t connectionId)
+	{
+		Connection& connection = *m_connections[connectionId];
+
+		std::size_t remaining = connection.largePacket.GetDataSize() - connection.largePacketReceived;
+		if (remaining > 0)
+		{
+			std::size_t received;
+			if (!connection.client.Receive(connection.largePacket.GetData() + NetPacket::HeaderSize + connection.largePacketReceived, remaining, &received))
+			{
+				CloseConnection(connectionId, connection.client.GetLastError());
+				return false;
+			}
+
+			connection.largePacketReceived += received;
+			if (received < remaining)
+				return false;
+		}
+
+		connection.isReceivingLargePacket = false;
+
+		NetPacket packet(std::move(connection.largePacket));
+		OnPacketReceived(this, connectionId, packet);
+
+		return connection.isConnected;
+	}
+
+	void TcpReactor::ReceivePackets(std::size_t connectionId)
+	{
+		Connection& connection = *m_connections[connectionId];
+		const UInt8* ring = connection.receiveBuffer.get();
+
+		for (;;)
+		{
+			if (connection.isReceivingLargePacket)
+			{
+				if (!ReceiveLargePacket(connectionId))
+					return;
+
+				continue;
+			}
+
+			if (connection.receiveSize == 0)
+				connection.receiveBegin = 0;
+
+			// Receive in the contiguous free part of the ring buffer, which is never full at this point
+			std::size_t end = (connection.receiveBegin + connection.receiveSize) % m_receiveBufferSize;
+			std::size_t freeSize = (end < connection.receiveBegin) ? connection.receiveBegin - end : m_receiveBufferSize - end;
+
+			std::size_t received;
+			if (!connection.client.Receive(&connection.receiveBuffer[end], freeSize, &received))
+			{
+				CloseConnection(connectionId, connection.client.GetLastError());
+				return;
+			}
+
+			connection.receiveSize += received;
+
+			while (connection.receiveSize >= NetPacket::HeaderSize)
+			{
+				UInt8 header[NetPacket::HeaderSize];
+				CopyFromRing(ring, m_receiveBufferSize, connection.receiveBegin, header, NetPacket::HeaderSize);
+
+				UInt32 packetSize;
+				UInt16 netCode;
+				if (!NetPacket::DecodeHeader(header, &packetSize, &netCode) || packetSize < NetPacket::HeaderSize || packetSize > m_maxPacketSize)
+				{
+					CloseConnection(connectionId, SocketError_Packet);
+					return;
+				}
+
+				std::size_t dataBegin = (connection.receiveBegin + NetPacket::HeaderSize) % m_receiveBufferSize;
+				std::size_t dataSize = packetSize - NetPacket::HeaderSize;
+
+				if (connection.receiveSize >= packetSize)
+				{
+					NetPacket packet;
+					packet.Reset(netCode, nullptr, dataSize);
+					CopyFromRing(ring, m_receiveBufferSize, dataBegin, packet.GetData() + NetPacket::HeaderSize, dataSize);
+
+					connection.receiveBegin = (connection.receiveBegin + packetSize) % m_receiveBufferSize;
+					connection.receiveSize -= packetSize;
+
+					OnPacketReceived(this, connectionId, packet);
+					if (!connection.isConnected)
+						return;
+				}
+				else if (packetSize > m_receiveBufferSize)
+				{
+					// The packet can't fit in the ring buffer, receive the rest of it in place
+					std::size_t available = connection.receiveSize - NetPacket::HeaderSize;
+
+					connection.largePacket.Reset(netCode, nullptr, dataSize);
+					CopyFromRing(ring, m_receiveBufferSize, dataBegin, connection.largePacket.GetData() + NetPacket::HeaderSize, available);
+
+					connection.isReceivingLargePacket = true;
+					connection.largePacketReceived = available;
+					connection.receiveSize = 0;
+					break;
+				}
+				else
+					break;
+			}
+
+			// A short read means the socket has been drained (if more data came in since, the poller will report it again)
+			if (received < freeSize && !connection.isReceivingLargePacket)
+				return;
+		}
+	}
+
+	constexpr std::size_t TcpReactor::InvalidConnection;
+	constexpr std::size_t TcpReactor::MaxSendBufferCount;
+}
@@ -4,6 +4,7 @@
 
 #include <Nazara/Network/UdpSocket.hpp>
 #include <Nazara/Network/NetPacket.hpp>
+#include <Nazara/Network/UdpDatagram.hpp>
 
 #if defined(NAZARA_PLATFORM_WINDOWS)
 #include <Nazara/Network/Win32/SocketImpl.hpp>
@@ -65,6 +66,35 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Allows other sockets to bind the same address and port
+	* \return true If the option was changed
+	*
+	* \param reusePort Should the port be shared
+	*
+	* When several sockets are bound to the same port, the system spreads incoming datagrams between them,
+	* always handing the datagrams of the same source address to the same socket.
+	* The option must be enabled on every socket before binding them.
+	*
+	* \remark Produces a NazaraAssert if socket is invalid
+	* \remark This is only supported on systems having SO_REUSEPORT (such as Linux), it fails with SocketError_NotSupported otherwise
+	*/
+
+	bool UdpSocket::EnableReusePort(bool reusePort)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Invalid handle");
+
+		if (m_isReusePortEnabled != reusePort)
+		{
+			if (!SocketImpl::SetReusePort(m_handle, reusePort, &m_lastError))
+				return false;
+
+			m_isReusePortEnabled = reusePort;
+		}
+
+		return true;
+	}
+
 	/*!
 	* \brief Gets the maximum datagram size allowed
 	* \return Number of bytes
@@ -118,6 +148,27 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Receives multiple datagrams at once
+	* \return true If no error occurred
+	*
+	* \param datagrams A pointer to an array of UdpDatagram, whose buffers will receive the data, address and size being filled for every datagram received
+	* \param datagramCount Number of datagrams available
+	* \param received Optional argument to get the number of datagrams received, zero meaning no datagram was available
+	*
+	* \remark Only waits for the first datagram when the socket is blocking, the next ones are received only if they are already available
+	* \remark On Linux, every datagram is received with a single system call
+	* \remark Produces a NazaraAssert if socket is invalid
+	* \remark Produces a NazaraAssert if datagrams and their count are invalid
+	*/
+	bool UdpSocket::ReceiveDatagrams(UdpDatagram* datagrams, std::size_t datagramCount, std::size_t* received)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Socket hasn't been created");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		return SocketImpl::ReceiveDatagrams(m_handle, datagrams, datagramCount, received, &m_lastError);
+	}
+
 	/*!
 	* \brief Receive multiple datagram from one peer
 	* \return true If data were sent
@@ -232,6 +283,34 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Sends multiple datagrams at once
+	* \return true If no error occurred
+	*
+	* \param datagrams A pointer to an array of UdpDatagram containing the destination and the buffers of each datagram
+	* \param datagramCount Number of datagrams to send
+	* \param sent Optional argument to get the number of datagrams sent, which is less than datagramCount if the socket would have blocked
+	*
+	* \remark On Linux, every datagram is sent with a single system call
+	* \remark Produces a NazaraAssert if socket is invalid
+	* \remark Produces a NazaraAssert if datagrams and their count are invalid
+	* \remark Produces a NazaraAssert if the address of a datagram is invalid or has a different protocol than the socket
+	*/
+	bool UdpSocket::SendDatagrams(const UdpDatagram* datagrams, std::size_t datagramCount, std::size_t* sent)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Socket hasn't been created");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		for (std::size_t i = 0; i < datagramCount; ++i)
+		{
+			NazaraAssert(datagrams[i].address.IsValid(), "Invalid ip address");
+			NazaraAssert(datagrams[i].address.GetProtocol() == m_protocol, "IP Address has a different protocol than the socket");
+			NazaraAssert(datagrams[i].buffers && datagrams[i].bufferCount > 0, "Invalid buffer");
+		}
+
+		return SocketImpl::SendDatagrams(m_handle, datagrams, datagramCount, sent, &m_lastError);
+	}
+
 	/*!
 	* \brief Sends multiple buffers as one datagram
 	* \return true If data were sent
@@ -302,5 +381,6 @@ namespace Nz
 
 		m_boundAddress = IpAddress::Invalid;
 		m_isBroadCastingEnabled = false;
+		m_isReusePortEnabled = false;
 	}
 }
@@ -546,6 +546,51 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::ReceiveDatagrams(SocketHandle handle, UdpDatagram* datagrams, std::size_t datagramCount, std::size_t* received, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		// Windows has no way to receive multiple datagrams in one call, receive them one by one
+		std::size_t datagramRead = 0;
+		while (datagramRead < datagramCount)
+		{
+			// Only wait for the first datagram, the others are received if they are already there
+			if (datagramRead > 0 && QueryAvailableBytes(handle) == 0)
+				break;
+
+			UdpDatagram& datagram = datagrams[datagramRead];
+
+			int byteRead;
+			SocketError receiveError;
+			if (!ReceiveMultiple(handle, datagram.buffers, datagram.bufferCount, &datagram.address, &byteRead, &receiveError))
+			{
+				// A datagram too big for its buffers is discarded
+				if (receiveError == SocketError_DatagramSize)
+					continue;
+
+				if (error)
+					*error = receiveError;
+
+				return false; //< Error
+			}
+
+			if (byteRead == 0)
+				break;
+
+			datagram.dataLength = byteRead;
+			datagramRead++;
+		}
+
+		if (received)
+			*received = datagramRead;
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+	}
+
 	bool SocketImpl::ReceiveFrom(SocketHandle handle, void* buffer, int length, IpAddress* from, int* read, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
@@ -706,6 +751,39 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SendDatagrams(SocketHandle handle, const UdpDatagram* datagrams, std::size_t datagramCount, std::size_t* sent, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		// Windows has no way to send multiple datagrams in one call, send them one by one
+		std::size_t datagramSent = 0;
+		for (; datagramSent < datagramCount; ++datagramSent)
+		{
+			const UdpDatagram& datagram = datagrams[datagramSent];
+
+			int byteSent;
+			if (!SendMultiple(handle, datagram.buffers, datagram.bufferCount, datagram.address, &byteSent, error))
+			{
+				if (sent)
+					*sent = datagramSent;
+
+				return false; //< Error
+			}
+
+			if (byteSent == 0)
+				break;
+		}
+
+		if (sent)
+			*sent = datagramSent;
+
+		if (error)
+			*error = SocketError_NoError;
+
+		return true;
+	}
+
 	bool SocketImpl::SendMultiple(SocketHandle handle, const NetBuffer* buffers, std::size_t bufferCount, const IpAddress& to, int* sent, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
@@ -917,6 +995,19 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SetReusePort(SocketHandle handle, bool reusePort, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+		NazaraUnused(handle);
+		NazaraUnused(reusePort);
+
+		// Windows has no equivalent of SO_REUSEPORT load balancing (SO_REUSEADDR lets a socket steal the port instead)
+		if (error)
+			*error = SocketError_NotSupported;
+
+		return false;
+	}
+
 	bool SocketImpl::SetSendBufferSize(SocketHandle handle, std::size_t size, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
@@ -32,6 +32,23 @@ namespace Nz
 		#endif
 	}
 
+	void SocketPollerImpl::GetReadySockets(std::vector<SocketHandle>* readyToRead, std::vector<SocketHandle>* readyToWrite) const
+	{
+		#if NAZARA_NETWORK_POLL_SUPPORT
+		if (readyToRead)
+			readyToRead->assign(m_readyToReadSockets.begin(), m_readyToReadSockets.end());
+
+		if (readyToWrite)
+			readyToWrite->assign(m_readyToWriteSockets.begin(), m_readyToWriteSockets.end());
+		#else
+		if (readyToRead)
+			readyToRead->assign(m_readyToReadSockets.fd_array, m_readyToReadSockets.fd_array + m_readyToReadSockets.fd_count);
+
+		if (readyToWrite)
+			readyToWrite->assign(m_readyToWriteSockets.fd_array, m_readyToWriteSockets.fd_array + m_readyToWriteSockets.fd_count);
+		#endif
+	}
+
 	bool SocketPollerImpl::IsReadyToRead(SocketHandle socket) const
 	{
 		#if NAZARA_NETWORK_POLL_SUPPORT
@@ -130,6 +147,42 @@ namespace Nz
 		#endif
 	}
 
+	bool SocketPollerImpl::UpdateSocket(SocketHandle socket, SocketPollEventFlags eventFlags)
+	{
+		NazaraAssert(IsRegistered(socket), "Socket is not registered");
+
+		#if NAZARA_NETWORK_POLL_SUPPORT
+		PollSocket& entry = m_sockets[m_allSockets[socket]];
+		entry.events = 0;
+
+		if (eventFlags & SocketPollEvent_Read)
+			entry.events |= POLLRDNORM;
+
+		if (eventFlags & SocketPollEvent_Write)
+			entry.events |= POLLWRNORM;
+		#else
+		FD_CLR(socket, &m_readSockets);
+		FD_CLR(socket, &m_writeSockets);
+
+		for (std::size_t i = 0; i < 2; ++i)
+		{
+			if ((eventFlags & ((i == 0) ? SocketPollEvent_Read : SocketPollEvent_Write)) == 0)
+				continue;
+
+			fd_set& targetSet = (i == 0) ? m_readSockets : m_writeSockets;
+			if (targetSet.fd_count > FD_SETSIZE)
+			{
+				NazaraError("Socket count exceeding hard-coded FD_SETSIZE (" + String::Number(FD_SETSIZE) + ")");
+				return false;
+			}
+
+			FD_SET(socket, &targetSet);
+		}
+		#endif
+
+		return true;
+	}
+
 	unsigned int SocketPollerImpl::Wait(int msTimeout, SocketError* error)
 	{
 		unsigned int activeSockets;
@@ -25,12 +25,15 @@ namespace Nz
 
 			void Clear();
 
+			void GetReadySockets(std::vector<SocketHandle>* readyToRead, std::vector<SocketHandle>* readyToWrite) const;
+
 			bool IsReadyToRead(SocketHandle socket) const;
 			bool IsReadyToWrite(SocketHandle socket) const;
 			bool IsRegistered(SocketHandle socket) const;
 
 			bool RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags);
 			void UnregisterSocket(SocketHandle socket);
+			bool UpdateSocket(SocketHandle socket, SocketPollEventFlags eventFlags);
 
 			unsigned int Wait(int msTimeout, SocketError* error);
 
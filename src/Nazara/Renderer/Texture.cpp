@@ -1289,6 +1289,7 @@ namespace Nz
 		TextureLibrary::Uninitialize();
 	}
 
+	IndexPool Texture::s_sortIndexPool; //< Defined first so it's destroyed after the textures
 	TextureLibrary::LibraryMap Texture::s_library;
 	TextureManager::ManagerMap Texture::s_managerMap;
 	TextureManager::ManagerParams Texture::s_managerParameters;
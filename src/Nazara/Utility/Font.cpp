@@ -7,6 +7,7 @@
 #include <Nazara/Utility/FontData.hpp>
 #include <Nazara/Utility/FontGlyph.hpp>
 #include <Nazara/Utility/GuillotineImageAtlas.hpp>
+#include <algorithm>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
@@ -16,6 +17,28 @@ namespace Nz
 		const UInt8 r_sansationRegular[] = {
 			#include <Nazara/Utility/Resources/Fonts/OpenSans-Regular.ttf.h>
 		};
+
+		std::size_t HashCacheKey(UInt64 first, UInt64 second)
+		{
+			UInt64 hash = first ^ (second * 0x9E3779B97F4A7C15ULL);
+			hash ^= hash >> 31;
+			hash *= 0xBF58476D1CE4E5B9ULL;
+			hash ^= hash >> 32;
+
+			return static_cast<std::size_t>(hash);
+		}
+
+		// Linear probing in a power of two sized table, returns the first slot matching or empty
+		template<typename T, typename F>
+		T& ProbeCache(std::vector<T>& cache, std::size_t hash, F&& isMatchingOrEmpty)
+		{
+			std::size_t mask = cache.size() - 1;
+			for (std::size_t i = hash & mask;; i = (i + 1) & mask)
+			{
+				if (isMatchingOrEmpty(cache[i]))
+					return cache[i];
+			}
+		}
 	}
 
 	bool FontParams::IsValid() const
@@ -24,6 +47,9 @@ namespace Nz
 	}
 
 	Font::Font() :
+	m_glyphCacheSize(0),
+	m_kerningCacheSize(0),
+	m_lastGlyphTable(0),
 	m_glyphBorder(s_defaultGlyphBorder),
 	m_minimumStepSize(s_defaultMinimumStepSize)
 	{
@@ -47,18 +73,11 @@ namespace Nz
 			else
 			{
 				// Au moins une autre police utilise cet atlas, on vire nos glyphes un par un
-				for (auto mapIt = m_glyphes.begin(); mapIt != m_glyphes.end(); ++mapIt)
-				{
-					GlyphMap& glyphMap = mapIt->second;
-					for (auto glyphIt = glyphMap.begin(); glyphIt != glyphMap.end(); ++glyphIt)
-					{
-						Glyph& glyph = glyphIt->second;
-						m_atlas->Free(&glyph.atlasRect, &glyph.layerIndex, 1);
-					}
-				}
+				for (Glyph& glyph : m_glyphes)
+					m_atlas->Free(&glyph.atlasRect, &glyph.layerIndex, 1);
 
 				// Destruction des glyphes mémorisés et notification
-				m_glyphes.clear();
+				ResetGlyphCache();
 
 				OnFontGlyphCacheCleared(this);
 			}
@@ -68,6 +87,7 @@ namespace Nz
 	void Font::ClearKerningCache()
 	{
 		m_kerningCache.clear();
+		m_kerningCacheSize = 0;
 
 		OnFontKerningCacheCleared(this);
 	}
@@ -105,6 +125,7 @@ namespace Nz
 
 			m_data.reset();
 			m_kerningCache.clear();
+			m_kerningCacheSize = 0;
 			m_sizeInfoCache.clear();
 		}
 	}
@@ -130,20 +151,26 @@ namespace Nz
 	std::size_t Font::GetCachedGlyphCount(unsigned int characterSize, TextStyleFlags style, float outlineThickness) const
 	{
 		UInt64 key = ComputeKey(characterSize, style, outlineThickness);
-		auto it = m_glyphes.find(key);
-		if (it == m_glyphes.end())
-			return 0;
 
-		return it->second.size();
+		std::size_t count = 0;
+		for (const auto& table : m_glyphTables)
+		{
+			if (table->key == key)
+				count += std::count_if(table->glyphs.begin(), table->glyphs.end(), [](const Glyph* glyph) { return glyph != nullptr; });
+		}
+
+		for (const GlyphCacheEntry& entry : m_glyphCache)
+		{
+			if (entry.glyph && entry.key == key)
+				count++;
+		}
+
+		return count;
 	}
 
 	std::size_t Font::GetCachedGlyphCount() const
 	{
-		std::size_t count = 0;
-		for (auto& pair : m_glyphes)
-			count += pair.second.size();
-
-		return count;
+		return m_glyphes.size();
 	}
 
 	String Font::GetFamilyName() const
@@ -170,26 +197,69 @@ namespace Nz
 		#endif
 
 		// Use a cache as QueryKerning may be costly (may induce an internal size change)
-		auto& map = m_kerningCache[characterSize];
+		// Keep the load factor under one half, so probing stays short and always ends on an empty slot
+		if ((m_kerningCacheSize + 1) * 2 > m_kerningCache.size())
+		{
+			std::vector<KerningCacheEntry> entries(std::max<std::size_t>(m_kerningCache.size() * 2, 256));
+			std::swap(entries, m_kerningCache);
+
+			for (const KerningCacheEntry& entry : entries)
+			{
+				if (entry.used)
+					ProbeCache(m_kerningCache, HashCacheKey(entry.characters, entry.characterSize), [](const KerningCacheEntry& slot) { return !slot.used; }) = entry;
+			}
+		}
 
-		UInt64 key = (static_cast<UInt64>(first) << 32) | second;
+		UInt64 characters = (static_cast<UInt64>(first) << 32) | second;
 
-		auto it = map.find(key);
-		if (it == map.end())
+		KerningCacheEntry& entry = ProbeCache(m_kerningCache, HashCacheKey(characters, characterSize), [&](const KerningCacheEntry& slot)
 		{
-			int kerning = m_data->QueryKerning(characterSize, first, second);
-			map.insert(std::make_pair(key, kerning));
+			return !slot.used || (slot.characters == characters && slot.characterSize == characterSize);
+		});
 
-			return kerning;
+		if (!entry.used)
+		{
+			entry.characters = characters;
+			entry.characterSize = characterSize;
+			entry.kerning = m_data->QueryKerning(characterSize, first, second);
+			entry.used = true;
+
+			m_kerningCacheSize++;
 		}
-		else
-			return it->second;
+
+		return entry.kerning;
 	}
 
 	const Font::Glyph& Font::GetGlyph(unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const
 	{
 		UInt64 key = ComputeKey(characterSize, style, outlineThickness);
-		return PrecacheGlyph(m_glyphes[key], characterSize, style, outlineThickness, character);
+		return PrecacheGlyph(key, characterSize, style, outlineThickness, character);
+	}
+
+	void Font::GetGlyphs(unsigned int characterSize, TextStyleFlags style, float outlineThickness, const char32_t* characters, std::size_t characterCount, const Glyph** glyphs) const
+	{
+		NazaraAssert(characters || characterCount == 0, "Invalid character array with a non-zero characterCount");
+		NazaraAssert(glyphs || characterCount == 0, "Invalid glyph array with a non-zero characterCount");
+
+		// Key and Latin-1 table are only looked up once for the whole string
+		UInt64 key = ComputeKey(characterSize, style, outlineThickness);
+		const GlyphTable* table = nullptr;
+
+		for (std::size_t i = 0; i < characterCount; ++i)
+		{
+			char32_t character = characters[i];
+
+			const Glyph* glyph = nullptr;
+			if (character < 256)
+			{
+				if (!table)
+					table = &GetGlyphTable(key);
+
+				glyph = table->glyphs[character];
+			}
+
+			glyphs[i] = (glyph) ? glyph : &PrecacheGlyph(key, characterSize, style, outlineThickness, character);
+		}
 	}
 
 	unsigned int Font::GetGlyphBorder() const
@@ -258,7 +328,7 @@ namespace Nz
 	bool Font::Precache(unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const
 	{
 		UInt64 key = ComputeKey(characterSize, style, outlineThickness);
-		return PrecacheGlyph(m_glyphes[key], characterSize, style, outlineThickness, character).valid;
+		return PrecacheGlyph(key, characterSize, style, outlineThickness, character).valid;
 	}
 
 	bool Font::Precache(unsigned int characterSize, TextStyleFlags style, float outlineThickness, const String& characterSet) const
@@ -272,9 +342,8 @@ namespace Nz
 		}
 
 		UInt64 key = ComputeKey(characterSize, style, outlineThickness);
-		auto& glyphMap = m_glyphes[key];
 		for (char32_t character : set)
-			PrecacheGlyph(glyphMap, characterSize, style, outlineThickness, character);
+			PrecacheGlyph(key, characterSize, style, outlineThickness, character);
 
 		return true;
 	}
@@ -409,6 +478,63 @@ namespace Nz
 		return (sizeStylePart << 32) | reinterpret_cast<Nz::UInt32&>(outlineThickness);
 	}
 
+	Font::GlyphCacheEntry& Font::GetGlyphCacheEntry(UInt64 key, char32_t character) const
+	{
+		// Keep the load factor under one half, so probing stays short and always ends on an empty slot
+		if ((m_glyphCacheSize + 1) * 2 > m_glyphCache.size())
+		{
+			std::vector<GlyphCacheEntry> entries(std::max<std::size_t>(m_glyphCache.size() * 2, 256));
+			std::swap(entries, m_glyphCache);
+
+			for (const GlyphCacheEntry& entry : entries)
+			{
+				if (entry.glyph)
+					ProbeCache(m_glyphCache, HashCacheKey(entry.key, entry.character), [](const GlyphCacheEntry& slot) { return slot.glyph == nullptr; }) = entry;
+			}
+		}
+
+		GlyphCacheEntry& entry = ProbeCache(m_glyphCache, HashCacheKey(key, character), [&](const GlyphCacheEntry& slot)
+		{
+			return !slot.glyph || (slot.key == key && slot.character == character);
+		});
+
+		if (!entry.glyph)
+		{
+			// The caller is expected to store a glyph right away
+			entry.key = key;
+			entry.character = character;
+
+			m_glyphCacheSize++;
+		}
+
+		return entry;
+	}
+
+	Font::GlyphTable& Font::GetGlyphTable(UInt64 key) const
+	{
+		// The same size and style are usually requested many times in a row
+		if (m_lastGlyphTable < m_glyphTables.size() && m_glyphTables[m_lastGlyphTable]->key == key)
+			return *m_glyphTables[m_lastGlyphTable];
+
+		for (std::size_t i = 0; i < m_glyphTables.size(); ++i)
+		{
+			if (m_glyphTables[i]->key == key)
+			{
+				m_lastGlyphTable = i;
+				return *m_glyphTables[i];
+			}
+		}
+
+		std::unique_ptr<GlyphTable> table = std::make_unique<GlyphTable>();
+		table->key = key;
+		table->glyphs.fill(nullptr);
+
+		m_lastGlyphTable = m_glyphTables.size();
+		m_glyphTables.emplace_back(std::move(table));
+
+		return *m_glyphTables.back();
+	}
+
 	void Font::OnAtlasCleared(const AbstractAtlas* atlas)
 	{
 		NazaraUnused(atlas);
@@ -423,7 +549,7 @@ namespace Nz
 		#endif
 
 		// Notre atlas vient d'être vidé, détruisons le cache de glyphe
-		m_glyphes.clear();
+		ResetGlyphCache();
 
 		OnFontGlyphCacheCleared(this);
 	}
@@ -464,15 +590,20 @@ namespace Nz
 		NazaraError("Atlas has been released while in use");
 	}
 
-	const Font::Glyph& Font::PrecacheGlyph(GlyphMap& glyphMap, unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const
+	const Font::Glyph& Font::PrecacheGlyph(UInt64 key, unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const
 	{
-		auto it = glyphMap.find(character);
-		if (it != glyphMap.end())
-			return it->second;
+		Glyph*& cachedGlyph = (character < 256) ? GetGlyphTable(key).glyphs[character] : GetGlyphCacheEntry(key, character).glyph;
+		if (cachedGlyph)
+			return *cachedGlyph;
+
+		// Glyphs are never moved once inserted, unlike cache entries which must not be used past this point
+		m_glyphes.emplace_back();
 
-		Glyph& glyph = glyphMap[character]; //< Insert a new glyph
+		Glyph& glyph = m_glyphes.back(); //< Insert a new glyph
 		glyph.valid = false;
 
+		cachedGlyph = &glyph;
+
 		#if NAZARA_UTILITY_SAFE
 		if (!m_atlas)
 		{
@@ -554,7 +685,7 @@ namespace Nz
 		{
 			// Font doesn't support request style, precache the minimal supported version and copy its data
 			UInt64 newKey = ComputeKey(characterSize, supportedStyle, supportedOutlineThickness);
-			const Glyph& referenceGlyph = PrecacheGlyph(m_glyphes[newKey], characterSize, supportedStyle, supportedOutlineThickness, character);
+			const Glyph& referenceGlyph = PrecacheGlyph(newKey, characterSize, supportedStyle, supportedOutlineThickness, character);
 			if (referenceGlyph.valid)
 			{
 				glyph.aabb = referenceGlyph.aabb;
@@ -569,6 +700,14 @@ namespace Nz
 		return glyph;
 	}
 
+	void Font::ResetGlyphCache()
+	{
+		m_glyphCache.clear();
+		m_glyphCacheSize = 0;
+		m_glyphTables.clear();
+		m_glyphes.clear();
+	}
+
 	bool Font::Initialize()
 	{
 		if (!FontLibrary::Initialize())
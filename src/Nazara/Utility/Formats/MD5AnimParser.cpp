@@ -12,22 +12,15 @@ namespace Nz
 {
 	MD5AnimParser::MD5AnimParser(Stream& stream) :
 	m_stream(stream),
-	m_streamFlags(stream.GetStreamOptions()), //< Saves stream flags
 	m_keepLastLine(false),
 	m_frameIndex(0),
 	m_frameRate(0),
 	m_lineCount(0)
 	{
+		// Text mode only applies to the buffered stream, the stream given by the user is not modified
 		m_stream.EnableTextMode(true);
 	}
 
-	MD5AnimParser::~MD5AnimParser()
-	{
-		// Reset stream flags
-		if ((m_streamFlags & StreamOption_Text) == 0)
-			m_stream.EnableTextMode(false);
-	}
-
 	Ternary MD5AnimParser::Check()
 	{
 		if (Advance(false))
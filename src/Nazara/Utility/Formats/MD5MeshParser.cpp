@@ -13,21 +13,14 @@ namespace Nz
 {
 	MD5MeshParser::MD5MeshParser(Stream& stream) :
 	m_stream(stream),
-	m_streamFlags(stream.GetStreamOptions()), //< Saves stream flags
 	m_keepLastLine(false),
 	m_lineCount(0),
 	m_meshIndex(0)
 	{
+		// Text mode only applies to the buffered stream, the stream given by the user is not modified
 		m_stream.EnableTextMode(true);
 	}
 
-	MD5MeshParser::~MD5MeshParser()
-	{
-		// Reset stream flags
-		if ((m_streamFlags & StreamOption_Text) == 0)
-			m_stream.EnableTextMode(false);
-	}
-
 	Ternary MD5MeshParser::Check()
 	{
 		if (Advance(false))
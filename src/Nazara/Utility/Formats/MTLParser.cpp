@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/Formats/MTLParser.hpp>
+#include <Nazara/Core/BufferedStream.hpp>
 #include <Nazara/Core/CallOnExit.hpp>
 #include <Nazara/Utility/Config.hpp>
 #include <cstdio>
@@ -12,8 +13,6 @@ namespace Nz
 {
 	bool MTLParser::Parse(Stream& stream)
 	{
-		m_currentStream = &stream;
-
 		// Force stream in text mode, reset it at the end
 		Nz::CallOnExit resetTextMode;
 		if ((stream.GetStreamOptions() & StreamOption_Text) == 0)
@@ -26,6 +25,10 @@ namespace Nz
 			});
 		}
 
+		// The stream is read line by line, read it by big blocks instead
+		BufferedStream bufferedStream(stream);
+		m_currentStream = &bufferedStream;
+
 		m_keepLastLine = false;
 		m_lineCount = 0;
 		m_materials.clear();
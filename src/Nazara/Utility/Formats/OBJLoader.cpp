@@ -4,6 +4,7 @@
 
 #include <Nazara/Utility/Formats/OBJLoader.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/MappedFile.hpp>
 #include <Nazara/Utility/IndexMapper.hpp>
 #include <Nazara/Utility/MaterialData.hpp>
 #include <Nazara/Utility/Mesh.hpp>
@@ -44,8 +45,8 @@ namespace Nz
 
 		bool ParseMTL(Mesh* mesh, const String& filePath, const String* materials, const OBJParser::Mesh* meshes, UInt32 meshCount)
 		{
-			File file(filePath);
-			if (!file.Open(OpenMode_ReadOnly | OpenMode_Text))
+			MappedFile file(filePath);
+			if (!file.Open())
 			{
 				NazaraError("Failed to open MTL file (" + file.GetPath() + ')');
 				return false;
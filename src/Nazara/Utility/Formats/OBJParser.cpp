@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/Formats/OBJParser.hpp>
+#include <Nazara/Core/BufferedStream.hpp>
 #include <Nazara/Core/CallOnExit.hpp>
 #include <Nazara/Utility/Config.hpp>
 #include <cctype>
@@ -89,7 +90,6 @@ namespace Nz
 
 	bool OBJParser::Parse(Nz::Stream& stream, UInt32 reservedVertexCount)
 	{
-		m_currentStream = &stream;
 		m_errorCount = 0;
 		m_keepLastLine = false;
 		m_lineCount = 0;
@@ -106,6 +106,10 @@ namespace Nz
 			});
 		}
 
+		// The stream is read line by line, read it by big blocks instead
+		BufferedStream bufferedStream(stream);
+		m_currentStream = &bufferedStream;
+
 		String matName, meshName;
 		matName = meshName = "default";
 		m_meshes.clear();
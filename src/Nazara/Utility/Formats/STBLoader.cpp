@@ -55,13 +55,8 @@ namespace Nz
 				return Ternary_False;
 		}
 
-		ImageRef Load(Stream& stream, const ImageParams& parameters)
+		ImageRef CreateImage(UInt8* ptr, int width, int height, const ImageParams& parameters)
 		{
-			// Je charge tout en RGBA8 et je converti ensuite via la méthode Convert
-			// Ceci à cause d'un bug de STB lorsqu'il s'agit de charger certaines images (ex: JPG) en "default"
-
-			int width, height, bpp;
-			UInt8* ptr = stbi_load_from_callbacks(&callbacks, &stream, &width, &height, &bpp, STBI_rgb_alpha);
 			if (!ptr)
 			{
 				NazaraError("Failed to load image: " + String(stbi_failure_reason()));
@@ -89,18 +84,38 @@ namespace Nz
 
 			return image;
 		}
+
+		ImageRef Load(Stream& stream, const ImageParams& parameters)
+		{
+			// Je charge tout en RGBA8 et je converti ensuite via la méthode Convert
+			// Ceci à cause d'un bug de STB lorsqu'il s'agit de charger certaines images (ex: JPG) en "default"
+
+			int width, height, bpp;
+			UInt8* ptr = stbi_load_from_callbacks(&callbacks, &stream, &width, &height, &bpp, STBI_rgb_alpha);
+
+			return CreateImage(ptr, width, height, parameters);
+		}
+
+		ImageRef LoadMemory(const void* data, std::size_t size, const ImageParams& parameters)
+		{
+			// Decoding directly from memory spares the read callbacks and their copies
+			int width, height, bpp;
+			UInt8* ptr = stbi_load_from_memory(static_cast<const stbi_uc*>(data), static_cast<int>(size), &width, &height, &bpp, STBI_rgb_alpha);
+
+			return CreateImage(ptr, width, height, parameters);
+		}
 	}
 
 	namespace Loaders
 	{
 		void RegisterSTBLoader()
 		{
-			ImageLoader::RegisterLoader(IsSupported, Check, Load);
+			ImageLoader::RegisterLoader(IsSupported, Check, Load, nullptr, LoadMemory);
 		}
 
 		void UnregisterSTBLoader()
 		{
-			ImageLoader::UnregisterLoader(IsSupported, Check, Load);
+			ImageLoader::UnregisterLoader(IsSupported, Check, Load, nullptr, LoadMemory);
 		}
 	}
 }
@@ -142,9 +142,8 @@ namespace Nz
 			m_lines.emplace_back(Line{Rectf::Zero(), 0});
 	}
 
-	bool SimpleTextDrawer::GenerateGlyph(Glyph& glyph, char32_t character, float outlineThickness, bool lineWrap, Nz::Color color, int renderOrder, int* advance) const
+	bool SimpleTextDrawer::GenerateGlyph(Glyph& glyph, const Font::Glyph& fontGlyph, float outlineThickness, bool lineWrap, Nz::Color color, int renderOrder, int* advance) const
 	{
-		const Font::Glyph& fontGlyph = m_font->GetGlyph(m_characterSize, m_style, outlineThickness, character);
 		if (fontGlyph.valid && fontGlyph.fauxOutlineThickness <= 0.f)
 		{
 			glyph.atlas = m_font->GetAtlas()->GetLayer(fontGlyph.layerIndex);
@@ -197,9 +196,32 @@ namespace Nz
 
 		const Font::SizeInfo& sizeInfo = m_font->GetSizeInfo(m_characterSize);
 
+		// Query the font glyphs of every word at once, whitespaces don't have any
+		m_fontGlyphs.assign(characters.size(), nullptr);
+		if (m_outlineThickness > 0.f)
+			m_fontOutlineGlyphs.assign(characters.size(), nullptr);
+
+		std::size_t wordBegin = 0;
+		for (std::size_t i = 0; i <= characters.size(); ++i)
+		{
+			if (i < characters.size() && characters[i] != ' ' && characters[i] != '\n' && characters[i] != '\t')
+				continue;
+
+			if (i > wordBegin)
+			{
+				m_font->GetGlyphs(m_characterSize, m_style, 0.f, &characters[wordBegin], i - wordBegin, &m_fontGlyphs[wordBegin]);
+				if (m_outlineThickness > 0.f)
+					m_font->GetGlyphs(m_characterSize, m_style, m_outlineThickness, &characters[wordBegin], i - wordBegin, &m_fontOutlineGlyphs[wordBegin]);
+			}
+
+			wordBegin = i + 1;
+		}
+
 		m_glyphs.reserve(m_glyphs.size() + characters.size() * ((m_outlineThickness > 0.f) ? 2 : 1));
-		for (char32_t character : characters)
+		for (std::size_t i = 0; i < characters.size(); ++i)
 		{
+			char32_t character = characters[i];
+
 			if (m_previousCharacter != 0)
 				m_drawPos.x += m_font->GetKerning(m_characterSize, m_previousCharacter, character);
 
@@ -227,7 +249,7 @@ namespace Nz
 			if (!whitespace)
 			{
 				int iAdvance;
-				if (!GenerateGlyph(glyph, character, 0.f, true, m_color, 0, &iAdvance))
+				if (!GenerateGlyph(glyph, *m_fontGlyphs[i], 0.f, true, m_color, 0, &iAdvance))
 					continue; // Glyph failed to load, just skip it (can't do much)
 
 				advance += float(iAdvance);
@@ -235,7 +257,7 @@ namespace Nz
 				if (m_outlineThickness > 0.f)
 				{
 					Glyph outlineGlyph;
-					if (GenerateGlyph(outlineGlyph, character, m_outlineThickness, false, m_outlineColor, -1, nullptr))
+					if (GenerateGlyph(outlineGlyph, *m_fontOutlineGlyphs[i], m_outlineThickness, false, m_outlineColor, -1, nullptr))
 						m_glyphs.push_back(outlineGlyph);
 				}
 			}
@@ -0,0 +1,469 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/TransformHierarchy.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Parallel.hpp>
+#include <algorithm>
+#include <cmath>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		// Same as Node::ScaleQuaternion
+		Quaternionf ScaleQuaternion(const Vector3f& scale, Quaternionf quaternion)
+		{
+			if (std::signbit(scale.x))
+			{
+				quaternion.z = -quaternion.z;
+				quaternion.y = -quaternion.y;
+			}
+
+			if (std::signbit(scale.y))
+			{
+				quaternion.x = -quaternion.x;
+				quaternion.z = -quaternion.z;
+			}
+
+			if (std::signbit(scale.z))
+			{
+				quaternion.x = -quaternion.x;
+				quaternion.y = -quaternion.y;
+			}
+
+			return quaternion;
+		}
+
+		template<typename T>
+		void PermuteSlots(std::vector<T>& values, const std::vector<UInt32>& newSlots)
+		{
+			std::vector<T> sortedValues(values.size());
+			for (std::size_t i = 0; i < values.size(); ++i)
+				sortedValues[newSlots[i]] = std::move(values[i]);
+
+			values = std::move(sortedValues);
+		}
+
+		template<typename T>
+		void RemoveSlot(std::vector<T>& values, UInt32 slot)
+		{
+			values[slot] = std::move(values.back());
+			values.pop_back();
+		}
+	}
+
+	/*!
+	* \ingroup utility
+	* \class Nz::TransformHierarchy
+	* \brief Utility class storing a whole hierarchy of transforms in flat arrays
+	*
+	* This is a data-oriented alternative to Node for large scenes: nodes are identified by integers and their
+	* local and global transforms are stored in separate arrays sorted by depth, so that every parent comes before its children.
+	* Modifying a node only flags it, global transforms of flagged nodes and of their descendants are then recomputed
+	* in a single linear pass by Update, without any virtual call or signal.
+	*
+	* \remark Global transforms are only valid after a call to Update
+	*/
+
+	/*!
+	* \brief Destroys every node of the hierarchy
+	*/
+	void TransformHierarchy::Clear()
+	{
+		m_childCounts.clear();
+		m_flags.clear();
+		m_freeIds.clear();
+		m_globalPositions.clear();
+		m_globalRotations.clear();
+		m_globalScales.clear();
+		m_invalidatedSlots.Clear();
+		m_levelOffsets.clear();
+		m_nodeIds.clear();
+		m_parentIds.clear();
+		m_parentSlots.clear();
+		m_positions.clear();
+		m_rotations.clear();
+		m_scales.clear();
+		m_slots.clear();
+		m_transformMatrices.clear();
+		m_sortRequired = false;
+	}
+
+	/*!
+	* \brief Creates a node with an identity transform
+	* \return Identifier of the new node, identifiers of destroyed nodes are reused
+	*
+	* \param parent Identifier of the parent node or InvalidNodeId to create a root node
+	*/
+	TransformHierarchy::NodeId TransformHierarchy::CreateNode(NodeId parent)
+	{
+		NazaraAssert(parent == InvalidNodeId || IsNodeValid(parent), "Invalid parent");
+
+		NodeId node;
+		if (!m_freeIds.empty())
+		{
+			node = m_freeIds.back();
+			m_freeIds.pop_back();
+		}
+		else
+		{
+			node = static_cast<NodeId>(m_slots.size());
+			m_childCounts.push_back(0);
+			m_slots.push_back(InvalidSlot);
+		}
+
+		UInt32 slot = static_cast<UInt32>(m_nodeIds.size());
+		m_slots[node] = slot;
+
+		m_flags.push_back(NodeFlags_InheritPosition | NodeFlags_InheritRotation | NodeFlags_InheritScale);
+		m_globalPositions.push_back(Vector3f::Zero());
+		m_globalRotations.push_back(Quaternionf::Identity());
+		m_globalScales.push_back(Vector3f::Unit());
+		m_nodeIds.push_back(node);
+		m_parentIds.push_back(parent);
+		m_parentSlots.push_back(InvalidSlot); //< Computed when sorting nodes
+		m_positions.push_back(Vector3f::Zero());
+		m_rotations.push_back(Quaternionf::Identity());
+		m_scales.push_back(Vector3f::Unit());
+		m_transformMatrices.push_back(Matrix4f::Identity());
+
+		m_invalidatedSlots.Resize(slot + 1);
+		InvalidateSlot(slot);
+
+		if (parent != InvalidNodeId)
+			m_childCounts[parent]++;
+
+		m_sortRequired = true;
+
+		return node;
+	}
+
+	/*!
+	* \brief Destroys a node
+	*
+	* \param node Identifier of the node
+	*
+	* \remark Children of the node become root nodes, keeping their local transform
+	*/
+	void TransformHierarchy::DestroyNode(NodeId node)
+	{
+		UInt32 slot = GetSlot(node);
+
+		if (m_childCounts[node] > 0)
+		{
+			for (UInt32 i = 0; i < m_parentIds.size(); ++i)
+			{
+				if (m_parentIds[i] == node)
+				{
+					m_parentIds[i] = InvalidNodeId;
+					InvalidateSlot(i);
+				}
+			}
+
+			m_childCounts[node] = 0;
+		}
+
+		NodeId parent = m_parentIds[slot];
+		if (parent != InvalidNodeId)
+			m_childCounts[parent]--;
+
+		// Move the last node to the freed slot, the depth order will be restored by the next update
+		UInt32 lastSlot = static_cast<UInt32>(m_nodeIds.size() - 1);
+		if (slot != lastSlot)
+		{
+			m_invalidatedSlots.Set(slot, m_invalidatedSlots.Test(lastSlot));
+			m_slots[m_nodeIds[lastSlot]] = slot;
+		}
+
+		RemoveSlot(m_flags, slot);
+		RemoveSlot(m_globalPositions, slot);
+		RemoveSlot(m_globalRotations, slot);
+		RemoveSlot(m_globalScales, slot);
+		RemoveSlot(m_nodeIds, slot);
+		RemoveSlot(m_parentIds, slot);
+		RemoveSlot(m_parentSlots, slot);
+		RemoveSlot(m_positions, slot);
+		RemoveSlot(m_rotations, slot);
+		RemoveSlot(m_scales, slot);
+		RemoveSlot(m_transformMatrices, slot);
+
+		m_invalidatedSlots.Resize(lastSlot);
+
+		m_freeIds.push_back(node);
+		m_slots[node] = InvalidSlot;
+
+		m_sortRequired = true;
+	}
+
+	void TransformHierarchy::SetInheritPosition(NodeId node, bool inheritPosition)
+	{
+		SetFlag(node, NodeFlags_InheritPosition, inheritPosition);
+	}
+
+	void TransformHierarchy::SetInheritRotation(NodeId node, bool inheritRotation)
+	{
+		SetFlag(node, NodeFlags_InheritRotation, inheritRotation);
+	}
+
+	void TransformHierarchy::SetInheritScale(NodeId node, bool inheritScale)
+	{
+		SetFlag(node, NodeFlags_InheritScale, inheritScale);
+	}
+
+	/*!
+	* \brief Changes the parent of a node
+	*
+	* \param node Identifier of the node
+	* \param parent Identifier of the new parent or InvalidNodeId to make the node a root node
+	*
+	* \remark The local transform of the node is kept
+	*/
+	void TransformHierarchy::SetParent(NodeId node, NodeId parent)
+	{
+		NazaraAssert(parent == InvalidNodeId || IsNodeValid(parent), "Invalid parent");
+
+		UInt32 slot = GetSlot(node);
+
+		#if NAZARA_UTILITY_SAFE
+		for (NodeId ancestor = parent; ancestor != InvalidNodeId; ancestor = m_parentIds[m_slots[ancestor]])
+		{
+			if (ancestor == node)
+			{
+				NazaraError("A node cannot be it's own parent");
+				return;
+			}
+		}
+		#endif
+
+		NodeId previousParent = m_parentIds[slot];
+		if (previousParent == parent)
+			return;
+
+		if (previousParent != InvalidNodeId)
+			m_childCounts[previousParent]--;
+
+		if (parent != InvalidNodeId)
+			m_childCounts[parent]++;
+
+		m_parentIds[slot] = parent;
+		InvalidateSlot(slot);
+
+		m_sortRequired = true;
+	}
+
+	void TransformHierarchy::SetPosition(NodeId node, const Vector3f& position)
+	{
+		UInt32 slot = GetSlot(node);
+
+		m_positions[slot] = position;
+		InvalidateSlot(slot);
+	}
+
+	void TransformHierarchy::SetRotation(NodeId node, const Quaternionf& rotation)
+	{
+		UInt32 slot = GetSlot(node);
+
+		m_rotations[slot] = rotation;
+		m_rotations[slot].Normalize();
+		InvalidateSlot(slot);
+	}
+
+	void TransformHierarchy::SetScale(NodeId node, const Vector3f& scale)
+	{
+		UInt32 slot = GetSlot(node);
+
+		m_scales[slot] = scale;
+		InvalidateSlot(slot);
+	}
+
+	/*!
+	* \brief Recomputes the global transforms of every node modified since the last update, and of their descendants
+	*
+	* \param parallel Should the work be spread over the TaskScheduler workers, one depth level after another
+	*
+	* \remark The hierarchy must not be modified during the update
+	*/
+	void TransformHierarchy::Update(bool parallel)
+	{
+		if (m_sortRequired)
+			SortNodes();
+
+		if (m_invalidatedSlots.TestNone())
+			return;
+
+		PropagateInvalidation();
+
+		if (parallel)
+		{
+			// Nodes of a level only depend on nodes of the previous levels
+			constexpr UInt32 grainSize = 256;
+
+			for (std::size_t level = 0; level < m_levelOffsets.size() - 1; ++level)
+			{
+				ParallelFor<UInt32>(m_levelOffsets[level], m_levelOffsets[level + 1], grainSize, [this](UInt32 firstSlot, UInt32 lastSlot)
+				{
+					UpdateSlots(firstSlot, lastSlot);
+				});
+			}
+		}
+		else
+			UpdateSlots(0, static_cast<UInt32>(m_nodeIds.size()));
+
+		m_invalidatedSlots.Reset();
+	}
+
+	void TransformHierarchy::PropagateInvalidation()
+	{
+		// Parents come before their children, so a single pass starting after the first invalidated node is enough
+		std::size_t firstSlot = m_invalidatedSlots.FindFirst();
+		for (std::size_t slot = firstSlot + 1; slot < m_nodeIds.size(); ++slot)
+		{
+			UInt32 parentSlot = m_parentSlots[slot];
+			if (parentSlot != InvalidSlot && m_invalidatedSlots.Test(parentSlot))
+				m_invalidatedSlots.Set(slot);
+		}
+	}
+
+	void TransformHierarchy::SetFlag(NodeId node, NodeFlags flag, bool enable)
+	{
+		UInt32 slot = GetSlot(node);
+
+		UInt8 flags = (enable) ? (m_flags[slot] | flag) : (m_flags[slot] & ~flag);
+		if (flags != m_flags[slot])
+		{
+			m_flags[slot] = flags;
+			InvalidateSlot(slot);
+		}
+	}
+
+	void TransformHierarchy::SortNodes()
+	{
+		constexpr UInt32 UnknownDepth = std::numeric_limits<UInt32>::max();
+
+		UInt32 nodeCount = static_cast<UInt32>(m_nodeIds.size());
+
+		// Compute the depth of every node, walking up to the first ancestor whose depth is already known
+		std::vector<UInt32> depths(nodeCount, UnknownDepth);
+		std::vector<UInt32> path;
+		UInt32 maxDepth = 0;
+		for (UInt32 slot = 0; slot < nodeCount; ++slot)
+		{
+			UInt32 current = slot;
+			while (depths[current] == UnknownDepth && m_parentIds[current] != InvalidNodeId)
+			{
+				path.push_back(current);
+				current = m_slots[m_parentIds[current]];
+			}
+
+			if (depths[current] == UnknownDepth)
+				depths[current] = 0;
+
+			UInt32 depth = depths[current];
+			while (!path.empty())
+			{
+				depths[path.back()] = ++depth;
+				path.pop_back();
+			}
+
+			maxDepth = std::max(maxDepth, depth);
+		}
+
+		// Counting sort by depth, stable to keep slots of untouched nodes as close as possible
+		m_levelOffsets.assign(maxDepth + 2, 0);
+		for (UInt32 slot = 0; slot < nodeCount; ++slot)
+			m_levelOffsets[depths[slot] + 1]++;
+
+		for (std::size_t level = 1; level < m_levelOffsets.size(); ++level)
+			m_levelOffsets[level] += m_levelOffsets[level - 1];
+
+		std::vector<UInt32> levelCursors(m_levelOffsets.begin(), m_levelOffsets.end() - 1);
+		std::vector<UInt32> newSlots(nodeCount);
+		for (UInt32 slot = 0; slot < nodeCount; ++slot)
+			newSlots[slot] = levelCursors[depths[slot]]++;
+
+		PermuteSlots(m_flags, newSlots);
+		PermuteSlots(m_globalPositions, newSlots);
+		PermuteSlots(m_globalRotations, newSlots);
+		PermuteSlots(m_globalScales, newSlots);
+		PermuteSlots(m_nodeIds, newSlots);
+		PermuteSlots(m_parentIds, newSlots);
+		PermuteSlots(m_positions, newSlots);
+		PermuteSlots(m_rotations, newSlots);
+		PermuteSlots(m_scales, newSlots);
+		PermuteSlots(m_transformMatrices, newSlots);
+
+		Bitset<UInt64> invalidatedSlots(nodeCount, false);
+		for (std::size_t slot = m_invalidatedSlots.FindFirst(); slot != m_invalidatedSlots.npos; slot = m_invalidatedSlots.FindNext(slot))
+			invalidatedSlots.Set(static_cast<std::size_t>(newSlots[slot]));
+
+		m_invalidatedSlots = std::move(invalidatedSlots);
+
+		for (UInt32 slot = 0; slot < nodeCount; ++slot)
+			m_slots[m_nodeIds[slot]] = slot;
+
+		for (UInt32 slot = 0; slot < nodeCount; ++slot)
+		{
+			NodeId parent = m_parentIds[slot];
+			m_parentSlots[slot] = (parent != InvalidNodeId) ? m_slots[parent] : InvalidSlot;
+		}
+
+		m_sortRequired = false;
+	}
+
+	void TransformHierarchy::UpdateSlots(UInt32 firstSlot, UInt32 lastSlot)
+	{
+		for (UInt32 slot = firstSlot; slot < lastSlot; ++slot)
+		{
+			if (!m_invalidatedSlots.Test(slot))
+				continue;
+
+			Vector3f& globalPosition = m_globalPositions[slot];
+			Quaternionf& globalRotation = m_globalRotations[slot];
+			Vector3f& globalScale = m_globalScales[slot];
+
+			UInt32 parentSlot = m_parentSlots[slot];
+			if (parentSlot != InvalidSlot)
+			{
+				const Vector3f& parentPosition = m_globalPositions[parentSlot];
+				const Quaternionf& parentRotation = m_globalRotations[parentSlot];
+				const Vector3f& parentScale = m_globalScales[parentSlot];
+				UInt8 flags = m_flags[slot];
+
+				if (flags & NodeFlags_InheritPosition)
+					globalPosition = parentRotation * (parentScale * m_positions[slot]) + parentPosition;
+				else
+					globalPosition = m_positions[slot];
+
+				if (flags & NodeFlags_InheritRotation)
+				{
+					Quaternionf rotation = m_rotations[slot];
+					if (flags & NodeFlags_InheritScale)
+						rotation = ScaleQuaternion(parentScale, rotation);
+
+					globalRotation = parentRotation * rotation;
+					globalRotation.Normalize();
+				}
+				else
+					globalRotation = m_rotations[slot];
+
+				globalScale = m_scales[slot];
+				if (flags & NodeFlags_InheritScale)
+					globalScale *= parentScale;
+			}
+			else
+			{
+				globalPosition = m_positions[slot];
+				globalRotation = m_rotations[slot];
+				globalScale = m_scales[slot];
+			}
+
+			m_transformMatrices[slot].MakeTransform(globalPosition, globalRotation, globalScale);
+		}
+	}
+
+	constexpr TransformHierarchy::NodeId TransformHierarchy::InvalidNodeId;
+	constexpr UInt32 TransformHierarchy::InvalidSlot;
+}
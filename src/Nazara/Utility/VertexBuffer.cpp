@@ -154,4 +154,6 @@ namespace Nz
 
 		return *this;
 	}
+
+	IndexPool VertexBuffer::s_sortIndexPool;
 }
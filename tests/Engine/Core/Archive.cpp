@@ -0,0 +1,167 @@
+#include <Nazara/Core/Archive.hpp>
+#include <Nazara/Core/ArchiveBuilder.hpp>
+#include <Nazara/Core/Directory.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/MappedFile.hpp>
+#include <Catch/catch.hpp>
+
+#include <cstring>
+#include <vector>
+
+SCENARIO("Archive", "[CORE][ARCHIVE]")
+{
+	GIVEN("An archive built from a few entries")
+	{
+		const char text[] = "Some text which is repeated, some text which is repeated, some text which is repeated.";
+		const std::size_t textSize = sizeof(text) - 1;
+
+		std::vector<Nz::UInt8> binary(1000);
+		for (std::size_t i = 0; i < binary.size(); ++i)
+			binary[i] = static_cast<Nz::UInt8>(i * 7919 % 251);
+
+		Nz::ArchiveBuilder builder;
+		REQUIRE(builder.AddEntry("texts/repeated.txt", text, textSize));
+		REQUIRE(builder.AddEntry("\\data/binary.bin", binary.data(), binary.size(), Nz::ArchiveCompression_None));
+		REQUIRE(builder.AddEntry("empty", nullptr, 0));
+		CHECK(!builder.AddEntry("texts/repeated.txt", text, textSize));
+		CHECK(builder.GetEntryCount() == 3);
+
+		for (unsigned int i = 0; i < 100; ++i)
+			REQUIRE(builder.AddEntry("many/" + Nz::String::Number(i), &i, sizeof(i)));
+
+		REQUIRE(builder.Save("Test Archive.pak"));
+
+		WHEN("We open it")
+		{
+			Nz::Archive archive;
+			REQUIRE(archive.Open("Test Archive.pak"));
+			CHECK(archive.GetEntryCount() == 103);
+
+			THEN("Its entries can be found and read")
+			{
+				const Nz::Archive::Entry* textEntry = archive.FindEntry("texts/repeated.txt");
+				REQUIRE(textEntry);
+				CHECK(textEntry->compression == Nz::ArchiveCompression_LZ);
+				CHECK(textEntry->storedSize < textSize);
+				CHECK(archive.GetEntryPath(*textEntry) == "texts/repeated.txt");
+
+				std::vector<char> textBuffer(textSize);
+				REQUIRE(archive.ReadEntry(*textEntry, textBuffer.data()));
+				CHECK(std::memcmp(textBuffer.data(), text, textSize) == 0);
+
+				const Nz::Archive::Entry* binaryEntry = archive.FindEntry("data/binary.bin");
+				REQUIRE(binaryEntry);
+				CHECK(binaryEntry->compression == Nz::ArchiveCompression_None);
+				CHECK(binaryEntry->offset % 16 == 0);
+				CHECK(std::memcmp(archive.GetEntryData(*binaryEntry), binary.data(), binary.size()) == 0);
+
+				const Nz::Archive::Entry* emptyEntry = archive.FindEntry("empty");
+				REQUIRE(emptyEntry);
+				CHECK(emptyEntry->size == 0);
+
+				for (unsigned int i = 0; i < 100; ++i)
+				{
+					const Nz::Archive::Entry* entry = archive.FindEntry("many/" + Nz::String::Number(i));
+					REQUIRE(entry);
+
+					unsigned int value;
+					REQUIRE(archive.ReadEntry(*entry, &value));
+					CHECK(value == i);
+				}
+
+				CHECK(!archive.FindEntry("texts/missing.txt"));
+				CHECK(!archive.FindEntry("texts"));
+			}
+
+			AND_THEN("Once mounted, its entries can be opened as files")
+			{
+				REQUIRE(archive.Mount("Mounted Archive"));
+				CHECK(archive.IsMounted());
+
+				Nz::String basePath = Nz::Directory::GetCurrent() + NAZARA_DIRECTORY_SEPARATOR + "Mounted Archive" + NAZARA_DIRECTORY_SEPARATOR;
+				CHECK(Nz::MappedFile::Exists(basePath + "texts" + NAZARA_DIRECTORY_SEPARATOR + "repeated.txt"));
+				CHECK(!Nz::MappedFile::Exists(basePath + "texts" + NAZARA_DIRECTORY_SEPARATOR + "missing.txt"));
+
+				Nz::MappedFile textFile(basePath + "texts" + NAZARA_DIRECTORY_SEPARATOR + "repeated.txt");
+				REQUIRE(textFile.Open());
+				REQUIRE(textFile.GetSize() == textSize);
+				CHECK(std::memcmp(textFile.GetData(), text, textSize) == 0);
+				CHECK(textFile.ReadLine() == text);
+
+				Nz::MappedFile binaryFile(basePath + "data" + NAZARA_DIRECTORY_SEPARATOR + "binary.bin");
+				REQUIRE(binaryFile.Open());
+				CHECK(binaryFile.GetData() == archive.GetEntryData(*archive.FindEntry("data/binary.bin")));
+
+				textFile.Close();
+				binaryFile.Close();
+
+				archive.Unmount();
+				CHECK(!Nz::MappedFile::Exists(basePath + "texts" + NAZARA_DIRECTORY_SEPARATOR + "repeated.txt"));
+			}
+		}
+
+		WHEN("A compressed entry claims a size its data cannot decompress to")
+		{
+			std::vector<Nz::UInt8> data;
+			{
+				Nz::File file("Test Archive.pak", Nz::OpenMode_ReadOnly);
+				data.resize(static_cast<std::size_t>(file.GetSize()));
+				REQUIRE(file.Read(data.data(), data.size()) == data.size());
+			}
+
+			// Header: magic, version, entry count, slot count then entry table offset
+			// Entry: path hash, offset, size, stored size, path offset, path size then compression
+			Nz::UInt32 entryCount;
+			Nz::UInt64 entryTableOffset;
+			std::memcpy(&entryCount, &data[8], sizeof(entryCount));
+			std::memcpy(&entryTableOffset, &data[16], sizeof(entryTableOffset));
+
+			bool corrupted = false;
+			for (Nz::UInt32 i = 0; i < entryCount && !corrupted; ++i)
+			{
+				Nz::UInt8* entry = &data[static_cast<std::size_t>(entryTableOffset) + i * 48];
+
+				Nz::UInt32 compression;
+				std::memcpy(&compression, &entry[40], sizeof(compression));
+				if (compression == Nz::ArchiveCompression_LZ)
+				{
+					Nz::UInt64 size = Nz::UInt64(1) << 40;
+					std::memcpy(&entry[16], &size, sizeof(size));
+					corrupted = true;
+				}
+			}
+			REQUIRE(corrupted);
+
+			{
+				Nz::File file("Test Archive.pak", Nz::OpenMode_WriteOnly | Nz::OpenMode_Truncate);
+				REQUIRE(file.Write(data.data(), data.size()) == data.size());
+			}
+
+			Nz::Archive archive;
+
+			THEN("The archive is rejected when opened")
+			{
+				CHECK(!archive.Open("Test Archive.pak"));
+				CHECK(!archive.IsOpen());
+			}
+		}
+
+		WHEN("We try to open a file which is not an archive")
+		{
+			{
+				Nz::File file("Test Archive.pak", Nz::OpenMode_WriteOnly | Nz::OpenMode_Truncate);
+				file.Write(text, textSize);
+			}
+
+			Nz::Archive archive;
+
+			THEN("It fails")
+			{
+				CHECK(!archive.Open("Test Archive.pak"));
+				CHECK(!archive.IsOpen());
+			}
+		}
+
+		Nz::File::Delete("Test Archive.pak");
+	}
+}
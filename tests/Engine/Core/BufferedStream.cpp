@@ -0,0 +1,125 @@
+#include <Nazara/Core/BufferedStream.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/String.hpp>
+#include <Catch/catch.hpp>
+
+#include <array>
+
+SCENARIO("BufferedStream", "[CORE][BUFFEREDSTREAM]")
+{
+	GIVEN("A memory stream containing lines, read through a small buffer")
+	{
+		Nz::String content = "First line\r\nSecond line\n\nA line longer than the read buffer of the stream\nLast line";
+
+		Nz::ByteArray byteArray(content.GetConstBuffer(), content.GetSize());
+		Nz::MemoryStream memoryStream(&byteArray, Nz::OpenMode_ReadOnly);
+		memoryStream.EnableTextMode(true);
+
+		{
+			Nz::BufferedStream bufferedStream(memoryStream, 16);
+
+			WHEN("We read lines")
+			{
+				THEN("Every line is returned without its separator")
+				{
+					CHECK(bufferedStream.ReadLine() == "First line");
+					CHECK(bufferedStream.ReadLine() == "Second line");
+					CHECK(bufferedStream.ReadLine() == "");
+					CHECK(bufferedStream.ReadLine() == "A line longer than the read buffer of the stream");
+					CHECK(bufferedStream.GetCursorPos() == content.Find("Last"));
+					CHECK(bufferedStream.ReadLine() == "Last line");
+					CHECK(bufferedStream.EndOfStream());
+				}
+			}
+
+			WHEN("We read a line with a maximum size")
+			{
+				THEN("The line is cut")
+				{
+					CHECK(bufferedStream.ReadLine(5) == "First");
+					CHECK(bufferedStream.ReadLine() == " line");
+				}
+			}
+
+			WHEN("We read blocks and move the cursor")
+			{
+				std::array<char, 5> buffer;
+				REQUIRE(bufferedStream.Read(buffer.data(), buffer.size()) == buffer.size());
+				CHECK(Nz::String(buffer.data(), buffer.size()) == "First");
+
+				REQUIRE(bufferedStream.SetCursorPos(1));
+				REQUIRE(bufferedStream.Read(buffer.data(), buffer.size()) == buffer.size());
+				CHECK(Nz::String(buffer.data(), buffer.size()) == "irst ");
+
+				REQUIRE(bufferedStream.SetCursorPos(content.Find("Last")));
+
+				THEN("Data is read from the right position")
+				{
+					CHECK(bufferedStream.ReadLine() == "Last line");
+				}
+			}
+		}
+
+		WHEN("The buffered stream is destroyed")
+		{
+			{
+				Nz::BufferedStream bufferedStream(memoryStream, 64);
+				bufferedStream.ReadLine();
+			}
+
+			THEN("The underlying stream is left after the data which has been read")
+			{
+				CHECK(memoryStream.GetCursorPos() == content.Find("Second"));
+			}
+		}
+	}
+
+	GIVEN("A memory stream written through a buffer")
+	{
+		Nz::ByteArray byteArray;
+		Nz::MemoryStream memoryStream(&byteArray, Nz::OpenMode_ReadWrite);
+
+		{
+			Nz::BufferedStream bufferedStream(memoryStream, 16, 16);
+
+			WHEN("We write small blocks")
+			{
+				bufferedStream.Write(Nz::String("Nazara"));
+				bufferedStream.Write(Nz::String(" Engine"));
+
+				THEN("Data is kept until the buffer is full or flushed")
+				{
+					CHECK(bufferedStream.GetCursorPos() == 13);
+					CHECK(memoryStream.GetSize() == 0);
+
+					bufferedStream.Flush();
+					CHECK(memoryStream.GetSize() == 13);
+				}
+			}
+
+			WHEN("We write a block bigger than the buffer")
+			{
+				bufferedStream.Write(Nz::String(64, 'a'));
+
+				THEN("It is written directly")
+				{
+					CHECK(memoryStream.GetSize() == 64);
+				}
+			}
+		}
+
+		WHEN("The buffered stream is destroyed")
+		{
+			{
+				Nz::BufferedStream bufferedStream(memoryStream);
+				bufferedStream.Write(Nz::String("Nazara"));
+			}
+
+			THEN("Pending data is written")
+			{
+				CHECK(byteArray.GetSize() == 6);
+			}
+		}
+	}
+}
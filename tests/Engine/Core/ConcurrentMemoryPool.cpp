@@ -0,0 +1,110 @@
+#include <Nazara/Core/ConcurrentMemoryPool.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Catch/catch.hpp>
+
+#include <Nazara/Math/Vector2.hpp>
+#include <vector>
+
+SCENARIO("ConcurrentMemoryPool", "[CORE][CONCURRENTMEMORYPOOL]")
+{
+	GIVEN("A ConcurrentMemoryPool of Nz::Vector2<int>")
+	{
+		Nz::ConcurrentMemoryPool memoryPool(sizeof(Nz::Vector2<int>), 16);
+
+		WHEN("We construct three vectors")
+		{
+			Nz::Vector2<int>* vector1 = memoryPool.New<Nz::Vector2<int>>(1, 2);
+			Nz::Vector2<int>* vector2 = memoryPool.New<Nz::Vector2<int>>(3, 4);
+			Nz::Vector2<int>* vector3 = memoryPool.New<Nz::Vector2<int>>(5, 6);
+
+			THEN("Memory is available and tracked")
+			{
+				CHECK(*vector1 == Nz::Vector2<int>(1, 2));
+				CHECK(*vector2 == Nz::Vector2<int>(3, 4));
+				CHECK(*vector3 == Nz::Vector2<int>(5, 6));
+				CHECK(memoryPool.GetLiveCount() == 3);
+				CHECK(memoryPool.GetBlockCount() >= 3);
+			}
+
+			AND_THEN("We destroy them")
+			{
+				memoryPool.Delete(vector1);
+				memoryPool.Delete(vector2);
+				memoryPool.Delete(vector3);
+
+				CHECK(memoryPool.GetLiveCount() == 0);
+				CHECK(memoryPool.GetHighWaterMark() >= 3);
+			}
+		}
+
+		WHEN("We allocate more blocks than a slab can hold")
+		{
+			std::size_t blockCount = memoryPool.GetBlocksPerSlab() * 3 + 1;
+
+			std::vector<void*> blocks;
+			for (std::size_t i = 0; i < blockCount; ++i)
+				blocks.push_back(memoryPool.Allocate());
+
+			THEN("The pool grows")
+			{
+				CHECK(memoryPool.GetSlabCount() >= 4);
+				CHECK(memoryPool.GetLiveCount() == blockCount);
+				CHECK(memoryPool.GetHighWaterMark() >= blockCount);
+			}
+
+			for (void* block : blocks)
+				memoryPool.Free(block);
+
+			CHECK(memoryPool.GetLiveCount() == 0);
+		}
+
+		WHEN("Multiple threads allocate and free at the same time")
+		{
+			constexpr std::size_t threadCount = 4;
+			constexpr std::size_t allocationCount = 1000;
+
+			std::vector<std::vector<int*>> results(threadCount);
+			std::vector<Nz::Thread> threads;
+			for (std::size_t i = 0; i < threadCount; ++i)
+			{
+				threads.emplace_back([&memoryPool, &results, i]()
+				{
+					std::vector<int*>& blocks = results[i];
+					for (std::size_t j = 0; j < allocationCount; ++j)
+					{
+						blocks.push_back(memoryPool.New<int>(static_cast<int>(i)));
+
+						// Free some of them right away to exercise the caches
+						if (j % 3 == 0)
+						{
+							memoryPool.Delete(blocks.back());
+							blocks.pop_back();
+						}
+					}
+				});
+			}
+
+			for (Nz::Thread& thread : threads)
+				thread.Join();
+
+			THEN("Every thread got its own blocks")
+			{
+				bool valid = true;
+				for (std::size_t i = 0; i < threadCount; ++i)
+				{
+					for (int* value : results[i])
+						valid &= (*value == static_cast<int>(i));
+				}
+
+				CHECK(valid);
+				CHECK(memoryPool.GetLiveCount() == threadCount * (allocationCount - (allocationCount + 2) / 3));
+			}
+
+			for (auto& blocks : results)
+			{
+				for (int* value : blocks)
+					memoryPool.Delete(value);
+			}
+		}
+	}
+}
@@ -0,0 +1,114 @@
+#include <Nazara/Core/ConcurrentQueue.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Catch/catch.hpp>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+SCENARIO("ConcurrentQueue", "[CORE][CONCURRENTQUEUE]")
+{
+	GIVEN("A ConcurrentQueue of five std::unique_ptr<int>")
+	{
+		Nz::ConcurrentQueue<std::unique_ptr<int>> queue(5);
+
+		THEN("Its capacity is rounded up to a power of two")
+		{
+			CHECK(queue.GetCapacity() == 8);
+		}
+
+		WHEN("We fill it")
+		{
+			for (int i = 0; i < 8; ++i)
+				CHECK(queue.Push(std::make_unique<int>(i)));
+
+			std::unique_ptr<int> extra = std::make_unique<int>(8);
+
+			THEN("It refuses more values and gives them back in order")
+			{
+				CHECK_FALSE(queue.Push(std::move(extra)));
+				CHECK(extra);
+
+				std::unique_ptr<int> value;
+				for (int i = 0; i < 8; ++i)
+				{
+					REQUIRE(queue.Pop(&value));
+					CHECK(*value == i);
+				}
+
+				CHECK_FALSE(queue.Pop(&value));
+			}
+		}
+	}
+
+	GIVEN("Four producers and four consumers sharing a small queue")
+	{
+		constexpr unsigned int threadCount = 4;
+		constexpr unsigned int valuesPerProducer = 20000;
+
+		Nz::ConcurrentQueue<unsigned int> queue(64);
+		std::atomic<unsigned int> poppedCount(0);
+		std::vector<std::vector<unsigned int>> popped(threadCount);
+
+		WHEN("They push and pop concurrently")
+		{
+			std::vector<Nz::Thread> threads;
+			for (unsigned int i = 0; i < threadCount; ++i)
+			{
+				threads.emplace_back([&queue, i]()
+				{
+					for (unsigned int j = 0; j < valuesPerProducer; ++j)
+					{
+						while (!queue.Push(i * valuesPerProducer + j));
+					}
+				});
+
+				threads.emplace_back([&queue, &popped, &poppedCount, i]()
+				{
+					unsigned int value;
+					while (poppedCount.load() < threadCount * valuesPerProducer)
+					{
+						if (queue.Pop(&value))
+						{
+							popped[i].push_back(value);
+							poppedCount++;
+						}
+					}
+				});
+			}
+
+			for (Nz::Thread& thread : threads)
+				thread.Join();
+
+			THEN("Every value was popped once, in the order its producer pushed it")
+			{
+				std::vector<unsigned int> seen(threadCount * valuesPerProducer, 0);
+				bool ordered = true;
+				for (const std::vector<unsigned int>& values : popped)
+				{
+					std::vector<unsigned int> lastValues(threadCount, 0);
+					for (unsigned int value : values)
+					{
+						seen[value]++;
+
+						unsigned int producer = value / valuesPerProducer;
+						if (value + 1 < lastValues[producer])
+							ordered = false;
+
+						lastValues[producer] = value + 1;
+					}
+				}
+
+				bool unique = true;
+				for (unsigned int count : seen)
+				{
+					if (count != 1)
+						unique = false;
+				}
+
+				CHECK(unique);
+				CHECK(ordered);
+			}
+		}
+	}
+}
@@ -0,0 +1,98 @@
+#include <Nazara/Core/FrameArena.hpp>
+#include <Nazara/Core/FrameArenaAllocator.hpp>
+#include <Catch/catch.hpp>
+
+#include <Nazara/Math/Vector2.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+SCENARIO("FrameArena", "[CORE][FRAMEARENA]")
+{
+	GIVEN("A FrameArena with small blocks")
+	{
+		Nz::FrameArena arena(256);
+
+		WHEN("We construct objects")
+		{
+			Nz::Vector2<int>* vector1 = arena.New<Nz::Vector2<int>>(1, 2);
+			Nz::Vector2<int>* vector2 = arena.New<Nz::Vector2<int>>(3, 4);
+
+			THEN("They are allocated next to each other")
+			{
+				CHECK(*vector1 == Nz::Vector2<int>(1, 2));
+				CHECK(*vector2 == Nz::Vector2<int>(3, 4));
+				CHECK(vector2 == vector1 + 1);
+				CHECK(arena.GetUsedMemory() == 2 * sizeof(Nz::Vector2<int>));
+			}
+		}
+
+		WHEN("We allocate with an alignment")
+		{
+			arena.Allocate(1, 1);
+			void* ptr = arena.Allocate(16, 64);
+
+			THEN("The memory is aligned")
+			{
+				CHECK(reinterpret_cast<std::uintptr_t>(ptr) % 64 == 0);
+			}
+		}
+
+		WHEN("We allocate more than a block can hold")
+		{
+			for (unsigned int i = 0; i < 10; ++i)
+				arena.Allocate(100, 1);
+
+			void* bigAllocation = arena.Allocate(1000, 1);
+
+			THEN("The arena grows")
+			{
+				CHECK(bigAllocation);
+				CHECK(arena.GetBlockCount() > 1);
+				CHECK(arena.GetCapacity() >= 2000);
+			}
+
+			AND_THEN("We reset it")
+			{
+				std::size_t capacity = arena.GetCapacity();
+				arena.Reset();
+
+				CHECK(arena.GetUsedMemory() == 0);
+				CHECK(arena.GetBlockCount() == 1);
+				CHECK(arena.GetCapacity() == capacity);
+
+				for (unsigned int i = 0; i < 10; ++i)
+					arena.Allocate(100, 1);
+
+				arena.Allocate(1000, 1);
+				CHECK(arena.GetBlockCount() == 1);
+			}
+		}
+	}
+
+	GIVEN("Containers using a FrameArenaAllocator")
+	{
+		Nz::FrameArena arena;
+
+		std::vector<int, Nz::FrameArenaAllocator<int>> vector(arena);
+		std::unordered_map<int, int, std::hash<int>, std::equal_to<int>, Nz::FrameArenaAllocator<std::pair<const int, int>>> map(arena);
+
+		WHEN("We fill them")
+		{
+			for (int i = 0; i < 1000; ++i)
+			{
+				vector.push_back(i);
+				map.emplace(i, i * 2);
+			}
+
+			THEN("Their content is stored in the arena")
+			{
+				CHECK(vector.size() == 1000);
+				CHECK(vector[500] == 500);
+				CHECK(map.size() == 1000);
+				CHECK(map[500] == 1000);
+				CHECK(arena.GetUsedMemory() >= 1000 * sizeof(int));
+			}
+		}
+	}
+}
@@ -0,0 +1,54 @@
+#include <Nazara/Core/IndexPool.hpp>
+#include <Catch/catch.hpp>
+
+#include <memory>
+
+SCENARIO("IndexPool", "[CORE][INDEXPOOL]")
+{
+	GIVEN("An empty pool")
+	{
+		Nz::IndexPool pool;
+
+		WHEN("We acquire and release indices")
+		{
+			Nz::UInt32 first = pool.Acquire();
+			Nz::UInt32 second = pool.Acquire();
+			Nz::UInt32 third = pool.Acquire();
+
+			pool.Release(third);
+			pool.Release(first);
+
+			THEN("The lowest released index is reused first")
+			{
+				CHECK(first == 0);
+				CHECK(second == 1);
+				CHECK(third == 2);
+				CHECK(pool.GetUsedCount() == 1);
+
+				CHECK(pool.Acquire() == 0);
+				CHECK(pool.Acquire() == 2);
+				CHECK(pool.Acquire() == 3);
+				CHECK(pool.GetCount() == 4);
+			}
+		}
+
+		WHEN("We use Index objects")
+		{
+			std::unique_ptr<Nz::IndexPool::Index> index = std::make_unique<Nz::IndexPool::Index>(pool);
+			Nz::IndexPool::Index copy(*index);
+			Nz::UInt32 copyIndex = copy.Get();
+
+			copy = *index;
+
+			THEN("Each of them holds its own index until destroyed")
+			{
+				CHECK(index->Get() != copy.Get());
+				CHECK(copy.Get() == copyIndex);
+				CHECK(pool.GetUsedCount() == 2);
+
+				index.reset();
+				CHECK(pool.GetUsedCount() == 1);
+			}
+		}
+	}
+}
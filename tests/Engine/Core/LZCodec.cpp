@@ -0,0 +1,89 @@
+#include <Nazara/Core/LZCodec.hpp>
+#include <Catch/catch.hpp>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+SCENARIO("LZCodec", "[CORE][LZCODEC]")
+{
+	GIVEN("Repetitive data")
+	{
+		std::vector<Nz::UInt8> data(100000);
+		for (std::size_t i = 0; i < data.size(); ++i)
+			data[i] = static_cast<Nz::UInt8>("Nazara Engine "[i % 14]);
+
+		WHEN("We compress it")
+		{
+			std::vector<Nz::UInt8> compressed(Nz::LZCodec::GetMaxCompressedSize(data.size()));
+			std::size_t compressedSize = Nz::LZCodec::Compress(data.data(), data.size(), compressed.data(), compressed.size());
+
+			THEN("It gets much smaller and decompresses back to the original data")
+			{
+				REQUIRE(compressedSize > 0);
+				CHECK(compressedSize < data.size() / 50);
+
+				std::vector<Nz::UInt8> decompressed(data.size());
+				REQUIRE(Nz::LZCodec::Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size()) == data.size());
+				CHECK(decompressed == data);
+			}
+
+			AND_THEN("Decompressing into a too small buffer fails")
+			{
+				std::vector<Nz::UInt8> decompressed(data.size() - 1);
+				CHECK(Nz::LZCodec::Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size()) == 0);
+			}
+
+			AND_THEN("Decompressing truncated data fails")
+			{
+				std::vector<Nz::UInt8> decompressed(data.size());
+				CHECK(Nz::LZCodec::Decompress(compressed.data(), compressedSize / 2, decompressed.data(), decompressed.size()) != data.size());
+			}
+		}
+	}
+
+	GIVEN("Random data")
+	{
+		std::mt19937 randomEngine(42);
+		std::uniform_int_distribution<int> byteDistribution(0, 255);
+
+		std::vector<Nz::UInt8> data(70000);
+		for (Nz::UInt8& byte : data)
+			byte = static_cast<Nz::UInt8>(byteDistribution(randomEngine));
+
+		// Some repetitions farther than the maximum offset
+		std::memcpy(&data[66000], &data[10], 1000);
+
+		WHEN("We compress it")
+		{
+			std::vector<Nz::UInt8> compressed(Nz::LZCodec::GetMaxCompressedSize(data.size()));
+			std::size_t compressedSize = Nz::LZCodec::Compress(data.data(), data.size(), compressed.data(), compressed.size());
+
+			THEN("It does not exceed the maximum compressed size and decompresses back to the original data")
+			{
+				REQUIRE(compressedSize > 0);
+				CHECK(compressedSize <= compressed.size());
+
+				std::vector<Nz::UInt8> decompressed(data.size());
+				REQUIRE(Nz::LZCodec::Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size()) == data.size());
+				CHECK(decompressed == data);
+			}
+		}
+	}
+
+	GIVEN("Tiny inputs")
+	{
+		const char text[] = "aaaaaaaaaaaaaaaaaaaab";
+
+		for (std::size_t size = 0; size < sizeof(text); ++size)
+		{
+			std::vector<Nz::UInt8> compressed(Nz::LZCodec::GetMaxCompressedSize(size));
+			std::size_t compressedSize = Nz::LZCodec::Compress(text, size, compressed.data(), compressed.size());
+			REQUIRE(compressedSize > 0);
+
+			std::vector<Nz::UInt8> decompressed(size + 1);
+			CHECK(Nz::LZCodec::Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size()) == size);
+			CHECK(std::memcmp(decompressed.data(), text, size) == 0);
+		}
+	}
+}
@@ -0,0 +1,105 @@
+#include <Nazara/Core/MappedFile.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Catch/catch.hpp>
+
+#include <cstring>
+
+SCENARIO("MappedFile", "[CORE][MAPPEDFILE]")
+{
+	GIVEN("A file on the disk")
+	{
+		const char content[] = "Line one\nLine two\nLine three";
+		const std::size_t contentSize = sizeof(content) - 1;
+
+		{
+			Nz::File file("Mapped File.txt", Nz::OpenMode_WriteOnly | Nz::OpenMode_Truncate);
+			REQUIRE(file.IsOpen());
+			REQUIRE(file.Write(content, contentSize) == contentSize);
+		}
+
+		WHEN("We map it")
+		{
+			Nz::MappedFile mappedFile("Mapped File.txt");
+			CHECK(!mappedFile.IsOpen());
+			REQUIRE(mappedFile.Open());
+
+			THEN("Its content is directly accessible")
+			{
+				CHECK(mappedFile.GetFileName() == "Mapped File.txt");
+				REQUIRE(mappedFile.GetSize() == contentSize);
+				REQUIRE(mappedFile.GetData() != nullptr);
+				CHECK(std::memcmp(mappedFile.GetData(), content, contentSize) == 0);
+			}
+
+			AND_THEN("It can be read as a stream")
+			{
+				CHECK(mappedFile.ReadLine() == "Line one");
+
+				CHECK(mappedFile.Read(nullptr, 5) == 5);
+
+				char buffer[3];
+				REQUIRE(mappedFile.Read(buffer, 3) == 3);
+				CHECK(std::memcmp(buffer, "two", 3) == 0);
+
+				CHECK(mappedFile.SetCursorPos(18));
+				CHECK(mappedFile.ReadLine() == "Line three");
+				CHECK(mappedFile.EndOfStream());
+				CHECK(mappedFile.Read(buffer, 3) == 0);
+
+				CHECK(!mappedFile.SetCursorPos(contentSize + 1));
+				CHECK(mappedFile.GetCursorPos() == contentSize);
+			}
+
+			AND_THEN("It can't be written to")
+			{
+				CHECK(!mappedFile.IsWritable());
+			}
+
+			AND_THEN("We close it")
+			{
+				mappedFile.Close();
+				CHECK(!mappedFile.IsOpen());
+				CHECK(mappedFile.GetData() == nullptr);
+				CHECK(mappedFile.GetSize() == 0);
+			}
+		}
+
+		WHEN("We map an empty file")
+		{
+			{
+				Nz::File file("Mapped File.txt", Nz::OpenMode_WriteOnly | Nz::OpenMode_Truncate);
+				REQUIRE(file.IsOpen());
+			}
+
+			Nz::MappedFile mappedFile;
+
+			THEN("It is open but holds no data")
+			{
+				REQUIRE(mappedFile.Open("Mapped File.txt"));
+				CHECK(mappedFile.GetSize() == 0);
+				CHECK(mappedFile.EndOfStream());
+			}
+		}
+
+		Nz::File::Delete("Mapped File.txt");
+	}
+
+	#ifdef NAZARA_PLATFORM_POSIX
+	GIVEN("A special file")
+	{
+		Nz::MappedFile mappedFile("/dev/zero");
+
+		WHEN("We try to map it")
+		{
+			THEN("It fails, so that it can be read as a regular file instead")
+			{
+				CHECK(!mappedFile.Open());
+				CHECK(!mappedFile.IsOpen());
+
+				Nz::File file("/dev/zero");
+				CHECK(file.Open(Nz::OpenMode_ReadOnly));
+			}
+		}
+	}
+	#endif
+}
@@ -1,7 +1,9 @@
 #include <Nazara/Core/MemoryPool.hpp>
+#include <Nazara/Core/MemoryPoolAllocator.hpp>
 #include <Catch/catch.hpp>
 
 #include <Nazara/Math/Vector2.hpp>
+#include <list>
 
 SCENARIO("MemoryPool", "[CORE][MEMORYPOOL]")
 {
@@ -41,4 +43,45 @@ SCENARIO("MemoryPool", "[CORE][MEMORYPOOL]")
 			}
 		}
 	}
+
+	GIVEN("Two lists allocating their nodes from the same MemoryPool")
+	{
+		// A list node holds two links besides its value
+		Nz::MemoryPool memoryPool(sizeof(Nz::Vector2<int>) + 2 * sizeof(void*), 4);
+
+		using List = std::list<Nz::Vector2<int>, Nz::MemoryPoolAllocator<Nz::Vector2<int>>>;
+		List first(memoryPool);
+		List second(memoryPool);
+
+		WHEN("We fill them")
+		{
+			for (int i = 0; i < 3; ++i)
+			{
+				first.emplace_back(i, i);
+				second.emplace_back(-i, -i);
+			}
+
+			THEN("Their nodes come from the pool, which grows when needed")
+			{
+				CHECK(memoryPool.GetFreeBlocks() == 0);
+				CHECK(first.back() == Nz::Vector2<int>(2, 2));
+				CHECK(second.back() == Nz::Vector2<int>(-2, -2));
+			}
+
+			AND_WHEN("We splice a node from one to the other and clear them")
+			{
+				second.splice(second.end(), first, first.begin());
+				CHECK(first.size() == 2);
+				CHECK(second.back() == Nz::Vector2<int>(0, 0));
+
+				first.clear();
+				second.clear();
+
+				THEN("Every node went back to the pool")
+				{
+					CHECK(memoryPool.GetFreeBlocks() == 4);
+				}
+			}
+		}
+	}
 }
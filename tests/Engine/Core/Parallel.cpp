@@ -0,0 +1,64 @@
+#include <Nazara/Core/Parallel.hpp>
+#include <Catch/catch.hpp>
+
+#include <vector>
+
+SCENARIO("Parallel", "[CORE][PARALLEL]")
+{
+	GIVEN("A vector of integers")
+	{
+		std::vector<unsigned int> values(10000);
+		for (std::size_t i = 0; i < values.size(); ++i)
+			values[i] = static_cast<unsigned int>(i);
+
+		WHEN("We double every value with ParallelFor")
+		{
+			Nz::ParallelFor<std::size_t>(0, values.size(), 128, [&values](std::size_t first, std::size_t last)
+			{
+				for (std::size_t i = first; i < last; ++i)
+					values[i] *= 2;
+			});
+
+			THEN("Every value has been processed exactly once")
+			{
+				bool allDoubled = true;
+				for (std::size_t i = 0; i < values.size(); ++i)
+					allDoubled &= (values[i] == i * 2);
+
+				CHECK(allDoubled);
+			}
+		}
+
+		WHEN("We sum the values with ParallelReduce")
+		{
+			auto sumRange = [&values](std::size_t first, std::size_t last, Nz::UInt64 sum)
+			{
+				for (std::size_t i = first; i < last; ++i)
+					sum += values[i];
+
+				return sum;
+			};
+
+			auto add = [](Nz::UInt64 lhs, Nz::UInt64 rhs) { return lhs + rhs; };
+
+			THEN("We get the same result whatever the grain size is")
+			{
+				CHECK(Nz::ParallelReduce<std::size_t>(0, values.size(), 0, Nz::UInt64(0), sumRange, add) == 49995000);
+				CHECK(Nz::ParallelReduce<std::size_t>(0, values.size(), 1, Nz::UInt64(0), sumRange, add) == 49995000);
+				CHECK(Nz::ParallelReduce<std::size_t>(0, values.size(), 333, Nz::UInt64(0), sumRange, add) == 49995000);
+				CHECK(Nz::ParallelReduce<std::size_t>(0, values.size(), 100000, Nz::UInt64(0), sumRange, add) == 49995000);
+			}
+		}
+
+		WHEN("We give an empty range")
+		{
+			bool called = false;
+			Nz::ParallelFor<std::size_t>(0, 0, 0, [&called](std::size_t, std::size_t) { called = true; });
+
+			THEN("Nothing happens")
+			{
+				CHECK_FALSE(called);
+			}
+		}
+	}
+}
@@ -0,0 +1,193 @@
+#include <Nazara/Core/ResourceFuture.hpp>
+#include <Nazara/Core/RefCounted.hpp>
+#include <Nazara/Core/Resource.hpp>
+#include <Nazara/Core/ResourceManager.hpp>
+#include <Nazara/Core/ResourceParameters.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Catch/catch.hpp>
+
+#include <atomic>
+
+namespace
+{
+	struct TestParams : Nz::ResourceParameters
+	{
+		bool IsValid() const
+		{
+			return true;
+		}
+	};
+
+	class TestResource;
+
+	using TestManager = Nz::ResourceManager<TestResource, TestParams>;
+
+	class TestResource : public Nz::RefCounted, public Nz::Resource
+	{
+		friend TestManager;
+
+		public:
+			TestResource(int value) :
+			RefCounted(false),
+			m_value(value)
+			{
+			}
+
+			int GetValue() const
+			{
+				return m_value;
+			}
+
+			static Nz::ObjectRef<TestResource> LoadFromFile(const Nz::String& filePath, const TestParams& /*parameters*/)
+			{
+				s_loadCount++;
+
+				if (filePath.EndsWith("invalid.res"))
+					return nullptr;
+
+				return new TestResource(42);
+			}
+
+			static std::atomic<unsigned int> s_loadCount;
+
+		private:
+			int m_value;
+
+			static TestManager::ManagerMap s_managerMap;
+			static TestManager::ManagerParams s_managerParameters;
+	};
+
+	std::atomic<unsigned int> TestResource::s_loadCount(0);
+	TestManager::ManagerMap TestResource::s_managerMap;
+	TestManager::ManagerParams TestResource::s_managerParameters;
+}
+
+SCENARIO("ResourceFuture", "[CORE][RESOURCEFUTURE]")
+{
+	GIVEN("A resource loaded asynchronously")
+	{
+		Nz::ResourceFuture<TestResource> future = Nz::ResourceFuture<TestResource>::Async([]()
+		{
+			return Nz::ObjectRef<TestResource>(new TestResource(7));
+		});
+
+		REQUIRE(future.IsValid());
+
+		WHEN("We wait for it")
+		{
+			Nz::ObjectRef<TestResource> resource = future.Get();
+
+			THEN("It has been loaded")
+			{
+				CHECK(future.IsReady());
+				REQUIRE(resource.IsValid());
+				CHECK(resource->GetValue() == 7);
+			}
+		}
+
+		WHEN("We register callbacks")
+		{
+			unsigned int callbackCount = 0;
+			future.Then([&callbackCount](const Nz::ObjectRef<TestResource>& resource)
+			{
+				CHECK(resource->GetValue() == 7);
+				callbackCount++;
+			});
+
+			future.Wait();
+
+			THEN("They are only called from the main thread tasks")
+			{
+				CHECK(callbackCount == 0);
+
+				Nz::TaskScheduler::RunMainThreadTasks();
+				CHECK(callbackCount == 1);
+
+				future.Then([&callbackCount](const Nz::ObjectRef<TestResource>&) { callbackCount++; });
+				CHECK(callbackCount == 1);
+
+				Nz::TaskScheduler::RunMainThreadTasks();
+				CHECK(callbackCount == 2);
+			}
+		}
+	}
+
+	GIVEN("More tasks than workers, each one waiting for a resource it loads asynchronously")
+	{
+		unsigned int taskCount = Nz::TaskScheduler::GetWorkerCount() * 4;
+
+		std::atomic<unsigned int> loadedCount(0);
+
+		Nz::TaskScheduler::Counter counter;
+		for (unsigned int i = 0; i < taskCount; ++i)
+		{
+			Nz::TaskScheduler::Spawn(counter, [&loadedCount, i]()
+			{
+				Nz::ResourceFuture<TestResource> future = Nz::ResourceFuture<TestResource>::Async([i]()
+				{
+					return Nz::ObjectRef<TestResource>(new TestResource(static_cast<int>(i)));
+				});
+
+				if (future.Get()->GetValue() == static_cast<int>(i))
+					loadedCount++;
+			});
+		}
+
+		WHEN("We wait for the tasks")
+		{
+			Nz::TaskScheduler::Wait(counter);
+
+			THEN("Every resource has been loaded, waiting workers loading them themselves")
+			{
+				CHECK(loadedCount == taskCount);
+			}
+		}
+	}
+
+	GIVEN("A resource manager")
+	{
+		TestResource::s_loadCount = 0;
+
+		WHEN("We request the same file several times")
+		{
+			Nz::ResourceFuture<TestResource> first = TestManager::GetAsync("test.res");
+			Nz::ResourceFuture<TestResource> second = TestManager::GetAsync("test.res");
+			Nz::ObjectRef<TestResource> third = TestManager::Get("test.res");
+
+			THEN("It is only loaded once")
+			{
+				CHECK(first.Get() == third);
+				CHECK(second.Get() == third);
+				CHECK(TestResource::s_loadCount == 1);
+			}
+		}
+
+		WHEN("The loading fails")
+		{
+			Nz::ResourceFuture<TestResource> future = TestManager::GetAsync("invalid.res");
+
+			THEN("An invalid resource is returned and the next request tries again")
+			{
+				CHECK(!future.Get().IsValid());
+
+				Nz::ResourceFuture<TestResource> retry = TestManager::GetAsync("invalid.res");
+				CHECK(!retry.Get().IsValid());
+				CHECK(TestResource::s_loadCount == 2);
+			}
+		}
+
+		WHEN("Nobody uses the resources anymore")
+		{
+			TestManager::GetAsync("test.res").Wait();
+			TestManager::Purge();
+
+			THEN("They are purged")
+			{
+				TestManager::GetAsync("test.res").Wait();
+				CHECK(TestResource::s_loadCount == 2);
+			}
+		}
+
+		TestManager::Clear();
+	}
+}
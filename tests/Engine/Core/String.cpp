@@ -142,5 +142,116 @@ SCENARIO("String", "[CORE][STRING]")
 			}
 		}
 	}
-}
 
+	GIVEN("A short string")
+	{
+		Nz::String shortString("Nazara");
+
+		WHEN("We append characters until it does not fit inline anymore")
+		{
+			Nz::String expected("Nazara");
+			for (unsigned int i = 0; i < 100; ++i)
+			{
+				shortString += 'a' + (i % 26);
+				expected = expected + Nz::String('a' + (i % 26));
+			}
+
+			THEN("The content is kept")
+			{
+				CHECK(shortString.GetSize() == 106);
+				CHECK(shortString.GetCapacity() >= 106);
+				CHECK(shortString == expected);
+				CHECK(shortString.StartsWith("Nazaraabc"));
+			}
+		}
+
+		WHEN("We copy and modify the copy")
+		{
+			Nz::String copy(shortString);
+			copy[0] = 'M';
+
+			THEN("Only the copy changes")
+			{
+				CHECK(shortString == "Nazara");
+				CHECK(copy == "Mazara");
+			}
+		}
+
+		WHEN("We insert the string into itself")
+		{
+			shortString.Insert(0, shortString);
+			shortString.Insert(6, shortString);
+			shortString.Insert(12, shortString);
+
+			THEN("The content is duplicated")
+			{
+				CHECK(shortString == Nz::String(8, "Nazara"));
+			}
+		}
+
+		WHEN("We insert parts of its own buffer without growing it")
+		{
+			Nz::String before("abcdef");
+			before.Insert(3, before.GetConstBuffer(), 2);
+
+			Nz::String after("abcdef");
+			after.Insert(1, after.GetConstBuffer() + 3, 2);
+
+			Nz::String across("abcdef");
+			across.Insert(2, across.GetConstBuffer() + 1, 3);
+
+			THEN("The inserted characters are the ones before insertion")
+			{
+				CHECK(before == "abcabdef");
+				CHECK(after == "adebcdef");
+				CHECK(across == "abbcdcdef");
+			}
+		}
+	}
+
+	GIVEN("A long string")
+	{
+		Nz::String longString(10, "Engine");
+
+		WHEN("We move it")
+		{
+			const char* buffer = longString.GetConstBuffer();
+			Nz::String moved(std::move(longString));
+
+			THEN("The buffer is transferred")
+			{
+				CHECK(moved.GetConstBuffer() == buffer);
+				CHECK(moved.GetSize() == 60);
+				CHECK(longString.IsEmpty());
+
+				longString = moved;
+				CHECK(longString == moved);
+			}
+		}
+
+		WHEN("We swap it with a short string")
+		{
+			Nz::String shortString("Nazara");
+			longString.Swap(shortString);
+
+			THEN("Contents are exchanged")
+			{
+				CHECK(longString == "Nazara");
+				CHECK(shortString == Nz::String(10, "Engine"));
+			}
+		}
+
+		WHEN("We clear it while keeping its buffer")
+		{
+			std::size_t capacity = longString.GetCapacity();
+			longString.Clear(true);
+			longString.Set("Nazara");
+
+			THEN("No memory is released")
+			{
+				CHECK(longString == "Nazara");
+				CHECK(longString.GetCapacity() == capacity);
+			}
+		}
+	}
+}
@@ -0,0 +1,93 @@
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Catch/catch.hpp>
+
+#include <array>
+#include <atomic>
+
+SCENARIO("TaskScheduler", "[CORE][TASKSCHEDULER]")
+{
+	GIVEN("The task scheduler")
+	{
+		REQUIRE(Nz::TaskScheduler::Initialize());
+
+		WHEN("We add tasks and run them")
+		{
+			std::atomic<unsigned int> sum(0);
+			for (unsigned int i = 1; i <= 100; ++i)
+				Nz::TaskScheduler::AddTask([&sum, i]() { sum += i; });
+
+			Nz::TaskScheduler::Run();
+			Nz::TaskScheduler::WaitForTasks();
+
+			THEN("Every task has been executed")
+			{
+				CHECK(sum == 5050);
+			}
+		}
+
+		WHEN("We spawn tasks with a counter")
+		{
+			std::atomic<unsigned int> executedTasks(0);
+
+			Nz::TaskScheduler::Counter counter;
+			for (unsigned int i = 0; i < 1000; ++i)
+				Nz::TaskScheduler::Spawn(counter, [&executedTasks]() { executedTasks++; });
+
+			Nz::TaskScheduler::Wait(counter);
+
+			THEN("Every task has been executed")
+			{
+				CHECK(counter.IsDone());
+				CHECK(executedTasks == 1000);
+			}
+		}
+
+		WHEN("Tasks spawn and wait for child tasks")
+		{
+			std::atomic<unsigned int> executedTasks(0);
+
+			Nz::TaskScheduler::Counter counter;
+			for (unsigned int i = 0; i < 16; ++i)
+			{
+				Nz::TaskScheduler::Spawn(counter, [&executedTasks]()
+				{
+					Nz::TaskScheduler::Counter childCounter;
+					for (unsigned int j = 0; j < 16; ++j)
+						Nz::TaskScheduler::Spawn(childCounter, [&executedTasks]() { executedTasks++; });
+
+					Nz::TaskScheduler::Wait(childCounter);
+					executedTasks++;
+				});
+			}
+
+			Nz::TaskScheduler::Wait(counter);
+
+			THEN("Every task has been executed")
+			{
+				CHECK(executedTasks == 16 * 16 + 16);
+			}
+		}
+
+		WHEN("We spawn a task too big to be stored inline")
+		{
+			std::array<unsigned int, 64> values;
+			values.fill(1);
+
+			std::atomic<unsigned int> sum(0);
+
+			Nz::TaskScheduler::Counter counter;
+			Nz::TaskScheduler::Spawn(counter, [values, &sum]()
+			{
+				for (unsigned int value : values)
+					sum += value;
+			});
+
+			Nz::TaskScheduler::Wait(counter);
+
+			THEN("It is executed as well")
+			{
+				CHECK(sum == 64);
+			}
+		}
+	}
+}
@@ -0,0 +1,74 @@
+#include <Nazara/Graphics/FrustumCulling.hpp>
+#include <Catch/catch.hpp>
+
+#include <vector>
+
+SCENARIO("FrustumCulling", "[GRAPHICS][FRUSTUMCULLING]")
+{
+	GIVEN("A frustum, a grid of boxes and a grid of spheres")
+	{
+		Nz::Frustumf frustum;
+		frustum.Build(Nz::FromDegrees(90.f), 1.f, 1.f, 100.f, Nz::Vector3f::Zero(), Nz::Vector3f::UnitX());
+
+		std::vector<Nz::Boxf> boxes;
+		std::vector<Nz::Spheref> spheres;
+
+		// An odd count to get an incomplete last batch
+		for (int x = -20; x < 21; ++x)
+		{
+			for (int y = -20; y < 21; ++y)
+			{
+				boxes.emplace_back(x * 5.f, y * 5.f, 0.f, 1.f + x % 3, 1.f, 1.f);
+				spheres.emplace_back(x * 5.f, y * 5.f, 0.f, 0.5f + (y % 4) * 0.5f);
+			}
+		}
+
+		std::vector<float> boxBounds(Nz::FrustumCulling::GetBoxBoundsSize(boxes.size()));
+		for (std::size_t i = 0; i < boxes.size(); ++i)
+			Nz::FrustumCulling::SetBox(boxBounds.data(), i, boxes[i]);
+
+		std::vector<float> sphereBounds(Nz::FrustumCulling::GetSphereBoundsSize(spheres.size()));
+		for (std::size_t i = 0; i < spheres.size(); ++i)
+			Nz::FrustumCulling::SetSphere(sphereBounds.data(), i, spheres[i]);
+
+		WHEN("We test them by batches")
+		{
+			std::vector<Nz::IntersectionSide> boxSides(boxes.size());
+			Nz::FrustumCulling::IntersectBoxes(frustum, boxBounds.data(), boxes.size(), boxSides.data());
+
+			std::vector<Nz::IntersectionSide> sphereSides(spheres.size());
+			Nz::FrustumCulling::IntersectSpheres(frustum, sphereBounds.data(), spheres.size(), sphereSides.data());
+
+			THEN("Results are the same as testing them one by one")
+			{
+				bool valid = true;
+				for (std::size_t i = 0; i < boxes.size(); ++i)
+				{
+					if (boxSides[i] != frustum.Intersect(boxes[i]) || boxSides[i] != Nz::FrustumCulling::IntersectBox(frustum, boxBounds.data(), i))
+						valid = false;
+				}
+
+				for (std::size_t i = 0; i < spheres.size(); ++i)
+				{
+					if (sphereSides[i] != frustum.Intersect(spheres[i]) || sphereSides[i] != Nz::FrustumCulling::IntersectSphere(frustum, sphereBounds.data(), i))
+						valid = false;
+				}
+
+				CHECK(valid);
+			}
+		}
+
+		WHEN("We copy a box and a sphere over other ones")
+		{
+			Nz::FrustumCulling::CopyBox(boxBounds.data(), boxes.size() - 1, 1);
+			Nz::FrustumCulling::CopySphere(sphereBounds.data(), spheres.size() - 1, 1);
+
+			THEN("They are stored at their new index")
+			{
+				CHECK(Nz::FrustumCulling::GetBox(boxBounds.data(), 1) == Nz::FrustumCulling::GetBox(boxBounds.data(), boxes.size() - 1));
+				CHECK(Nz::FrustumCulling::GetSphere(sphereBounds.data(), 1) == spheres.back());
+				CHECK(Nz::FrustumCulling::GetBox(boxBounds.data(), 0) == boxes.front());
+			}
+		}
+	}
+}
@@ -0,0 +1,86 @@
+#include <Nazara/Graphics/TileMap.hpp>
+#include <Nazara/Graphics/BasicRenderQueue.hpp>
+#include <Nazara/Utility/VertexStruct.hpp>
+#include <Catch/catch.hpp>
+
+#include <vector>
+
+namespace
+{
+	class SpriteRenderQueue : public Nz::BasicRenderQueue
+	{
+		public:
+			void AddSprites(int /*renderOrder*/, const Nz::Material* /*material*/, const Nz::VertexStruct_XYZ_Color_UV* vertices, std::size_t spriteCount, const Nz::Recti& /*scissorRect*/, const Nz::Texture* /*overlay*/) override
+			{
+				for (std::size_t i = 0; i < 4 * spriteCount; ++i)
+					positions.push_back(vertices[i].position);
+			}
+
+			std::vector<Nz::Vector3f> positions;
+	};
+}
+
+SCENARIO("TileMap", "[GRAPHICS][TILEMAP]")
+{
+	GIVEN("A tilemap of several chunks with every tile enabled")
+	{
+		Nz::TileMap tileMap(Nz::Vector2ui(100, 70), Nz::Vector2f(2.f, 2.f), 2);
+		tileMap.EnableTiles(Nz::Rectf(0.f, 0.f, 1.f, 1.f));
+		tileMap.DisableTile(Nz::Vector2ui(5, 5));
+
+		Nz::InstancedRenderable& renderable = tileMap;
+
+		Nz::InstancedRenderable::InstanceData instanceData(Nz::Matrix4f::Identity());
+		instanceData.transformMatrix = Nz::Matrix4f::Translate(Nz::Vector3f(10.f, 0.f, 0.f));
+		renderable.UpdateData(&instanceData);
+
+		WHEN("We add it to a render queue")
+		{
+			SpriteRenderQueue renderQueue;
+			tileMap.AddToRenderQueue(&renderQueue, instanceData, Nz::Recti(-1, -1));
+
+			THEN("Every enabled tile is rendered")
+			{
+				CHECK(renderQueue.positions.size() == 4 * (100 * 70 - 1));
+			}
+		}
+
+		WHEN("We add it to a render queue from a frustum only seeing its first chunk")
+		{
+			Nz::Frustumf frustum;
+			frustum.Extract(Nz::Matrix4f::Identity(), Nz::Matrix4f::Ortho(0.f, 40.f, 0.f, -40.f, -10.f, 10.f));
+
+			SpriteRenderQueue renderQueue;
+			tileMap.AddToRenderQueueByCulling(frustum, &renderQueue, instanceData, Nz::Recti(-1, -1));
+
+			THEN("Only the tiles of this chunk are rendered")
+			{
+				CHECK(renderQueue.positions.size() == 4 * (Nz::TileMap::ChunkSize * Nz::TileMap::ChunkSize - 1));
+			}
+		}
+
+		WHEN("We modify some tiles after the data was generated")
+		{
+			tileMap.EnableTile(Nz::Vector2ui(5, 5), Nz::Rectf(0.f, 0.f, 1.f, 1.f), Nz::Color::Red, 1);
+			tileMap.EnableTile(Nz::Vector2ui(99, 69), Nz::Rectf(0.f, 0.f, 1.f, 1.f), Nz::Color::Red, 1);
+			tileMap.DisableTile(Nz::Vector2ui(40, 40));
+			renderable.UpdateData(&instanceData);
+
+			THEN("Vertices are the same as the ones of a new instance")
+			{
+				Nz::InstancedRenderable::InstanceData newInstanceData(Nz::Matrix4f::Identity());
+				newInstanceData.transformMatrix = instanceData.transformMatrix;
+				renderable.UpdateData(&newInstanceData);
+
+				SpriteRenderQueue renderQueue;
+				tileMap.AddToRenderQueue(&renderQueue, instanceData, Nz::Recti(-1, -1));
+
+				SpriteRenderQueue newRenderQueue;
+				tileMap.AddToRenderQueue(&newRenderQueue, newInstanceData, Nz::Recti(-1, -1));
+
+				CHECK(renderQueue.positions.size() == 4 * (100 * 70 - 1));
+				CHECK(renderQueue.positions == newRenderQueue.positions);
+			}
+		}
+	}
+}
@@ -0,0 +1,99 @@
+#include <Nazara/Math/BoxTree.hpp>
+#include <Catch/catch.hpp>
+
+#include <vector>
+
+SCENARIO("BoxTree", "[MATH][BOXTREE]")
+{
+	GIVEN("A frustum and a tree made of a grid of boxes")
+	{
+		Nz::Frustumf frustum;
+		frustum.Build(Nz::FromDegrees(90.f), 1.f, 1.f, 100.f, Nz::Vector3f::Zero(), Nz::Vector3f::UnitX());
+
+		Nz::BoxTreef tree;
+		std::vector<Nz::Boxf> boxes;
+		std::vector<std::size_t> proxies;
+
+		for (int x = -20; x < 20; ++x)
+		{
+			for (int y = -20; y < 20; ++y)
+			{
+				boxes.emplace_back(x * 5.f, y * 5.f, 0.f, 1.f, 1.f, 1.f);
+				proxies.push_back(tree.Insert(boxes.back(), boxes.size() - 1));
+			}
+		}
+
+		auto CheckQuery = [&]()
+		{
+			std::vector<Nz::IntersectionSide> sides(boxes.size(), Nz::IntersectionSide_Outside);
+			tree.Query(frustum, [&](std::size_t userData, Nz::IntersectionSide side)
+			{
+				sides[userData] = (side == Nz::IntersectionSide_Inside) ? side : frustum.Intersect(boxes[userData]);
+			});
+
+			bool valid = true;
+			for (std::size_t i = 0; i < boxes.size(); ++i)
+			{
+				if (proxies[i] != Nz::BoxTreef::InvalidProxy && sides[i] != frustum.Intersect(boxes[i]))
+					valid = false;
+			}
+
+			return valid;
+		};
+
+		WHEN("We query it")
+		{
+			THEN("Results are the same as testing every box")
+			{
+				CHECK(tree.GetLeafCount() == 1600);
+				CHECK(tree.GetHeight() <= 16);
+				CHECK(CheckQuery());
+			}
+		}
+
+		WHEN("We move and remove some boxes")
+		{
+			for (std::size_t i = 0; i < boxes.size(); i += 3)
+			{
+				boxes[i].x += 50.f;
+				CHECK(tree.Update(proxies[i], boxes[i]));
+			}
+
+			for (std::size_t i = 1; i < boxes.size(); i += 5)
+			{
+				tree.Remove(proxies[i]);
+				proxies[i] = Nz::BoxTreef::InvalidProxy;
+			}
+
+			THEN("Results are still the same as testing every remaining box")
+			{
+				CHECK(tree.GetLeafCount() == 1600 - 320);
+				CHECK(CheckQuery());
+			}
+		}
+
+		WHEN("We update a box within its enlarged box")
+		{
+			Nz::BoxTreef fatTree(0.5f);
+			std::size_t proxy = fatTree.Insert(Nz::Boxf(0.f, 0.f, 0.f, 1.f, 1.f, 1.f), 0);
+
+			THEN("The tree is left untouched")
+			{
+				CHECK_FALSE(fatTree.Update(proxy, Nz::Boxf(0.25f, 0.f, 0.f, 1.f, 1.f, 1.f)));
+				CHECK(fatTree.Update(proxy, Nz::Boxf(1.f, 0.f, 0.f, 1.f, 1.f, 1.f)));
+				CHECK(fatTree.GetBox(proxy).Contains(Nz::Boxf(1.f, 0.f, 0.f, 1.f, 1.f, 1.f)));
+			}
+		}
+
+		WHEN("We clear it")
+		{
+			tree.Clear();
+
+			THEN("It is empty")
+			{
+				CHECK(tree.IsEmpty());
+				CHECK(tree.GetHeight() == 0);
+			}
+		}
+	}
+}
@@ -0,0 +1,300 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/ENetLZCompressor.hpp>
+#include <Nazara/Network/ENetRangeCoderCompressor.hpp>
+#include <Catch/catch.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Outputs of enet_range_coder_compress from ENet 1.3, for inputs split in two buffers like in RoundTrip
+	const char referenceText[] = "ENet range coder: the quick brown fox jumps over the lazy dog, the quick brown fox jumps again!";
+
+	const Nz::UInt8 referenceTextCompressed[] = {
+		0x46, 0x0B, 0x19, 0xB0, 0x7C, 0xDB, 0x6B, 0x26, 0x3E, 0x97, 0x0F, 0x84, 0x93, 0xB1, 0x99, 0xAB,
+		0x10, 0x01, 0xFF, 0x55, 0x43, 0x58, 0xB6, 0x5F, 0x04, 0x13, 0x8E, 0x4F, 0x59, 0x7B, 0x62, 0x8B,
+		0x35, 0x96, 0x99, 0x4B, 0xD7, 0x33, 0xC7, 0x80, 0x5C, 0x8B, 0x81, 0xE8, 0x11, 0x0B, 0x35, 0x51,
+		0x27, 0xE1, 0xC3, 0xBC, 0x82, 0x66, 0xE8, 0xE1, 0x8A, 0xB8, 0xE9, 0xF3, 0xBC, 0xF2, 0xF0, 0xFA,
+		0x9F, 0x9D, 0xE3, 0x80
+	};
+
+	// 20 entities of the snapshot below, followed by 40 bytes of a (i * 7) ramp
+	const Nz::UInt8 referenceSnapshotCompressed[] = {
+		0x01, 0x03, 0xC6, 0x84, 0x7A, 0x81, 0x7D, 0x3B, 0xC7, 0x2B, 0xFF, 0xFF, 0xFE, 0x4F, 0xEC, 0x80,
+		0x6B, 0x57, 0xC4, 0xD7, 0x34, 0x5E, 0xAA, 0xE7, 0x59, 0x97, 0x6E, 0x30, 0xED, 0xCA, 0x1F, 0x81,
+		0x52, 0xAE, 0x95, 0xBA, 0x75, 0x82, 0x43, 0xBC, 0xF2, 0xF7, 0x6E, 0x64, 0x57, 0xD6, 0x2F, 0xCA,
+		0xA7, 0x3D, 0x1F, 0xCF, 0xB4, 0x71, 0x67, 0xCF, 0x88, 0x42, 0x21, 0x24, 0x23, 0xB6, 0x5E, 0xFC,
+		0x32, 0x56, 0x16, 0x0E, 0x5A, 0xA1, 0xC5, 0x51, 0x0B, 0x3C, 0x53, 0x60, 0x51, 0xF7, 0x53, 0x3C,
+		0xDD, 0x96, 0xDD, 0xCA, 0xC5, 0x81, 0xF5, 0xF8, 0xEE, 0x91, 0x53, 0x9A, 0xB6, 0xDF, 0x74, 0x46,
+		0x53, 0xC5, 0x77, 0x39, 0xB7, 0x90, 0x9D, 0x59, 0x47, 0xFD, 0x2C, 0x74, 0x66, 0xD0, 0x7D, 0x61,
+		0xCE, 0x6A, 0x98
+	};
+
+	std::vector<Nz::UInt8> RoundTrip(Nz::ENetCompressor& compressor, std::vector<Nz::UInt8>& data, std::size_t* compressedSize)
+	{
+		// Split the data over several buffers, as ENetHost does with its commands
+		std::size_t half = data.size() / 2;
+		Nz::NetBuffer buffers[2] = { { data.data(), half }, { data.data() + half, data.size() - half } };
+
+		std::vector<Nz::UInt8> compressed(data.size());
+		*compressedSize = compressor.Compress(nullptr, buffers, 2, data.size(), compressed.data(), compressed.size());
+		if (*compressedSize == 0)
+			return {};
+
+		std::vector<Nz::UInt8> decompressed(1400);
+		decompressed.resize(compressor.Decompress(nullptr, compressed.data(), *compressedSize, decompressed.data(), decompressed.size()));
+
+		return decompressed;
+	}
+}
+
+SCENARIO("ENetCompressor", "[NETWORK][ENETCOMPRESSOR]")
+{
+	// Something looking like a state snapshot: entity ids followed by slowly changing positions
+	std::vector<Nz::UInt8> snapshot;
+	for (Nz::UInt8 i = 0; i < 100; ++i)
+	{
+		Nz::UInt8 entity[] = { i, 0, 0, 0, static_cast<Nz::UInt8>(i / 10), 0x42, 0x80, 0x3F, 0, 0, 0x20, 0x41 };
+		snapshot.insert(snapshot.end(), std::begin(entity), std::end(entity));
+	}
+
+	std::mt19937 randomGenerator(42);
+	std::uniform_int_distribution<int> byteDistribution(0, 255);
+
+	std::vector<Nz::UInt8> noise(1000);
+	for (Nz::UInt8& byte : noise)
+		byte = static_cast<Nz::UInt8>(byteDistribution(randomGenerator));
+
+	GIVEN("A range coder compressor")
+	{
+		Nz::ENetRangeCoderCompressor compressor;
+
+		WHEN("We compress and decompress a snapshot")
+		{
+			std::size_t compressedSize;
+			std::vector<Nz::UInt8> decompressed = RoundTrip(compressor, snapshot, &compressedSize);
+
+			THEN("It is smaller and gets back unchanged")
+			{
+				CHECK(compressedSize > 0);
+				CHECK(compressedSize < snapshot.size() / 2);
+				CHECK(decompressed == snapshot);
+			}
+		}
+
+		WHEN("We compress noise in a buffer of the same size")
+		{
+			std::size_t compressedSize;
+			RoundTrip(compressor, noise, &compressedSize);
+
+			THEN("Compression fails")
+			{
+				CHECK(compressedSize == 0);
+			}
+		}
+
+		WHEN("We decompress data compressed by the reference ENet range coder")
+		{
+			std::vector<Nz::UInt8> text(referenceText, referenceText + sizeof(referenceText) - 1);
+
+			std::vector<Nz::UInt8> smallSnapshot(snapshot.begin(), snapshot.begin() + 20 * 12);
+			for (int i = 0; i < 40; ++i)
+				smallSnapshot.push_back(static_cast<Nz::UInt8>(i * 7));
+
+			std::vector<Nz::UInt8> decompressedText(1400);
+			decompressedText.resize(compressor.Decompress(nullptr, referenceTextCompressed, sizeof(referenceTextCompressed), decompressedText.data(), decompressedText.size()));
+
+			std::vector<Nz::UInt8> decompressedSnapshot(1400);
+			decompressedSnapshot.resize(compressor.Decompress(nullptr, referenceSnapshotCompressed, sizeof(referenceSnapshotCompressed), decompressedSnapshot.data(), decompressedSnapshot.size()));
+
+			THEN("We get the original data back, and compress it to the same bytes")
+			{
+				CHECK(decompressedText == text);
+				CHECK(decompressedSnapshot == smallSnapshot);
+
+				auto Compress = [&](std::vector<Nz::UInt8>& data)
+				{
+					std::size_t half = data.size() / 2;
+					Nz::NetBuffer buffers[2] = { { data.data(), half }, { data.data() + half, data.size() - half } };
+
+					std::vector<Nz::UInt8> compressed(data.size());
+					compressed.resize(compressor.Compress(nullptr, buffers, 2, data.size(), compressed.data(), compressed.size()));
+
+					return compressed;
+				};
+
+				CHECK(Compress(text) == std::vector<Nz::UInt8>(std::begin(referenceTextCompressed), std::end(referenceTextCompressed)));
+				CHECK(Compress(smallSnapshot) == std::vector<Nz::UInt8>(std::begin(referenceSnapshotCompressed), std::end(referenceSnapshotCompressed)));
+			}
+		}
+	}
+
+	GIVEN("A LZ compressor")
+	{
+		Nz::ENetLZCompressor compressor;
+
+		WHEN("We compress and decompress a snapshot")
+		{
+			std::size_t compressedSize;
+			std::vector<Nz::UInt8> decompressed = RoundTrip(compressor, snapshot, &compressedSize);
+
+			THEN("It is smaller and gets back unchanged")
+			{
+				CHECK(compressedSize > 0);
+				CHECK(compressedSize < snapshot.size() / 2);
+				CHECK(decompressed == snapshot);
+			}
+		}
+
+		WHEN("We compress noise or a packet smaller than the minimum size")
+		{
+			std::size_t noiseCompressedSize;
+			RoundTrip(compressor, noise, &noiseCompressedSize);
+
+			std::vector<Nz::UInt8> smallPacket(compressor.GetMinimumInputSize() - 1, 0);
+			std::size_t smallCompressedSize;
+			RoundTrip(compressor, smallPacket, &smallCompressedSize);
+
+			THEN("Compression is skipped")
+			{
+				CHECK(noiseCompressedSize == 0);
+				CHECK(smallCompressedSize == 0);
+			}
+		}
+	}
+}
+
+// Hidden benchmark, run it explicitly with the [.benchmark] tag
+SCENARIO("ENetCompressor benchmark", "[NETWORK][ENETCOMPRESSOR][.benchmark]")
+{
+	using Packets = std::vector<std::vector<Nz::UInt8>>;
+
+	std::mt19937 randomGenerator(7);
+
+	// Small reliable commands: ENet command header followed by a short payload, one to three per packet
+	Packets commands;
+	for (int i = 0; i < 5000; ++i)
+	{
+		std::vector<Nz::UInt8> packet;
+
+		unsigned int commandCount = 1 + randomGenerator() % 3;
+		for (unsigned int j = 0; j < commandCount; ++j)
+		{
+			Nz::UInt8 header[] = { 0x86, 0x00, static_cast<Nz::UInt8>(i >> 8), static_cast<Nz::UInt8>(i), 0x00, 0x10 };
+			packet.insert(packet.end(), std::begin(header), std::end(header));
+
+			for (int k = 0; k < 16; ++k)
+				packet.push_back((k < 4) ? static_cast<Nz::UInt8>(randomGenerator()) : static_cast<Nz::UInt8>(k % 3));
+		}
+
+		commands.emplace_back(std::move(packet));
+	}
+
+	// Entity snapshots: id, slowly moving float position, constant rotation and flags
+	Packets snapshots;
+	std::vector<float> positions(3 * 60);
+	for (float& position : positions)
+		position = static_cast<float>(randomGenerator() % 1000);
+
+	for (int i = 0; i < 2000; ++i)
+	{
+		std::vector<Nz::UInt8> packet(12, 0);
+		packet[0] = 0x86;
+
+		for (int entity = 0; entity < 60; ++entity)
+		{
+			if (randomGenerator() % 3 != 0)
+				continue;
+
+			packet.push_back(static_cast<Nz::UInt8>(entity));
+			packet.push_back(0);
+
+			for (int k = 0; k < 3; ++k)
+			{
+				float& position = positions[entity * 3 + k];
+				position += (randomGenerator() % 5) * 0.25f;
+
+				Nz::UInt8 bytes[sizeof(float)];
+				std::memcpy(bytes, &position, sizeof(float));
+				packet.insert(packet.end(), std::begin(bytes), std::end(bytes));
+			}
+
+			Nz::UInt8 tail[] = { 0, 0, 0x80, 0x3F, static_cast<Nz::UInt8>(entity % 4), 0 };
+			packet.insert(packet.end(), std::begin(tail), std::end(tail));
+		}
+
+		snapshots.emplace_back(std::move(packet));
+	}
+
+	auto Benchmark = [](const char* name, Nz::ENetCompressor& compressor, const Packets& packets)
+	{
+		constexpr int passCount = 5;
+
+		std::size_t inputSize = 0;
+		std::size_t outputSize = 0;
+		std::size_t compressedCount = 0;
+		std::vector<std::vector<Nz::UInt8>> compressedPackets;
+
+		std::vector<Nz::UInt8> output(1400);
+		for (const std::vector<Nz::UInt8>& packet : packets)
+		{
+			Nz::NetBuffer buffer = { const_cast<Nz::UInt8*>(packet.data()), packet.size() };
+			std::size_t compressedSize = compressor.Compress(nullptr, &buffer, 1, packet.size(), output.data(), packet.size());
+
+			inputSize += packet.size();
+			if (compressedSize > 0)
+			{
+				outputSize += compressedSize;
+				compressedCount++;
+				compressedPackets.emplace_back(output.begin(), output.begin() + compressedSize);
+			}
+			else
+				outputSize += packet.size(); //< Sent uncompressed
+		}
+
+		Nz::UInt64 start = Nz::GetElapsedMicroseconds();
+		for (int pass = 0; pass < passCount; ++pass)
+		{
+			for (const std::vector<Nz::UInt8>& packet : packets)
+			{
+				Nz::NetBuffer buffer = { const_cast<Nz::UInt8*>(packet.data()), packet.size() };
+				compressor.Compress(nullptr, &buffer, 1, packet.size(), output.data(), packet.size());
+			}
+		}
+		Nz::UInt64 compressionTime = Nz::GetElapsedMicroseconds() - start;
+
+		std::size_t decompressedSize = 0;
+
+		start = Nz::GetElapsedMicroseconds();
+		for (int pass = 0; pass < passCount; ++pass)
+		{
+			for (const std::vector<Nz::UInt8>& compressed : compressedPackets)
+				decompressedSize += compressor.Decompress(nullptr, compressed.data(), compressed.size(), output.data(), output.size());
+		}
+		Nz::UInt64 decompressionTime = Nz::GetElapsedMicroseconds() - start;
+
+		// Bytes per microsecond are megabytes per second
+		WARN(name << ": average input " << inputSize / packets.size() << " B"
+		          << ", ratio " << static_cast<double>(outputSize) / inputSize
+		          << ", compressed " << compressedCount << '/' << packets.size()
+		          << ", compression " << static_cast<double>(inputSize * passCount) / std::max<Nz::UInt64>(compressionTime, 1) << " MB/s"
+		          << ", decompression " << static_cast<double>(decompressedSize) / std::max<Nz::UInt64>(decompressionTime, 1) << " MB/s");
+	};
+
+	GIVEN("Synthetic captures of small reliable commands and entity snapshots")
+	{
+		Nz::ENetRangeCoderCompressor rangeCoder;
+		Benchmark("Range coder, commands", rangeCoder, commands);
+		Benchmark("Range coder, snapshots", rangeCoder, snapshots);
+
+		Nz::ENetLZCompressor lz;
+		Benchmark("LZ, commands", lz, commands);
+		Benchmark("LZ, snapshots", lz, snapshots);
+
+		Nz::ENetLZCompressor lzWithoutMinimum(0);
+		Benchmark("LZ without minimum input size, commands", lzWithoutMinimum, commands);
+	}
+}
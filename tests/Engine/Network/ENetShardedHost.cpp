@@ -0,0 +1,211 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <Catch/catch.hpp>
+
+#include <functional>
+#include <vector>
+
+SCENARIO("ENetShardedHost", "[NETWORK][ENETSHARDEDHOST]")
+{
+	GIVEN("A dual-stack sharded host with four shards and eight IPv4 clients")
+	{
+		constexpr std::size_t clientCount = 8;
+
+		Nz::ENetShardedHost server;
+		REQUIRE(server.Create(Nz::NetProtocol_Any, 0, 4, clientCount));
+		CHECK(server.GetShardCount() == 4);
+
+		Nz::IpAddress serverAddress = Nz::IpAddress::LoopbackIpV4;
+		serverAddress.SetPort(server.GetBoundAddress().GetPort());
+		REQUIRE(serverAddress.GetPort() != 0);
+
+		std::vector<Nz::ENetHost> clients(clientCount);
+		std::vector<Nz::ENetPeer*> clientPeers(clientCount);
+		std::vector<std::vector<Nz::ENetEvent>> clientEvents(clientCount);
+		std::vector<Nz::ENetShardedEvent> serverEvents;
+
+		for (std::size_t i = 0; i < clientCount; ++i)
+		{
+			REQUIRE(clients[i].Create(Nz::IpAddress::LoopbackIpV4, 1));
+			clientPeers[i] = clients[i].Connect(serverAddress);
+			REQUIRE(clientPeers[i]);
+		}
+
+		// Services clients and polls the server until the condition is met (or too much time passed)
+		auto Run = [&](const std::function<bool()>& condition, Nz::UInt64 timeout = 5000)
+		{
+			Nz::UInt64 startTime = Nz::GetElapsedMilliseconds();
+			while (!condition() && Nz::GetElapsedMilliseconds() - startTime < timeout)
+			{
+				Nz::ENetEvent event;
+				for (std::size_t i = 0; i < clientCount; ++i)
+				{
+					if (clients[i].Service(&event, 1) > 0)
+					{
+						do
+						{
+							clientEvents[i].emplace_back(std::move(event));
+						}
+						while (clients[i].CheckEvents(&event));
+					}
+				}
+
+				Nz::ENetShardedEvent serverEvent;
+				while (server.PollEvent(&serverEvent))
+					serverEvents.emplace_back(std::move(serverEvent));
+			}
+
+			return condition();
+		};
+
+		auto CountServerEvents = [&](Nz::ENetEventType type)
+		{
+			std::size_t count = 0;
+			for (const Nz::ENetShardedEvent& event : serverEvents)
+			{
+				if (event.type == type)
+					count++;
+			}
+
+			return count;
+		};
+
+		auto CountClientEvents = [&](Nz::ENetEventType type)
+		{
+			std::size_t count = 0;
+			for (const std::vector<Nz::ENetEvent>& events : clientEvents)
+			{
+				for (const Nz::ENetEvent& event : events)
+				{
+					if (event.type == type)
+						count++;
+				}
+			}
+
+			return count;
+		};
+
+		REQUIRE(Run([&]() { return CountServerEvents(Nz::ENetEventType::IncomingConnect) == clientCount && CountClientEvents(Nz::ENetEventType::OutgoingConnect) == clientCount; }));
+
+		std::vector<Nz::ENetShardedPeer> serverPeers;
+		for (const Nz::ENetShardedEvent& event : serverEvents)
+		{
+			CHECK(event.peer.shardIndex < 4);
+			serverPeers.push_back(event.peer);
+		}
+
+		serverEvents.clear();
+
+		WHEN("Clients send a packet")
+		{
+			for (std::size_t i = 0; i < clientCount; ++i)
+			{
+				Nz::NetPacket packet(1);
+				packet << static_cast<Nz::UInt32>(i);
+				clientPeers[i]->Send(0, Nz::ENetPacketFlag_Reliable, std::move(packet));
+			}
+
+			THEN("The server receives them and can answer to each one")
+			{
+				REQUIRE(Run([&]() { return CountServerEvents(Nz::ENetEventType::Receive) == clientCount; }));
+
+				for (Nz::ENetShardedEvent& event : serverEvents)
+				{
+					Nz::UInt32 value;
+					event.packet >> value;
+
+					Nz::NetPacket answer(2);
+					answer << value * 2;
+					server.Send(event.peer, 0, Nz::ENetPacketFlag_Reliable, std::move(answer));
+				}
+
+				REQUIRE(Run([&]() { return CountClientEvents(Nz::ENetEventType::Receive) == clientCount; }));
+
+				for (std::size_t i = 0; i < clientCount; ++i)
+				{
+					for (Nz::ENetEvent& event : clientEvents[i])
+					{
+						if (event.type != Nz::ENetEventType::Receive)
+							continue;
+
+						Nz::UInt32 value;
+						event.packet->data >> value;
+						CHECK(value == i * 2);
+					}
+				}
+			}
+		}
+
+		WHEN("The server broadcasts a packet")
+		{
+			Nz::NetPacket packet(3);
+			packet << Nz::UInt32(42);
+			server.Broadcast(0, Nz::ENetPacketFlag_Reliable, std::move(packet));
+
+			THEN("Every client receives it")
+			{
+				REQUIRE(Run([&]() { return CountClientEvents(Nz::ENetEventType::Receive) == clientCount; }));
+
+				for (std::vector<Nz::ENetEvent>& events : clientEvents)
+				{
+					for (Nz::ENetEvent& event : events)
+					{
+						if (event.type != Nz::ENetEventType::Receive)
+							continue;
+
+						Nz::UInt32 value;
+						event.packet->data >> value;
+						CHECK(value == 42);
+					}
+				}
+			}
+		}
+
+		WHEN("The server disconnects a peer")
+		{
+			server.Disconnect(serverPeers.front(), 7);
+
+			THEN("Both sides get a disconnection event")
+			{
+				REQUIRE(Run([&]() { return CountServerEvents(Nz::ENetEventType::Disconnect) == 1 && CountClientEvents(Nz::ENetEventType::Disconnect) == 1; }));
+
+				CHECK(serverEvents.front().peer.connectId == serverPeers.front().connectId);
+				CHECK(serverEvents.front().peer.peerId == serverPeers.front().peerId);
+				CHECK(serverEvents.front().peer.shardIndex == serverPeers.front().shardIndex);
+
+				AND_THEN("Sending to it afterwards is ignored")
+				{
+					std::size_t disconnectedClient = clientCount;
+					for (std::size_t i = 0; i < clientCount; ++i)
+					{
+						for (const Nz::ENetEvent& event : clientEvents[i])
+						{
+							if (event.type == Nz::ENetEventType::Disconnect)
+								disconnectedClient = i;
+						}
+					}
+					REQUIRE(disconnectedClient < clientCount);
+
+					serverEvents.clear();
+
+					server.Send(serverPeers.front(), 0, Nz::ENetPacketFlag_Reliable, Nz::NetPacket(4));
+					server.Disconnect(serverPeers.front());
+
+					// A packet sent to a connected peer afterwards tells us when the server went past the stale commands
+					server.Send(serverPeers.back(), 0, Nz::ENetPacketFlag_Reliable, Nz::NetPacket(5));
+
+					REQUIRE(Run([&]() { return CountClientEvents(Nz::ENetEventType::Receive) == 1; }));
+					Run([]() { return false; }, 200);
+
+					CHECK(CountClientEvents(Nz::ENetEventType::Receive) == 1);
+					CHECK(CountClientEvents(Nz::ENetEventType::Disconnect) == 1);
+
+					for (const Nz::ENetEvent& event : clientEvents[disconnectedClient])
+						CHECK(event.type != Nz::ENetEventType::Receive);
+
+					CHECK(serverEvents.empty());
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,105 @@
+#include <Nazara/Network/NetPacket.hpp>
+#include <Catch/catch.hpp>
+
+#include <thread>
+#include <vector>
+
+SCENARIO("NetPacket", "[NETWORK][NETPACKET]")
+{
+	GIVEN("A packet written then destroyed")
+	{
+		{
+			Nz::NetPacket packet(42, 100);
+			packet << Nz::UInt32(0xDEADBEEF);
+		}
+
+		WHEN("We create packets of the same size")
+		{
+			Nz::NetPacket::BufferStats before = Nz::NetPacket::GetBufferStats();
+
+			for (int i = 0; i < 10; ++i)
+			{
+				Nz::NetPacket packet(42, 100);
+				packet << Nz::UInt32(i);
+			}
+
+			Nz::NetPacket::BufferStats after = Nz::NetPacket::GetBufferStats();
+
+			THEN("Their buffer is recycled")
+			{
+				CHECK(after.allocatedBuffers == before.allocatedBuffers);
+				CHECK(after.cachedReuses == before.cachedReuses + 10);
+			}
+		}
+
+		WHEN("We create a packet too big to be recycled")
+		{
+			Nz::NetPacket::BufferStats before = Nz::NetPacket::GetBufferStats();
+
+			{
+				Nz::NetPacket packet(42, 1024 * 1024);
+				packet << Nz::UInt32(0xDEADBEEF);
+			}
+
+			Nz::NetPacket::BufferStats after = Nz::NetPacket::GetBufferStats();
+
+			THEN("Its buffer is freed")
+			{
+				CHECK(after.allocatedBuffers == before.allocatedBuffers + 1);
+				CHECK(after.freedBuffers == before.freedBuffers + 1);
+			}
+		}
+	}
+
+	GIVEN("Packets released by a thread and reused by others")
+	{
+		std::vector<Nz::NetPacket> packets(Nz::NetPacket::BufferCacheSize * 4);
+		for (Nz::NetPacket& packet : packets)
+			packet.Reset(1, 500);
+
+		std::thread releaser([&]() { packets.clear(); });
+		releaser.join();
+
+		WHEN("Other threads create packets")
+		{
+			Nz::NetPacket::BufferStats before = Nz::NetPacket::GetBufferStats();
+
+			std::vector<std::thread> threads;
+			std::vector<int> results(4, 0);
+			for (std::size_t i = 0; i < results.size(); ++i)
+			{
+				threads.emplace_back([&, i]()
+				{
+					bool valid = true;
+					for (Nz::UInt32 j = 0; j < 1000; ++j)
+					{
+						Nz::NetPacket packet(2, 300 + j % 200);
+						packet << j;
+
+						Nz::NetPacket received(packet.GetNetCode(), packet.GetConstData() + Nz::NetPacket::HeaderSize, packet.GetDataSize());
+						Nz::UInt32 value;
+						received >> value;
+						if (value != j)
+							valid = false;
+					}
+
+					results[i] = (valid) ? 1 : 0;
+				});
+			}
+
+			for (std::thread& thread : threads)
+				thread.join();
+
+			Nz::NetPacket::BufferStats after = Nz::NetPacket::GetBufferStats();
+
+			THEN("Packets are valid and buffers come from the shared pool")
+			{
+				for (int valid : results)
+					CHECK(valid == 1);
+
+				CHECK(after.sharedReuses > before.sharedReuses);
+				CHECK(after.allocatedBuffers - before.allocatedBuffers < 4 * 1000);
+			}
+		}
+	}
+}
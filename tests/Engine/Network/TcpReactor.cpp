@@ -0,0 +1,162 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/NetPacket.hpp>
+#include <Nazara/Network/TcpClient.hpp>
+#include <Nazara/Network/TcpReactor.hpp>
+#include <Catch/catch.hpp>
+#include <functional>
+#include <random>
+#include <vector>
+
+SCENARIO("TcpReactor", "[NETWORK][TCPREACTOR]")
+{
+	GIVEN("A listening reactor echoing packets and a reactor connected to it")
+	{
+		std::random_device rd;
+		std::uniform_int_distribution<Nz::UInt16> dis(1025, 65535);
+
+		Nz::UInt16 port = dis(rd);
+
+		// A small receive buffer to exercise wrapping and packets received in place
+		Nz::TcpReactor server(256, 64 * 1024);
+		REQUIRE(server.Listen(Nz::NetProtocol_IPv4, port) == Nz::SocketState_Bound);
+
+		std::size_t acceptedCount = 0;
+		std::vector<Nz::SocketError> serverDisconnections;
+		server.OnConnected.Connect([&](Nz::TcpReactor*, std::size_t) { acceptedCount++; });
+		server.OnDisconnected.Connect([&](Nz::TcpReactor*, std::size_t, Nz::SocketError error) { serverDisconnections.push_back(error); });
+		server.OnPacketReceived.Connect([&](Nz::TcpReactor* reactor, std::size_t connectionId, Nz::NetPacket& packet)
+		{
+			reactor->Send(connectionId, packet);
+		});
+
+		Nz::IpAddress serverIP(Nz::IpAddress::LoopbackIpV4.ToIPv4(), port);
+
+		constexpr std::size_t clientCount = 8;
+
+		Nz::TcpReactor client;
+		std::vector<std::size_t> connections;
+		for (std::size_t i = 0; i < clientCount; ++i)
+		{
+			Nz::TcpClient tcpClient;
+			tcpClient.Connect(serverIP);
+			REQUIRE(tcpClient.WaitForConnected(1000) == Nz::SocketState_Connected);
+
+			connections.push_back(client.AddClient(std::move(tcpClient)));
+			CHECK(client.IsConnected(connections.back()));
+		}
+
+		auto Pump = [&](const std::function<bool()>& condition)
+		{
+			Nz::UInt64 start = Nz::GetElapsedMilliseconds();
+			while (!condition() && Nz::GetElapsedMilliseconds() - start < 5000)
+			{
+				server.Update(1);
+				client.Update(1);
+			}
+
+			return condition();
+		};
+
+		REQUIRE(Pump([&]() { return acceptedCount == clientCount; }));
+		CHECK(server.GetConnectionCount() == clientCount);
+		CHECK(client.GetConnectionCount() == clientCount);
+
+		WHEN("Clients send packets of various sizes")
+		{
+			const std::vector<std::size_t> sizes = { 0, 1, 100, 250, 251, 1000, 20000 };
+
+			std::vector<std::vector<Nz::NetPacket>> receivedPackets(clientCount);
+			client.OnPacketReceived.Connect([&](Nz::TcpReactor*, std::size_t connectionId, Nz::NetPacket& packet)
+			{
+				receivedPackets[connectionId].emplace_back(std::move(packet));
+			});
+
+			for (std::size_t i = 0; i < clientCount; ++i)
+			{
+				for (int repeat = 0; repeat < 10; ++repeat)
+				{
+					for (std::size_t size : sizes)
+					{
+						Nz::NetPacket packet(static_cast<Nz::UInt16>(size), size);
+						for (std::size_t j = 0; j < size; ++j)
+							packet.GetData()[Nz::NetPacket::HeaderSize + j] = static_cast<Nz::UInt8>(i + j);
+
+						CHECK(client.Send(connections[i], std::move(packet)));
+					}
+				}
+			}
+
+			std::size_t expectedCount = 10 * sizes.size();
+			bool received = Pump([&]()
+			{
+				for (const auto& packets : receivedPackets)
+				{
+					if (packets.size() < expectedCount)
+						return false;
+				}
+
+				return true;
+			});
+
+			THEN("They are echoed back in order and unchanged")
+			{
+				REQUIRE(received);
+
+				bool valid = true;
+				for (std::size_t i = 0; i < clientCount; ++i)
+				{
+					if (receivedPackets[i].size() != expectedCount)
+						valid = false;
+
+					for (std::size_t j = 0; j < receivedPackets[i].size(); ++j)
+					{
+						const Nz::NetPacket& packet = receivedPackets[i][j];
+
+						std::size_t size = sizes[j % sizes.size()];
+						if (packet.GetNetCode() != size || packet.GetDataSize() != size)
+						{
+							valid = false;
+							continue;
+						}
+
+						for (std::size_t k = 0; k < size; ++k)
+						{
+							if (packet.GetConstData()[Nz::NetPacket::HeaderSize + k] != static_cast<Nz::UInt8>(i + k))
+								valid = false;
+						}
+					}
+				}
+
+				CHECK(valid);
+			}
+		}
+
+		WHEN("A client sends a packet over the maximum size")
+		{
+			CHECK(client.Send(connections[0], Nz::NetPacket(1, 64 * 1024)));
+
+			THEN("Server closes the connection")
+			{
+				REQUIRE(Pump([&]() { return serverDisconnections.size() == 1 && !client.IsConnected(connections[0]); }));
+				CHECK(serverDisconnections[0] == Nz::SocketError_Packet);
+				CHECK(server.GetConnectionCount() == clientCount - 1);
+			}
+		}
+
+		WHEN("Clients disconnect")
+		{
+			client.Disconnect(connections[1]);
+			client.Close();
+
+			THEN("Server is notified")
+			{
+				CHECK_FALSE(client.IsConnected(connections[1]));
+				CHECK(client.GetConnectionCount() == 0);
+
+				REQUIRE(Pump([&]() { return serverDisconnections.size() == clientCount; }));
+				CHECK(server.GetConnectionCount() == 0);
+				CHECK(serverDisconnections[0] == Nz::SocketError_ConnectionClosed);
+			}
+		}
+	}
+}
@@ -1,7 +1,9 @@
 #include <Nazara/Math/Vector3.hpp>
 #include <Nazara/Network/UdpSocket.hpp>
 #include <Nazara/Network/NetPacket.hpp>
+#include <Nazara/Network/UdpDatagram.hpp>
 #include <Catch/catch.hpp>
+#include <array>
 #include <random>
 
 SCENARIO("UdpSocket", "[NETWORK][UDPSOCKET]")
@@ -42,5 +44,57 @@ SCENARIO("UdpSocket", "[NETWORK][UDPSOCKET]")
 				REQUIRE(result == vector123);
 			}
 		}
+
+		WHEN("We send multiple datagrams at once from client")
+		{
+			std::array<Nz::UInt32, 8> values;
+			std::array<Nz::NetBuffer, 8> buffers;
+			std::array<Nz::UdpDatagram, 8> datagrams;
+			for (std::size_t i = 0; i < datagrams.size(); ++i)
+			{
+				values[i] = static_cast<Nz::UInt32>(i * 42);
+				buffers[i].data = &values[i];
+				buffers[i].dataLength = sizeof(Nz::UInt32);
+
+				datagrams[i].address = serverIP;
+				datagrams[i].buffers = &buffers[i];
+				datagrams[i].bufferCount = 1;
+			}
+
+			std::size_t sent;
+			REQUIRE(client.SendDatagrams(datagrams.data(), datagrams.size(), &sent));
+			REQUIRE(sent == datagrams.size());
+
+			THEN("We should get all of them on the server, in order")
+			{
+				std::array<Nz::UInt32, 16> results;
+				std::array<Nz::NetBuffer, 16> resultBuffers;
+				std::array<Nz::UdpDatagram, 16> resultDatagrams;
+				for (std::size_t i = 0; i < resultDatagrams.size(); ++i)
+				{
+					resultBuffers[i].data = &results[i];
+					resultBuffers[i].dataLength = sizeof(Nz::UInt32);
+
+					resultDatagrams[i].buffers = &resultBuffers[i];
+					resultDatagrams[i].bufferCount = 1;
+				}
+
+				std::size_t received = 0;
+				while (received < datagrams.size())
+				{
+					std::size_t receivedCount;
+					REQUIRE(server.ReceiveDatagrams(&resultDatagrams[received], resultDatagrams.size() - received, &receivedCount));
+					received += receivedCount;
+				}
+
+				REQUIRE(received == datagrams.size());
+				for (std::size_t i = 0; i < received; ++i)
+				{
+					CHECK(resultDatagrams[i].address.GetPort() == clientIP.GetPort());
+					CHECK(resultDatagrams[i].dataLength == sizeof(Nz::UInt32));
+					CHECK(results[i] == values[i]);
+				}
+			}
+		}
 	}
 }
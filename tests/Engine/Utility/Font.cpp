@@ -0,0 +1,121 @@
+#include <Nazara/Utility/Font.hpp>
+#include <Nazara/Utility/SimpleTextDrawer.hpp>
+#include <Catch/catch.hpp>
+
+#include <vector>
+
+SCENARIO("Font", "[UTILITY][FONT]")
+{
+	GIVEN("The default font with an empty glyph cache")
+	{
+		const Nz::FontRef& font = Nz::Font::GetDefault();
+		REQUIRE(font.IsValid());
+
+		font->ClearGlyphCache();
+		REQUIRE(font->GetCachedGlyphCount() == 0);
+
+		WHEN("We query more non Latin-1 glyphs than the cache initially holds")
+		{
+			// Glyph cache starts with 256 slots and is rehashed past a load factor of one half
+			std::vector<const Nz::Font::Glyph*> glyphs;
+			for (char32_t character = 0x100; character < 0x100 + 600; ++character)
+				glyphs.push_back(&font->GetGlyph(24, Nz::TextStyle_Regular, 0.f, character));
+
+			THEN("Every glyph is cached once and keeps its address through rehashing")
+			{
+				CHECK(font->GetCachedGlyphCount() == 600);
+				CHECK(font->GetCachedGlyphCount(24, Nz::TextStyle_Regular, 0.f) == 600);
+				CHECK(font->GetCachedGlyphCount(12, Nz::TextStyle_Regular, 0.f) == 0);
+
+				bool sameGlyphs = true;
+				for (char32_t character = 0x100; character < 0x100 + 600; ++character)
+				{
+					if (&font->GetGlyph(24, Nz::TextStyle_Regular, 0.f, character) != glyphs[character - 0x100])
+						sameGlyphs = false;
+				}
+
+				CHECK(sameGlyphs);
+			}
+		}
+
+		WHEN("We query a string mixing Latin-1 and non Latin-1 characters at once")
+		{
+			std::u32string characters = U"Café €Ω Café";
+
+			std::vector<const Nz::Font::Glyph*> glyphs(characters.size());
+			font->GetGlyphs(16, Nz::TextStyle_Regular, 0.f, characters.data(), characters.size(), glyphs.data());
+
+			THEN("Glyphs are the ones returned one by one, each character being cached once")
+			{
+				bool sameGlyphs = true;
+				for (std::size_t i = 0; i < characters.size(); ++i)
+				{
+					if (glyphs[i] != &font->GetGlyph(16, Nz::TextStyle_Regular, 0.f, characters[i]))
+						sameGlyphs = false;
+				}
+
+				CHECK(sameGlyphs);
+
+				// C, a, f, é, space, €, Ω
+				CHECK(font->GetCachedGlyphCount(16, Nz::TextStyle_Regular, 0.f) == 7);
+				CHECK(font->GetCachedGlyphCount() == 7);
+			}
+
+			AND_WHEN("We clear the glyph cache")
+			{
+				font->ClearGlyphCache();
+
+				THEN("Every size and style is emptied, and glyphs get cached again")
+				{
+					CHECK(font->GetCachedGlyphCount() == 0);
+					CHECK(font->GetCachedGlyphCount(16, Nz::TextStyle_Regular, 0.f) == 0);
+
+					font->GetGlyphs(16, Nz::TextStyle_Regular, 0.f, characters.data(), characters.size(), glyphs.data());
+					CHECK(font->GetCachedGlyphCount(16, Nz::TextStyle_Regular, 0.f) == 7);
+					CHECK(glyphs[3] == &font->GetGlyph(16, Nz::TextStyle_Regular, 0.f, U'é'));
+					CHECK(glyphs[6] == &font->GetGlyph(16, Nz::TextStyle_Regular, 0.f, U'Ω'));
+				}
+			}
+		}
+
+		WHEN("We query many kerning pairs")
+		{
+			std::vector<int> kernings;
+			for (char32_t first = 'A'; first <= 'Z'; ++first)
+			{
+				for (char32_t second = 'a'; second <= 'z'; ++second)
+					kernings.push_back(font->GetKerning(24, first, second));
+			}
+
+			THEN("Cached kernings match the first queries")
+			{
+				bool sameKernings = true;
+				std::size_t i = 0;
+				for (char32_t first = 'A'; first <= 'Z'; ++first)
+				{
+					for (char32_t second = 'a'; second <= 'z'; ++second)
+					{
+						if (font->GetKerning(24, first, second) != kernings[i++])
+							sameKernings = false;
+					}
+				}
+
+				CHECK(sameKernings);
+			}
+		}
+
+		WHEN("We draw a text with a SimpleTextDrawer")
+		{
+			Nz::SimpleTextDrawer drawer = Nz::SimpleTextDrawer::Draw(font, Nz::String::Unicode(U"naïve Ω\tnaïve\n"), 20);
+
+			THEN("Every character has its glyph, only the ones of words being cached")
+			{
+				CHECK(drawer.GetGlyphCount() == 14);
+				CHECK(drawer.GetLineCount() == 2);
+
+				// n, a, ï, v, e, Ω
+				CHECK(font->GetCachedGlyphCount(20, Nz::TextStyle_Regular, 0.f) == 6);
+			}
+		}
+	}
+}
@@ -0,0 +1,172 @@
+#include <Nazara/Utility/TransformHierarchy.hpp>
+#include <Nazara/Utility/Node.hpp>
+#include <Catch/catch.hpp>
+
+#include <memory>
+#include <vector>
+
+SCENARIO("TransformHierarchy", "[UTILITY][TRANSFORMHIERARCHY]")
+{
+	GIVEN("A hierarchy of three nodes")
+	{
+		Nz::TransformHierarchy hierarchy;
+
+		Nz::TransformHierarchy::NodeId root = hierarchy.CreateNode();
+		Nz::TransformHierarchy::NodeId child = hierarchy.CreateNode(root);
+		Nz::TransformHierarchy::NodeId grandChild = hierarchy.CreateNode(child);
+
+		REQUIRE(hierarchy.GetNodeCount() == 3);
+		REQUIRE(hierarchy.GetParent(grandChild) == child);
+
+		hierarchy.SetPosition(root, Nz::Vector3f::UnitX());
+		hierarchy.SetPosition(child, Nz::Vector3f::UnitY());
+		hierarchy.SetPosition(grandChild, Nz::Vector3f::UnitZ());
+		hierarchy.Update();
+
+		WHEN("We read the global positions")
+		{
+			THEN("They are accumulated along the hierarchy")
+			{
+				CHECK(hierarchy.GetPosition(grandChild, Nz::CoordSys_Local) == Nz::Vector3f::UnitZ());
+				CHECK(hierarchy.GetPosition(grandChild, Nz::CoordSys_Global) == Nz::Vector3f(1.f, 1.f, 1.f));
+				CHECK(hierarchy.GetTransformMatrix(grandChild).GetTranslation() == Nz::Vector3f(1.f, 1.f, 1.f));
+			}
+		}
+
+		WHEN("We move the root")
+		{
+			hierarchy.SetPosition(root, Nz::Vector3f(2.f, 0.f, 0.f));
+			hierarchy.Update();
+
+			THEN("Its descendants are updated as well")
+			{
+				CHECK(hierarchy.GetPosition(child, Nz::CoordSys_Global) == Nz::Vector3f(2.f, 1.f, 0.f));
+				CHECK(hierarchy.GetPosition(grandChild, Nz::CoordSys_Global) == Nz::Vector3f(2.f, 1.f, 1.f));
+			}
+		}
+
+		WHEN("We stop inheriting the position")
+		{
+			hierarchy.SetInheritPosition(child, false);
+			hierarchy.Update();
+
+			THEN("The parent position is ignored")
+			{
+				CHECK(hierarchy.GetPosition(child, Nz::CoordSys_Global) == Nz::Vector3f::UnitY());
+				CHECK(hierarchy.GetPosition(grandChild, Nz::CoordSys_Global) == Nz::Vector3f(0.f, 1.f, 1.f));
+			}
+		}
+
+		WHEN("We reparent the grand child to a new root created afterwards")
+		{
+			Nz::TransformHierarchy::NodeId newRoot = hierarchy.CreateNode();
+			hierarchy.SetPosition(newRoot, Nz::Vector3f(0.f, 0.f, 5.f));
+			hierarchy.SetParent(grandChild, newRoot);
+			hierarchy.Update();
+
+			THEN("It follows its new parent")
+			{
+				CHECK(hierarchy.GetParent(grandChild) == newRoot);
+				CHECK(hierarchy.GetPosition(grandChild, Nz::CoordSys_Global) == Nz::Vector3f(0.f, 0.f, 6.f));
+			}
+		}
+
+		WHEN("We destroy the middle node")
+		{
+			hierarchy.DestroyNode(child);
+			hierarchy.Update();
+
+			THEN("Its child becomes a root node")
+			{
+				CHECK_FALSE(hierarchy.IsNodeValid(child));
+				CHECK(hierarchy.GetNodeCount() == 2);
+				CHECK(hierarchy.GetParent(grandChild) == Nz::TransformHierarchy::InvalidNodeId);
+				CHECK(hierarchy.GetPosition(grandChild, Nz::CoordSys_Global) == Nz::Vector3f::UnitZ());
+			}
+
+			AND_THEN("Its identifier is reused")
+			{
+				CHECK(hierarchy.CreateNode() == child);
+			}
+		}
+	}
+
+	GIVEN("A large hierarchy and the equivalent nodes")
+	{
+		constexpr std::size_t nodeCount = 2000;
+
+		Nz::TransformHierarchy hierarchy;
+		std::vector<Nz::TransformHierarchy::NodeId> ids;
+		std::vector<std::unique_ptr<Nz::Node>> nodes;
+
+		for (std::size_t i = 0; i < nodeCount; ++i)
+		{
+			// Each node is attached to a previous one (or is a root), giving a deep and wide hierarchy
+			std::size_t parentIndex = (i % 7 == 0) ? nodeCount : (i * 7919 + 13) % i;
+
+			nodes.emplace_back(new Nz::Node);
+			if (parentIndex < nodeCount)
+			{
+				ids.push_back(hierarchy.CreateNode(ids[parentIndex]));
+				nodes.back()->SetParent(nodes[parentIndex].get());
+			}
+			else
+				ids.push_back(hierarchy.CreateNode());
+
+			float value = static_cast<float>(i % 13);
+			Nz::Vector3f position(value, -value * 0.5f, 1.f);
+			Nz::Quaternionf rotation(Nz::EulerAnglesf(0.f, value * 10.f, 0.f));
+			Nz::Vector3f scale(1.f + value * 0.01f);
+
+			hierarchy.SetPosition(ids.back(), position);
+			hierarchy.SetRotation(ids.back(), rotation);
+			hierarchy.SetScale(ids.back(), scale);
+			nodes.back()->SetPosition(position);
+			nodes.back()->SetRotation(rotation);
+			nodes.back()->SetScale(scale);
+		}
+
+		auto CheckHierarchy = [&]()
+		{
+			bool valid = true;
+			for (std::size_t i = 0; i < nodeCount; ++i)
+			{
+				Nz::Vector3f position = hierarchy.GetPosition(ids[i], Nz::CoordSys_Global);
+				Nz::Vector3f expectedPosition = nodes[i]->GetPosition(Nz::CoordSys_Global);
+				if (position.SquaredDistance(expectedPosition) > 0.0001f * expectedPosition.GetSquaredLength() + 0.0001f)
+					valid = false;
+			}
+
+			return valid;
+		};
+
+		WHEN("We update it sequentially")
+		{
+			hierarchy.Update();
+
+			THEN("Global transforms match the nodes ones")
+			{
+				CHECK(CheckHierarchy());
+			}
+		}
+
+		WHEN("We update it in parallel, then move some roots")
+		{
+			hierarchy.Update(true);
+			REQUIRE(CheckHierarchy());
+
+			for (std::size_t i = 0; i < nodeCount; i += 14)
+			{
+				hierarchy.SetPosition(ids[i], Nz::Vector3f(static_cast<float>(i), 0.f, 0.f));
+				nodes[i]->SetPosition(Nz::Vector3f(static_cast<float>(i), 0.f, 0.f));
+			}
+
+			hierarchy.Update(true);
+
+			THEN("Global transforms still match the nodes ones")
+			{
+				CHECK(CheckHierarchy());
+			}
+		}
+	}
+}
@@ -1,6 +1,8 @@
 #include <NDK/EntityList.hpp>
 #include <NDK/World.hpp>
 #include <Catch/catch.hpp>
+#include <atomic>
+#include <memory>
 
 SCENARIO("EntityList", "[NDK][ENTITYLIST]")
 {
@@ -39,4 +41,41 @@ SCENARIO("EntityList", "[NDK][ENTITYLIST]")
 			}
 		}
 	}
-}
\ No newline at end of file
+
+	GIVEN("A world & a lot of entities")
+	{
+		Ndk::World world(false);
+
+		Ndk::EntityList entityList;
+		for (unsigned int i = 0; i < 1000; ++i)
+		{
+			const Ndk::EntityHandle& entity = world.CreateEntity();
+			if (i % 3 != 0)
+				entityList.Insert(entity);
+		}
+
+		WHEN("We iterate over them in parallel")
+		{
+			std::unique_ptr<std::atomic<unsigned int>[]> visitCounts(new std::atomic<unsigned int>[1000]);
+			for (unsigned int i = 0; i < 1000; ++i)
+				visitCounts[i] = 0;
+
+			entityList.ForEachParallel([&](const Ndk::EntityHandle& entity)
+			{
+				visitCounts[entity->GetId()]++;
+			}, 64);
+
+			THEN("Every entity of the list has been visited once")
+			{
+				bool valid = true;
+				for (unsigned int i = 0; i < 1000; ++i)
+				{
+					if (visitCounts[i] != ((i % 3 != 0) ? 1U : 0U))
+						valid = false;
+				}
+
+				CHECK(valid);
+			}
+		}
+	}
+}
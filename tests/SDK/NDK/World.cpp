@@ -1,6 +1,13 @@
 #include <NDK/World.hpp>
 #include <NDK/Component.hpp>
+#include <NDK/Components/NodeComponent.hpp>
+#include <NDK/Components/VelocityComponent.hpp>
 #include <Catch/catch.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
 
 namespace
 {
@@ -49,6 +56,85 @@ namespace
 	};
 
 	Ndk::SystemIndex UpdateSystem::systemIndex;
+
+	struct SystemUpdates
+	{
+		std::atomic<unsigned int> exclusiveUpdates{0};
+		std::atomic<unsigned int> readerUpdates{0};
+		std::atomic<unsigned int> writerUpdates{0};
+		std::atomic<bool> readerWasLate{false};
+	};
+
+	class WriterSystem : public Ndk::System<WriterSystem>
+	{
+		public:
+			WriterSystem(SystemUpdates& updates) :
+			m_updates(updates)
+			{
+				Writes<Ndk::VelocityComponent>();
+			}
+
+			static Ndk::SystemIndex systemIndex;
+
+		private:
+			void OnUpdate(float /*elapsedTime*/) override
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(5));
+				m_updates.writerUpdates++;
+			}
+
+			SystemUpdates& m_updates;
+	};
+
+	Ndk::SystemIndex WriterSystem::systemIndex;
+
+	class ReaderSystem : public Ndk::System<ReaderSystem>
+	{
+		public:
+			ReaderSystem(SystemUpdates& updates) :
+			m_updates(updates)
+			{
+				Reads<Ndk::NodeComponent, Ndk::VelocityComponent>();
+				SetUpdateOrder(1);
+			}
+
+			static Ndk::SystemIndex systemIndex;
+
+		private:
+			void OnUpdate(float /*elapsedTime*/) override
+			{
+				if (m_updates.writerUpdates != m_updates.readerUpdates + 1)
+					m_updates.readerWasLate = true;
+
+				m_updates.readerUpdates++;
+			}
+
+			SystemUpdates& m_updates;
+	};
+
+	Ndk::SystemIndex ReaderSystem::systemIndex;
+
+	class ExclusiveSystem : public Ndk::System<ExclusiveSystem>
+	{
+		public:
+			ExclusiveSystem(SystemUpdates& updates) :
+			m_updates(updates)
+			{
+				SetUpdateOrder(2);
+			}
+
+			static Ndk::SystemIndex systemIndex;
+
+		private:
+			void OnUpdate(float /*elapsedTime*/) override
+			{
+				m_updates.exclusiveUpdates++;
+			}
+
+			SystemUpdates& m_updates;
+	};
+
+	Ndk::SystemIndex ExclusiveSystem::systemIndex;
 }
 
 SCENARIO("World", "[NDK][WORLD]")
@@ -159,4 +245,140 @@ SCENARIO("World", "[NDK][WORLD]")
 			}
 		}
 	}
+
+	GIVEN("A world with entities owning velocity and node components")
+	{
+		Ndk::World world(false);
+
+		Ndk::EntityHandle a = world.CreateEntity();
+		a->AddComponent<Ndk::NodeComponent>();
+		a->AddComponent<Ndk::VelocityComponent>(Nz::Vector3f::UnitX());
+
+		Ndk::EntityHandle b = world.CreateEntity();
+		b->AddComponent<Ndk::VelocityComponent>(Nz::Vector3f::UnitY());
+
+		Ndk::EntityHandle c = world.CreateEntity();
+		c->AddComponent<Ndk::VelocityComponent>(Nz::Vector3f::UnitZ());
+		c->AddComponent<Ndk::NodeComponent>();
+
+		auto QueryEntities = [&world]()
+		{
+			std::vector<Ndk::EntityId> entities;
+			world.ForEachComponent<Ndk::VelocityComponent, Ndk::NodeComponent>([&](Ndk::EntityId id, Ndk::VelocityComponent& velocity, Ndk::NodeComponent& node)
+			{
+				CHECK(&velocity == &world.GetEntity(id)->GetComponent<Ndk::VelocityComponent>());
+				CHECK(&node == &world.GetEntity(id)->GetComponent<Ndk::NodeComponent>());
+
+				entities.push_back(id);
+			});
+
+			return entities;
+		};
+
+		WHEN("We iterate over entities owning both components")
+		{
+			std::vector<Ndk::EntityId> entities = QueryEntities();
+
+			THEN("Only entities owning both of them are visited")
+			{
+				REQUIRE(entities.size() == 2);
+				CHECK(std::find(entities.begin(), entities.end(), a->GetId()) != entities.end());
+				CHECK(std::find(entities.begin(), entities.end(), c->GetId()) != entities.end());
+			}
+		}
+
+		WHEN("We iterate over them in parallel")
+		{
+			std::atomic<unsigned int> visitCounts[3];
+			for (auto& visitCount : visitCounts)
+				visitCount = 0;
+
+			world.ForEachComponentParallel<Ndk::VelocityComponent, Ndk::NodeComponent>([&](Ndk::EntityId id, Ndk::VelocityComponent& /*velocity*/, Ndk::NodeComponent& /*node*/)
+			{
+				visitCounts[id]++;
+			}, 1);
+
+			THEN("Only entities owning both of them are visited, once")
+			{
+				CHECK(visitCounts[a->GetId()] == 1);
+				CHECK(visitCounts[b->GetId()] == 0);
+				CHECK(visitCounts[c->GetId()] == 1);
+			}
+		}
+
+		WHEN("We remove a component and kill an entity")
+		{
+			a->RemoveComponent<Ndk::NodeComponent>();
+			b->Kill();
+			world.Refresh();
+
+			THEN("Storages are updated")
+			{
+				std::vector<Ndk::EntityId> entities = QueryEntities();
+				REQUIRE(entities.size() == 1);
+				CHECK(entities.front() == c->GetId());
+			}
+
+			AND_THEN("A new entity reusing an id is visited")
+			{
+				Ndk::EntityHandle d = world.CreateEntity();
+				d->AddComponent<Ndk::NodeComponent>();
+				d->AddComponent<Ndk::VelocityComponent>();
+
+				std::vector<Ndk::EntityId> entities = QueryEntities();
+				CHECK(entities.size() == 2);
+				CHECK(std::find(entities.begin(), entities.end(), d->GetId()) != entities.end());
+			}
+		}
+	}
+
+	GIVEN("A world with systems declaring the components they access")
+	{
+		if (WriterSystem::systemIndex == ReaderSystem::systemIndex)
+		{
+			Ndk::InitializeSystem<WriterSystem>();
+			Ndk::InitializeSystem<ReaderSystem>();
+			Ndk::InitializeSystem<ExclusiveSystem>();
+		}
+
+		SystemUpdates updates;
+
+		Ndk::World world(false);
+		world.EnableProfiler();
+
+		Ndk::BaseSystem& writer = world.AddSystem<WriterSystem>(updates);
+		Ndk::BaseSystem& reader = world.AddSystem<ReaderSystem>(updates);
+		Ndk::BaseSystem& exclusive = world.AddSystem<ExclusiveSystem>(updates);
+
+		THEN("Only systems without declared accesses are exclusive")
+		{
+			CHECK_FALSE(writer.IsExclusive());
+			CHECK_FALSE(reader.IsExclusive());
+			CHECK(exclusive.IsExclusive());
+
+			CHECK(writer.ConflictsWith(reader));
+			CHECK(reader.ConflictsWith(writer));
+			CHECK_FALSE(reader.ConflictsWith(reader));
+			CHECK(exclusive.ConflictsWith(reader));
+		}
+
+		WHEN("We update the world a few times")
+		{
+			for (unsigned int i = 0; i < 10; ++i)
+				world.Update(1.f);
+
+			THEN("Every system has been updated and dependencies were respected")
+			{
+				CHECK(updates.writerUpdates == 10);
+				CHECK(updates.readerUpdates == 10);
+				CHECK(updates.exclusiveUpdates == 10);
+				CHECK_FALSE(updates.readerWasLate);
+
+				const Ndk::World::ProfilerData& profilerData = world.GetProfilerData();
+				CHECK(profilerData.updateCount == 10);
+				CHECK(profilerData.updateTime[WriterSystem::systemIndex] >= 50000);
+				CHECK(profilerData.criticalPathTime >= profilerData.updateTime[WriterSystem::systemIndex]);
+			}
+		}
+	}
 }